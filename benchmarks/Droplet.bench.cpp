@@ -0,0 +1,38 @@
+/**
+ * Droplet event loop vs. the number of droplets that are injected into a fixed network.
+ * Arguments: topology, droplet count.
+ */
+void BM_dropletEventLoop(benchmark::State& state) {
+    auto topology = benchmarks::Topology(state.range(0));
+    size_t dropletCount = state.range(1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        sim::Fluid<T>::resetFluidCounter();
+        sim::DropletImplementation<T>::resetDropletCounter();
+        sim::DropletInjection<T>::resetDropletInjectionCounter();
+        auto generated = benchmarks::generateNetwork<T>(topology, 64, 3e-11);
+        sim::AbstractDroplet<T> simulation(generated.network);
+        auto fluid0 = simulation.addFluid(1e-3, 1e3);
+        auto fluid1 = simulation.addFluid(3e-3, 1e3);
+        simulation.setContinuousPhase(fluid0->getId());
+        simulation.set1DResistanceModel();
+        T volume = 1.5 * benchmarks::channelWidth * benchmarks::channelWidth * benchmarks::channelHeight;
+        for (size_t i = 0; i < dropletCount; ++i) {
+            auto droplet = simulation.addDroplet(fluid1->getId(), volume);
+            simulation.addDropletInjection(droplet->getId(), 0.1*i, generated.inletChannels.front(), 0.5);
+        }
+        state.ResumeTiming();
+
+        simulation.simulate();
+
+        state.counters["states"] = simulation.getResults()->getStates().size();
+    }
+
+    state.SetLabel(benchmarks::topologyName(topology));
+    state.counters["droplets"] = dropletCount;
+}
+BENCHMARK(BM_dropletEventLoop)
+    ->ArgsProduct({{int(benchmarks::Topology::Grid), int(benchmarks::Topology::Ladder), int(benchmarks::Topology::Tree)},
+                   benchmark::CreateRange(1, 64, 4)})
+    ->Unit(benchmark::kMillisecond);
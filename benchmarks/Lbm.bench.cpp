@@ -0,0 +1,37 @@
+/**
+ * Throughput of the LBM modules of a hybrid simulation in million lattice updates per second (MLUPS).
+ * The hybrid examples are used, since the modules require STL geometries. The label contains the precision of the
+ * lattice, so that the results of builds with and without USE_FLOAT_LATTICE can be compared.
+ * Arguments: example index.
+ */
+void BM_lbmThroughput(benchmark::State& state) {
+    const std::vector<std::string> files = { "../examples/Hybrid/Continuous/Network1a.JSON",
+                                             "../examples/Hybrid/Continuous/Network2a.JSON",
+                                             "../examples/Hybrid/Continuous/Network4a.JSON" };
+    const std::string& file = files.at(state.range(0));
+
+    double updates = 0.0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        sim::Fluid<T>::resetFluidCounter();
+        sim::CFDSimulator<T>::resetSimulatorCounter();
+        auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(file);
+        auto* hybridSimulation = dynamic_cast<sim::HybridContinuous<T>*>(simulation.get());
+        state.ResumeTiming();
+
+        simulation->simulate();
+
+        state.PauseTiming();
+        for (auto& [id, cfdSimulator] : hybridSimulation->getCFDSimulators()) {
+            if (auto lbm = std::dynamic_pointer_cast<sim::lbmSimulator<T>>(cfdSimulator)) {
+                updates += double(lbm->getFluidCellCount()) * lbm->getIterations();
+            }
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetLabel(file + ((sizeof(sim::LatticePrecision<T>) < sizeof(double)) ? " (float lattice)" : " (double lattice)"));
+    state.counters["latticeBytes"] = sizeof(sim::LatticePrecision<T>);
+    state.counters["MLUPS"] = benchmark::Counter(1e-6*updates, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_lbmThroughput)->DenseRange(0, 2)->Unit(benchmark::kSecond)->Iterations(1);
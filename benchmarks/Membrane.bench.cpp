@@ -0,0 +1,39 @@
+/**
+ * Membrane exchange vs. the number of membranes. Each of the first channels of a ladder network
+ * is given a membrane with an attached tank.
+ * Arguments: membrane count.
+ */
+void BM_membraneExchange(benchmark::State& state) {
+    size_t membraneCount = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        sim::Fluid<T>::resetFluidCounter();
+        sim::Specie<T>::resetSpecieCounter();
+        sim::Mixture<T>::resetMixtureCounter();
+        sim::MixtureInjection<T>::resetMixtureInjectionCounter();
+        auto generated = benchmarks::generateNetwork<T>(benchmarks::Topology::Ladder, 2*membraneCount, 5.5e-8);
+        auto& network = generated.network;
+        for (size_t channelId = 0; channelId < std::min(membraneCount, network->getChannels().size()); ++channelId) {
+            auto membrane = network->addMembraneToChannel(channelId, 55e-6, 0.5*benchmarks::channelWidth, 10e-6, 0.14);
+            network->addTankToMembrane(membrane->getId(), 1e-3, benchmarks::channelWidth);
+        }
+        sim::AbstractMembrane<T> simulation(network);
+        auto fluid = simulation.addFluid(0.7e-3, 0.993e3);
+        simulation.setContinuousPhase(fluid);
+        auto specie = simulation.addSpecie(4.4e-10, 3.894e-3);
+        auto mixture = simulation.addMixture(specie, 1.0);
+        simulation.setInstantaneousMixingModel();
+        simulation.set1DResistanceModel();
+        simulation.setMembraneModel9();
+        simulation.addPermanentMixtureInjection(mixture->getId(), generated.pumps.front()->getId(), 0.0);
+        simulation.setMaxEndTime(3600.0);
+        simulation.setWriteInterval(600.0);
+        state.ResumeTiming();
+
+        simulation.simulate();
+    }
+
+    state.counters["membranes"] = membraneCount;
+}
+BENCHMARK(BM_membraneExchange)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,59 @@
+/**
+ * Abstract concentration simulation with the given mixing model on a network of the given size.
+ */
+void runMixing(benchmark::State& state, bool diffusive) {
+    auto topology = benchmarks::Topology(state.range(0));
+    size_t channelCount = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        sim::Fluid<T>::resetFluidCounter();
+        sim::Specie<T>::resetSpecieCounter();
+        sim::Mixture<T>::resetMixtureCounter();
+        sim::MixtureInjection<T>::resetMixtureInjectionCounter();
+        auto generated = benchmarks::generateNetwork<T>(topology, state.range(1));
+        channelCount = generated.network->getChannels().size();
+        sim::AbstractConcentration<T> simulation(generated.network);
+        auto fluid = simulation.addFluid(1e-3, 1e3);
+        simulation.setContinuousPhase(fluid->getId());
+        simulation.set1DResistanceModel();
+        if (diffusive) {
+            simulation.setDiffusiveMixingModel();
+        } else {
+            simulation.setInstantaneousMixingModel();
+        }
+        auto specie = simulation.addSpecie(1e-9, 1.0);
+        auto mixture = simulation.addMixture(specie, 1.0);
+        simulation.addMixtureInjection(mixture->getId(), generated.inletChannels.front(), 0.0);
+        state.ResumeTiming();
+
+        simulation.simulate();
+    }
+
+    state.SetLabel(benchmarks::topologyName(topology));
+    state.counters["channels"] = channelCount;
+}
+
+/**
+ * Instantaneous mixing vs. the number of channels.
+ * Arguments: topology, approximate node count.
+ */
+void BM_instantaneousMixing(benchmark::State& state) {
+    runMixing(state, false);
+}
+BENCHMARK(BM_instantaneousMixing)
+    ->ArgsProduct({{int(benchmarks::Topology::Grid), int(benchmarks::Topology::Ladder), int(benchmarks::Topology::Tree)},
+                   benchmark::CreateRange(16, 1024, 4)})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Diffusive mixing vs. the number of channels. The diffusive mixing model requires acyclic flow fields,
+ * hence, only tree networks are used.
+ * Arguments: topology, approximate node count.
+ */
+void BM_diffusiveMixing(benchmark::State& state) {
+    runMixing(state, true);
+}
+BENCHMARK(BM_diffusiveMixing)
+    ->ArgsProduct({{int(benchmarks::Topology::Tree)}, benchmark::CreateRange(16, 256, 4)})
+    ->Unit(benchmark::kMillisecond);
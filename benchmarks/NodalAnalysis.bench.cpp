@@ -0,0 +1,29 @@
+/**
+ * Nodal analysis of the flow field vs. the number of nodes.
+ * Arguments: topology, approximate node count.
+ */
+void BM_nodalAnalysis(benchmark::State& state) {
+    auto topology = benchmarks::Topology(state.range(0));
+    auto generated = benchmarks::generateNetwork<T>(topology, state.range(1));
+
+    // One simulation run sorts the groups and validates the network
+    sim::AbstractContinuous<T> simulation(generated.network);
+    auto fluid = simulation.addFluid(1e-3, 1e3);
+    simulation.setContinuousPhase(fluid->getId());
+    simulation.set1DResistanceModel();
+    simulation.simulate();
+
+    nodal::NodalAnalysis<T> nodalAnalysis(generated.network.get());
+    for (auto _ : state) {
+        nodalAnalysis.conductNodalAnalysis();
+    }
+
+    state.SetLabel(benchmarks::topologyName(topology));
+    state.counters["nodes"] = generated.network->getNodes().size();
+    state.counters["channels"] = generated.network->getChannels().size();
+}
+BENCHMARK(BM_nodalAnalysis)
+    ->ArgsProduct({{int(benchmarks::Topology::Grid), int(benchmarks::Topology::Ladder), int(benchmarks::Topology::Tree),
+                    int(benchmarks::Topology::Gradient), int(benchmarks::Topology::RandomPlanar)},
+                   benchmark::CreateRange(64, 65536, 8)})
+    ->Unit(benchmark::kMillisecond);
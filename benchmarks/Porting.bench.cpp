@@ -0,0 +1,133 @@
+#include <cstdio>
+#include <fstream>
+
+/**
+ * Writes the definition of a generated network to a temporary JSON file and returns its location.
+ */
+std::string writeDefinition(benchmarks::Topology topology, size_t nodeCount) {
+    auto generated = benchmarks::generateNetwork<T>(topology, nodeCount);
+    std::string file = "benchmark_" + benchmarks::topologyName(topology) + "_" + std::to_string(nodeCount) + ".JSON";
+    std::ofstream(file) << benchmarks::definitionToJSON(generated).dump();
+    return file;
+}
+
+/**
+ * JSON import of the network and simulation definition, parsing the file for each part separately.
+ * Arguments: topology, approximate node count.
+ */
+void BM_jsonImportSeparately(benchmark::State& state) {
+    auto topology = benchmarks::Topology(state.range(0));
+    std::string file = writeDefinition(topology, state.range(1));
+    for (auto _ : state) {
+        sim::Fluid<T>::resetFluidCounter();
+        auto network = porting::networkFromJSON<T>(file);
+        auto simulation = porting::simulationFromJSON<T>(file, network);
+        benchmark::DoNotOptimize(simulation);
+    }
+    std::remove(file.c_str());
+    state.SetLabel(benchmarks::topologyName(topology));
+}
+BENCHMARK(BM_jsonImportSeparately)
+    ->ArgsProduct({{int(benchmarks::Topology::Grid), int(benchmarks::Topology::Tree)}, benchmark::CreateRange(1024, 65536, 8)})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * JSON import of the network and simulation definition from a single parse of the file.
+ * Arguments: topology, approximate node count.
+ */
+void BM_jsonImportSinglePass(benchmark::State& state) {
+    auto topology = benchmarks::Topology(state.range(0));
+    std::string file = writeDefinition(topology, state.range(1));
+    for (auto _ : state) {
+        sim::Fluid<T>::resetFluidCounter();
+        auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(file);
+        benchmark::DoNotOptimize(simulation);
+    }
+    std::remove(file.c_str());
+    state.SetLabel(benchmarks::topologyName(topology));
+}
+BENCHMARK(BM_jsonImportSinglePass)
+    ->ArgsProduct({{int(benchmarks::Topology::Grid), int(benchmarks::Topology::Tree)}, benchmark::CreateRange(1024, 65536, 8)})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * JSON export of the results of an abstract continuous simulation.
+ * Arguments: topology, approximate node count.
+ */
+void BM_jsonExport(benchmark::State& state) {
+    auto topology = benchmarks::Topology(state.range(0));
+    auto generated = benchmarks::generateNetwork<T>(topology, state.range(1));
+    sim::AbstractContinuous<T> simulation(generated.network);
+    auto fluid = simulation.addFluid(1e-3, 1e3);
+    simulation.setContinuousPhase(fluid->getId());
+    simulation.set1DResistanceModel();
+    simulation.simulate();
+
+    for (auto _ : state) {
+        std::string result = porting::resultToJSON<T>(&simulation).dump();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetLabel(benchmarks::topologyName(topology));
+}
+BENCHMARK(BM_jsonExport)
+    ->ArgsProduct({{int(benchmarks::Topology::Grid), int(benchmarks::Topology::Tree)}, benchmark::CreateRange(1024, 65536, 8)})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Droplet simulation with many states, i.e., the results of a time-dependent simulation, for the export benchmarks.
+ */
+std::pair<arch::GeneratedNetwork<T>, std::unique_ptr<sim::AbstractDroplet<T>>> simulateDropletStates(benchmarks::Topology topology, size_t nodeCount) {
+    sim::Fluid<T>::resetFluidCounter();
+    sim::DropletImplementation<T>::resetDropletCounter();
+    sim::DropletInjection<T>::resetDropletInjectionCounter();
+    auto generated = benchmarks::generateNetwork<T>(topology, nodeCount, 3e-11);
+    auto simulation = std::make_unique<sim::AbstractDroplet<T>>(generated.network);
+    auto fluid0 = simulation->addFluid(1e-3, 1e3);
+    auto fluid1 = simulation->addFluid(3e-3, 1e3);
+    simulation->setContinuousPhase(fluid0->getId());
+    simulation->set1DResistanceModel();
+    simulation->setWriteInterval(0.01);
+    T volume = 1.5 * benchmarks::channelWidth * benchmarks::channelWidth * benchmarks::channelHeight;
+    for (size_t i = 0; i < 8; ++i) {
+        auto droplet = simulation->addDroplet(fluid1->getId(), volume);
+        simulation->addDropletInjection(droplet->getId(), 0.1*i, generated.inletChannels.front(), 0.5);
+    }
+    simulation->simulate();
+    return { std::move(generated), std::move(simulation) };
+}
+
+/**
+ * JSON export of the results of a droplet simulation to a file, through the json object of all results.
+ * Arguments: approximate node count.
+ */
+void BM_jsonExportStatesDom(benchmark::State& state) {
+    auto [generated, simulation] = simulateDropletStates(benchmarks::Topology::Grid, state.range(0));
+    std::string file = "benchmark_export_dom.JSON";
+    for (auto _ : state) {
+        std::ofstream(file) << porting::resultToJSON<T>(simulation.get()).dump(4) << std::endl;
+    }
+    std::remove(file.c_str());
+    state.counters["states"] = simulation->getResults()->getStates().size();
+}
+BENCHMARK(BM_jsonExportStatesDom)
+    ->RangeMultiplier(4)->Range(64, 1024)
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * JSON export of the results of a droplet simulation to a file, streamed in chunks that are dumped by worker threads
+ * while the calling thread writes them.
+ * Arguments: approximate node count, number of threads.
+ */
+void BM_jsonExportStatesChunked(benchmark::State& state) {
+    auto [generated, simulation] = simulateDropletStates(benchmarks::Topology::Grid, state.range(0));
+    std::string file = "benchmark_export_chunked.JSON";
+    for (auto _ : state) {
+        porting::resultToJSON<T>(file, simulation.get(), state.range(1));
+    }
+    std::remove(file.c_str());
+    state.counters["states"] = simulation->getResults()->getStates().size();
+    state.counters["threads"] = state.range(1);
+}
+BENCHMARK(BM_jsonExportStatesChunked)
+    ->ArgsProduct({benchmark::CreateRange(64, 1024, 4), {1, 2, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
@@ -1,24 +1,47 @@
-#include "gtest/gtest.h"
 #include "benchmark/benchmark.h"
 
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include "../src/baseSimulator.h"
 #include "../src/baseSimulator.hh"
 
 using T = double;
 
-void BM_simRun(benchmark::State& state) {
+#include "generators.h"
 
-  std::string file = "../examples/Hybrid/Network4a.JSON";
+#include "NodalAnalysis.bench.cpp"
+#include "Droplet.bench.cpp"
+#include "Mixing.bench.cpp"
+#include "Membrane.bench.cpp"
+#include "Porting.bench.cpp"
+#include "Lbm.bench.cpp"
 
-  // Load and set the network from a JSON file
-  arch::Network<T> network = porting::networkFromJSON<T>(file);
+/**
+ * Runs all benchmarks. Unless another output file is requested on the command line,
+ * the results are additionally written to benchmark_results.json, so that regressions
+ * can be tracked by comparing result files, e.g., with Google Benchmark's compare.py.
+ */
+int main(int argc, char** argv) {
+    std::vector<char*> args(argv, argv + argc);
+    bool hasOutput = false;
+    for (int i = 1; i < argc; ++i) {
+        hasOutput = hasOutput || std::strncmp(argv[i], "--benchmark_out=", 16) == 0;
+    }
+    std::string outFile = "--benchmark_out=benchmark_results.json";
+    std::string outFormat = "--benchmark_out_format=json";
+    if (!hasOutput) {
+        args.push_back(outFile.data());
+        args.push_back(outFormat.data());
+    }
+    int count = int(args.size());
 
-  // Load and set the simulation from a JSON file
-  sim::Simulation<T> testSimulation = porting::simulationFromJSON<T>(file, &network);
-  for (auto _ : state) {
-    testSimulation.simulate();
-  }
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
 }
-BENCHMARK(BM_simRun);
-
-BENCHMARK_MAIN(); 
\ No newline at end of file
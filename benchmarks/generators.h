@@ -0,0 +1,121 @@
+/**
+ * @file generators.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace benchmarks {
+
+/**
+ * @brief Topologies of the generated benchmark networks.
+*/
+enum class Topology {
+    Grid,           ///< Rectangular grid, flow from one corner to the opposite corner.
+    Ladder,         ///< Two parallel rails that are connected by rungs.
+    Tree,           ///< Binary bifurcation tree that is mirrored into a binary merging tree.
+    Gradient,       ///< Gradient generator cascade with two inlets.
+    RandomPlanar    ///< Random connected planar graph on a jittered grid.
+};
+
+constexpr double spacing = 1e-3;           ///< Distance between neighboring nodes in m.
+constexpr double channelWidth = 100e-6;    ///< Width of the generated channels in m.
+constexpr double channelHeight = 30e-6;    ///< Height of the generated channels in m.
+
+inline std::string topologyName(Topology topology) {
+    switch (topology) {
+        case Topology::Grid: return "Grid";
+        case Topology::Ladder: return "Ladder";
+        case Topology::Tree: return "Tree";
+        case Topology::Gradient: return "Gradient";
+        case Topology::RandomPlanar: return "RandomPlanar";
+    }
+    return "";
+}
+
+/**
+ * @brief Generates a network of the given topology with approximately the given number of nodes, see
+ * arch::NetworkGenerator. Random topologies use a fixed seed, so that all runs measure the same network.
+ * @param[in] topology Topology of the network.
+ * @param[in] nodeCount Approximate number of nodes.
+ * @param[in] flowRate Flow rate of each inlet pump in m^3/s.
+ * @returns The generated network.
+*/
+template<typename T>
+arch::GeneratedNetwork<T> generateNetwork(Topology topology, size_t nodeCount, T flowRate = 1e-11) {
+    arch::NetworkGenerator<T> generator(42);
+    generator.setSpacing(spacing);
+    generator.setChannelDimensions(channelWidth, channelHeight);
+    generator.setFlowRate(flowRate);
+
+    size_t n = std::max<size_t>(2, std::lround(std::sqrt(T(nodeCount))));
+    switch (topology) {
+        case Topology::Grid:
+            return generator.grid(n, n);
+        case Topology::Ladder:
+            return generator.serpentineLadder(std::max<size_t>(2, nodeCount / 2), spacing);
+        case Topology::Tree: {
+            // A tree of depth d has 3*2^d - 2 nodes
+            size_t depth = 1;
+            while (3*(size_t(1) << (depth + 1)) - 2 <= nodeCount) {
+                depth++;
+            }
+            return generator.binaryTree(depth);
+        }
+        case Topology::Gradient:
+            // A gradient generator with s stages has approximately s^2/2 nodes
+            return generator.gradientGenerator(std::max<size_t>(1, std::lround(std::sqrt(2.0*nodeCount))), 10*spacing);
+        case Topology::RandomPlanar:
+            return generator.randomPlanar(n, n, 0.3);
+    }
+    throw std::invalid_argument("Unknown benchmark topology.");
+}
+
+/**
+ * @brief Writes the definition of an abstract continuous simulation on a generated network in the JSON format that
+ * is read by porting::networkAndSimulationFromJSON. The pump of the first inlet is written as an additional channel that
+ * is turned into a flow rate pump.
+ * @param[in] generated The generated network.
+ * @returns The JSON definition.
+*/
+template<typename T>
+nlohmann::json definitionToJSON(const arch::GeneratedNetwork<T>& generated) {
+    const auto& network = *generated.network;
+
+    nlohmann::json nodes = nlohmann::json::array();
+    for (size_t nodeId = 0; nodeId < network.getNodes().size(); ++nodeId) {
+        const auto& node = network.getNodes().at(nodeId);
+        nodes.push_back({{"x", node->getPosition()[0]}, {"y", node->getPosition()[1]}, {"ground", node->getGround()}});
+    }
+
+    nlohmann::json channels = nlohmann::json::array();
+    for (size_t channelId = 0; channelId < network.getChannels().size(); ++channelId) {
+        const auto& channel = network.getChannels().at(channelId);
+        channels.push_back({{"node1", channel->getNodeAId()}, {"node2", channel->getNodeBId()},
+                            {"width", channelWidth}, {"height", channelHeight}});
+    }
+    channels.push_back({{"node1", generated.outlet}, {"node2", generated.inlets.front()}, {"width", channelWidth}, {"height", channelHeight}});
+
+    nlohmann::json definition;
+    definition["network"] = {{"nodes", nodes}, {"channels", channels}};
+    definition["simulation"] = {
+        {"platform", "Continuous"},
+        {"type", "Abstract"},
+        {"resistanceModel", "Rectangular"},
+        {"fluids", {{{"name", "Water"}, {"density", 1000}, {"viscosity", 1e-3}}}},
+        {"pumps", {{{"channel", network.getChannels().size()}, {"type", "PumpFlowrate"}, {"flowRate", generated.pumps.front()->getFlowRate()}}}},
+        {"fixtures", {{{"name", "Setup #1"}, {"phase", 0}}}},
+        {"activeFixture", 0}
+    };
+    return definition;
+}
+
+}   // namespace benchmarks
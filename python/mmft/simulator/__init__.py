@@ -11,31 +11,48 @@ from mmft.simulator.pysimulator import (
     CFDSimulator,
     Channel,
     ChannelType,
+    cloneNetworkAndSimulation,
     ConcentrationSemantics,
     createNetwork,
+    Counter,
     CylindricalChannel,
     DiffusiveMixture,
     Droplet,
     DropletInjection,
     Edge,
     FlowRatePump,
+    flushLog,
     Fluid,
+    GeneratedNetwork,
+    getLogLevel,
     HybridConcentration,
     HybridContinuous,
     lbmSimulator,
+    LogLevel,
     Membrane,
     Mixture,
     MixtureInjection,
     Module,
     ModuleType,
     Network,
+    networkAndSimulationFromBinary,
+    networkAndSimulationFromJSON,
+    networkAndSimulationToBinary,
+    NetworkGenerator,
     networkFromJSON,
     Node,
     Opening,
+    Phase,
+    PhaseStatistics,
     Platform,
     PressurePump,
+    Profile,
     RectangularChannel,
+    setLogAsynchronous,
+    setLogLevel,
+    setLogRateLimit,
     Simulation,
+    SimulationFuture,
     Specie,
     State,
     SimulationResult,
@@ -54,31 +71,48 @@ __all__ = [
     'CFDSimulator',
     'Channel',
     'ChannelType',
+    'cloneNetworkAndSimulation',
     'ConcentrationSemantics',
     'createNetwork',
+    'Counter',
     'CylindricalChannel',
     'DiffusiveMixture',
     'Droplet',
     'DropletInjection',
     'Edge',
     'FlowRatePump',
+    'flushLog',
     'Fluid',
+    'GeneratedNetwork',
+    'getLogLevel',
     'HybridConcentration',
     'HybridContinuous',
     'lbmSimulator',
+    'LogLevel',
     'Membrane',
     'Mixture',
     'MixtureInjection',
     'Module',
     'ModuleType',
     'Network',
+    'networkAndSimulationFromBinary',
+    'networkAndSimulationFromJSON',
+    'networkAndSimulationToBinary',
+    'NetworkGenerator',
     'networkFromJSON',
     'Node',
     'Opening',
+    'Phase',
+    'PhaseStatistics',
     'Platform',
     'PressurePump',
+    'Profile',
     'RectangularChannel',
+    'setLogAsynchronous',
+    'setLogLevel',
+    'setLogRateLimit',
     'Simulation',
+    'SimulationFuture',
     'SimulationResult',
     'Specie',
     'State',
@@ -2,6 +2,9 @@
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include "logging/Logger.hh"
+#include "result/Profiler.hh"
+
 #include "architecture/entities/Channel.hh"
 #include "architecture/entities/Module.hh"
 #include "simulation/models/ResistanceModels.hh"
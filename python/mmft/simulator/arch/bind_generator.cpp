@@ -0,0 +1,52 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+
+#include "architecture/entities/Channel.hh"
+#include "architecture/entities/Edge.hh"
+#include "architecture/entities/FlowRatePump.hh"
+#include "architecture/entities/Membrane.hh"
+#include "architecture/entities/Module.hh"
+#include "architecture/entities/Node.hh"
+#include "architecture/entities/PressurePump.hh"
+#include "architecture/entities/Tank.hh"
+#include "architecture/definitions/ModuleOpening.h"
+#include "architecture/Network.hh"
+#include "architecture/NetworkGenerator.hh"
+
+namespace py = pybind11;
+
+using T = double;
+
+void bind_generator(py::module_& m) {
+
+	py::class_<arch::GeneratedNetwork<T>>(m, "GeneratedNetwork")
+		.def_readonly("network", &arch::GeneratedNetwork<T>::network, "The generated network.")
+		.def_readonly("inlets", &arch::GeneratedNetwork<T>::inlets, "Ids of the nodes at which the flow enters the network.")
+		.def_readonly("outlet", &arch::GeneratedNetwork<T>::outlet, "Id of the ground and sink node at which the flow leaves the network.")
+		.def_readonly("inletChannels", &arch::GeneratedNetwork<T>::inletChannels, "Ids of the first channel at each inlet.")
+		.def_readonly("pumps", &arch::GeneratedNetwork<T>::pumps, "Flow rate pumps from the outlet to each inlet.");
+
+	py::class_<arch::NetworkGenerator<T>>(m, "NetworkGenerator")
+		.def(py::init<uint64_t>(), py::arg("seed") = 0, "Creates a network generator. Random topologies are reproducible for a given seed.")
+		.def("setSeed", &arch::NetworkGenerator<T>::setSeed, "Reseeds the generator for random topologies.")
+		.def("setSpacing", &arch::NetworkGenerator<T>::setSpacing, "Set the distance between neighboring nodes [m].")
+		.def("setChannelDimensions", &arch::NetworkGenerator<T>::setChannelDimensions, py::arg("width"), py::arg("height"),
+			"Set the width and height of the generated channels [m].")
+		.def("setFlowRate", &arch::NetworkGenerator<T>::setFlowRate, "Set the flow rate of the pump at each inlet [m^3/s].")
+		.def("getSpacing", &arch::NetworkGenerator<T>::getSpacing, "Returns the distance between neighboring nodes [m].")
+		.def("getChannelWidth", &arch::NetworkGenerator<T>::getChannelWidth, "Returns the width of the generated channels [m].")
+		.def("getChannelHeight", &arch::NetworkGenerator<T>::getChannelHeight, "Returns the height of the generated channels [m].")
+		.def("getFlowRate", &arch::NetworkGenerator<T>::getFlowRate, "Returns the flow rate of the pump at each inlet [m^3/s].")
+		.def("grid", &arch::NetworkGenerator<T>::grid, py::arg("nx"), py::arg("ny"),
+			py::call_guard<py::gil_scoped_release>(), "Generates a rectangular grid of nx*ny nodes.")
+		.def("binaryTree", &arch::NetworkGenerator<T>::binaryTree, py::arg("depth"),
+			py::call_guard<py::gil_scoped_release>(), "Generates a binary bifurcation tree that is mirrored into a merging tree.")
+		.def("gradientGenerator", &arch::NetworkGenerator<T>::gradientGenerator, py::arg("stages"), py::arg("meanderLength"),
+			py::call_guard<py::gil_scoped_release>(), "Generates a gradient generator cascade with two inlets.")
+		.def("serpentineLadder", &arch::NetworkGenerator<T>::serpentineLadder, py::arg("rungs"), py::arg("serpentineLength"),
+			py::call_guard<py::gil_scoped_release>(), "Generates a ladder of two rails that are connected by serpentine rungs.")
+		.def("randomPlanar", &arch::NetworkGenerator<T>::randomPlanar, py::arg("nx"), py::arg("ny"), py::arg("edgeProbability"),
+			py::call_guard<py::gil_scoped_release>(), "Generates a random connected planar graph on a jittered grid of nx*ny nodes.");
+
+}
@@ -1,7 +1,11 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include <optional>
+#include <vector>
+
 #include "architecture/entities/Channel.hh"
 #include "architecture/entities/Edge.hh"
 #include "architecture/entities/FlowRatePump.hh"
@@ -17,6 +21,27 @@ namespace py = pybind11;
 
 using T = double;
 
+namespace {
+
+template<typename V>
+using InputArray = py::array_t<V, py::array::c_style | py::array::forcecast>;
+
+template<typename V>
+std::vector<V> toVector(const InputArray<V>& array) {
+	if (array.ndim() != 1) {
+		throw std::invalid_argument("Expected a one-dimensional array.");
+	}
+	return std::vector<V>(array.data(), array.data() + array.size());
+}
+
+py::array_t<size_t> toArray(std::vector<size_t>&& ids) {
+	py::array_t<size_t> array(ids.size());
+	std::copy(ids.begin(), ids.end(), array.mutable_data());
+	return array;
+}
+
+}   // namespace
+
 void bind_network(py::module_& m) {
 
 	py::class_<arch::Network<T>, py::smart_holder>(m, "Network")
@@ -27,6 +52,22 @@ void bind_network(py::module_& m) {
 			py::arg("x"), py::arg("y"), py::arg("ground")=false, "Add a new node to the network.")
 		.def("addNode", py::overload_cast<T, T, bool, bool>(&arch::Network<T>::addNode), 
 			py::arg("x"), py::arg("y"), py::arg("ground"), py::arg("sink"), "Add a new node to the network.")
+		.def("addNodes", [](arch::Network<T>& network, const InputArray<T>& xs, const InputArray<T>& ys, const std::optional<InputArray<bool>>& ground) {
+				std::vector<T> xValues = toVector(xs);
+				std::vector<T> yValues = toVector(ys);
+				std::vector<bool> groundValues;
+				if (ground.has_value()) {
+					auto flags = toVector(*ground);
+					groundValues.assign(flags.begin(), flags.end());
+				}
+				std::vector<size_t> ids;
+				{
+					py::gil_scoped_release release;
+					ids = network.addNodes(xValues, yValues, groundValues);
+				}
+				return toArray(std::move(ids));
+			}, py::arg("xs"), py::arg("ys"), py::arg("ground")=py::none(), 
+			"Add a batch of new nodes from arrays of coordinates and ground flags. Returns the ids of the new nodes.")
 		.def("getNode", &arch::Network<T>::getNode, "Returns the node with the given id.")
 		.def("getNodes", &arch::Network<T>::getNodes, "Returns all nodes in the network.")
 		.def("getGroundNodes", &arch::Network<T>::getGroundNodes, "Returns the set of nodes that are ground nodes.")
@@ -61,6 +102,23 @@ void bind_network(py::module_& m) {
 			"Add a new channel with rectangular cross-section to the network.")
 		.def("addRectangularChannel", py::overload_cast<const std::shared_ptr<arch::Node<T>>&, const std::shared_ptr<arch::Node<T>>&, T, arch::ChannelType>(&arch::Network<T>::addRectangularChannel), 
 			"Add a new channel with rectangular cross-section to the network.")
+		.def("addRectangularChannels", [](arch::Network<T>& network, const InputArray<size_t>& nodeAIds, const InputArray<size_t>& nodeBIds, 
+				const InputArray<T>& heights, const InputArray<T>& widths, const std::optional<InputArray<T>>& lengths, 
+				const std::optional<std::vector<arch::ChannelType>>& types) {
+				std::vector<size_t> nodeAValues = toVector(nodeAIds);
+				std::vector<size_t> nodeBValues = toVector(nodeBIds);
+				std::vector<T> heightValues = toVector(heights);
+				std::vector<T> widthValues = toVector(widths);
+				std::vector<T> lengthValues = lengths.has_value() ? toVector(*lengths) : std::vector<T>();
+				std::vector<arch::ChannelType> typeValues = types.value_or(std::vector<arch::ChannelType>());
+				std::vector<size_t> ids;
+				{
+					py::gil_scoped_release release;
+					ids = network.addRectangularChannels(nodeAValues, nodeBValues, heightValues, widthValues, lengthValues, typeValues);
+				}
+				return toArray(std::move(ids));
+			}, py::arg("nodeAIds"), py::arg("nodeBIds"), py::arg("heights"), py::arg("widths"), py::arg("lengths")=py::none(), py::arg("types")=py::none(), 
+			"Add a batch of new channels with rectangular cross-section from arrays of node ids and dimensions. Returns the ids of the new channels.")
 		.def("getChannel", &arch::Network<T>::getChannel, "Returns the channel with the given id.")
 		.def("getRectangularChannel", &arch::Network<T>::getRectangularChannel, "Returns the channel with the given id, if it is a rectangular channel.")
 		.def("getChannels", &arch::Network<T>::getChannels, "Returns all channels in the network.")
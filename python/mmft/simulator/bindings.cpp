@@ -26,6 +26,7 @@ PYBIND11_MODULE(pysimulator, m) {
 	bind_tank(m);
 	bind_module(m);
 	bind_network(m);
+	bind_generator(m);
 
 	// Simulator bindings
 	bind_fluid(m);
@@ -46,6 +47,7 @@ PYBIND11_MODULE(pysimulator, m) {
 	bind_cfdConcentration(m);
 	bind_porter(m);
 	bind_results(m);
+	bind_logging(m);
 		
 	#ifdef VERSION_INFO
 	m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
@@ -18,6 +18,7 @@ void bind_membrane(py::module_& m);
 void bind_tank(py::module_& m);
 void bind_module(py::module_& m);
 void bind_network(py::module_& m);
+void bind_generator(py::module_& m);
 
 // sim bindings
 void bind_fluid(py::module_& m);
@@ -38,3 +39,4 @@ void bind_cfdContinuous(py::module_& m);
 void bind_cfdConcentration(py::module_& m);
 void bind_porter(py::module_& m);
 void bind_results(py::module_& m);
+void bind_logging(py::module_& m);
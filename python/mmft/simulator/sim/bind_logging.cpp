@@ -0,0 +1,25 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "logging/Logger.hh"
+
+namespace py = pybind11;
+
+void bind_logging(py::module_& m) {
+
+	py::enum_<logging::LogLevel>(m, "LogLevel")
+		.value("trace", logging::LogLevel::Trace)
+		.value("debug", logging::LogLevel::Debug)
+		.value("info", logging::LogLevel::Info)
+		.value("warning", logging::LogLevel::Warning)
+		.value("error", logging::LogLevel::Error)
+		.value("off", logging::LogLevel::Off);
+
+	m.def("setLogLevel", &logging::Logger::setLevel, "Set the minimal level of the messages that are logged.");
+	m.def("getLogLevel", &logging::Logger::getLevel, "Get the minimal level of the messages that are logged.");
+	m.def("setLogAsynchronous", &logging::Logger::setAsynchronous, "Enable or disable writing the log messages in a background thread.");
+	m.def("setLogRateLimit", [](double seconds) {
+			logging::Logger::setRateLimit(std::chrono::milliseconds(static_cast<int64_t>(seconds * 1000)));
+		}, "Set the minimal interval [s] between two messages that are logged in each iteration.");
+	m.def("flushLog", &logging::Logger::flush, py::call_guard<py::gil_scoped_release>(), "Block until all log messages were written.");
+}
@@ -1,7 +1,12 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include "porting/binaryStreams.hh"
+#include "logging/Logger.hh"
+#include "result/Profiler.hh"
+
 #include "architecture/entities/Channel.hh"
 #include "architecture/entities/Edge.hh"
 #include "architecture/entities/FlowRatePump.hh"
@@ -48,6 +53,7 @@
 
 #include "hybridDynamics/Scheme.hh"
 #include "hybridDynamics/Naive.hh"
+#include "hybridDynamics/Adaptive.hh"
 
 #include "result/Results.hh"
 
@@ -55,15 +61,78 @@ namespace py = pybind11;
 
 using T = double;
 
+namespace {
+
+/**
+ * @brief Returns a read-only NumPy view on a buffer of a state table, without copying. The view keeps the table alive.
+ */
+template<typename V>
+py::array stateTableView(const std::shared_ptr<const result::StateTable<T>>& table, const std::vector<V>& data, std::vector<py::ssize_t> shape) {
+	auto* owner = new std::shared_ptr<const result::StateTable<T>>(table);
+	py::capsule base(owner, [](void* ptr) { delete static_cast<std::shared_ptr<const result::StateTable<T>>*>(ptr); });
+	std::vector<py::ssize_t> strides(shape.size(), sizeof(V));
+	for (size_t i = shape.size(); i > 1; --i) {
+		strides[i - 2] = strides[i - 1] * shape[i - 1];
+	}
+	py::array view(py::dtype::of<V>(), shape, strides, data.data(), base);
+	view.attr("flags").attr("writeable") = false;
+	return view;
+}
+
+}
+
 void bind_results(py::module_& m) {
 
+	py::enum_<result::Phase>(m, "Phase")
+		.value("nodalAnalysis", result::Phase::NodalAnalysis)
+		.value("nodalSolve", result::Phase::NodalSolve)
+		.value("computeEvents", result::Phase::ComputeEvents)
+		.value("performEvent", result::Phase::PerformEvent)
+		.value("updateMixtures", result::Phase::UpdateMixtures)
+		.value("membraneExchange", result::Phase::MembraneExchange)
+		.value("lbmSolve", result::Phase::LbmSolve)
+		.value("writeVTK", result::Phase::WriteVTK)
+		.value("saveState", result::Phase::SaveState);
+
+	py::enum_<result::Counter>(m, "Counter")
+		.value("nodalUnknowns", result::Counter::NodalUnknowns)
+		.value("computedEvents", result::Counter::ComputedEvents)
+		.value("lbmSteps", result::Counter::LbmSteps);
+
+	py::class_<result::PhaseStatistics>(m, "PhaseStatistics")
+		.def_readonly("calls", &result::PhaseStatistics::calls, "Number of calls.")
+		.def_readonly("totalTime", &result::PhaseStatistics::totalTime, "Total run time [s].")
+		.def_readonly("minTime", &result::PhaseStatistics::minTime, "Shortest call [s].")
+		.def_readonly("maxTime", &result::PhaseStatistics::maxTime, "Longest call [s].")
+		.def_readonly("histogram", &result::PhaseStatistics::histogram, "Number of calls per log2 bucket of the run time, bucket b counts [2^b, 2^(b+1)) ns.");
+
+	py::class_<result::Profile, py::smart_holder>(m, "Profile")
+		.def("getPhase", &result::Profile::getPhase, py::return_value_policy::copy, "Get the run time statistics of a phase.")
+		.def("getCounter", &result::Profile::getCounter, "Get the value of a counter.")
+		.def("getPhases", [](const result::Profile& profile) {
+				std::unordered_map<std::string, result::PhaseStatistics> phases;
+				for (size_t i = 0; i < result::phaseCount; ++i) {
+					phases.try_emplace(result::phaseName(result::Phase(i)), profile.getPhase(result::Phase(i)));
+				}
+				return phases;
+			}, "Get the run time statistics of all phases by name.")
+		.def("getCounters", [](const result::Profile& profile) {
+				std::unordered_map<std::string, size_t> counters;
+				for (size_t i = 0; i < result::counterCount; ++i) {
+					counters.try_emplace(result::counterName(result::Counter(i)), profile.getCounter(result::Counter(i)));
+				}
+				return counters;
+			}, "Get the values of all counters by name.")
+		.def("print", &result::Profile::print, "Print the run times and counters.");
+
 	py::class_<result::State<T>, py::smart_holder>(m, "State")
-		.def("getPressures", &result::State<T>::getPressures, "Get read-only references to all pressures that were obtained during the simulation.")
-		.def("getFlowRates", &result::State<T>::getFlowRates, "Get read-only references to all flow rates that were obtained during the simulation.")
+		.def("getPressures", &result::State<T>::getPressures, "Get all pressures of this state, reconstructed from the last keyframe for a delta state.")
+		.def("getFlowRates", &result::State<T>::getFlowRates, "Get all flow rates of this state, reconstructed from the last keyframe for a delta state.")
 		.def("getVtkFiles", &result::State<T>::getVtkFiles, "Get the locations of all vtk files that were written during the simulation.")
 		.def("getDropletPositions", &result::State<T>::getDropletPositions, "Get copies of all droplet positions that were calculated during the simulation.")
 		.def("getMixturePositions", &result::State<T>::getMixturePositions, "Get copies of all mixture positions that were calculated during the simulation.")
 		.def("getTime", &result::State<T>::getTime, "Get the simulation timestamp of this state.")
+		.def("isDelta", &result::State<T>::isDelta, "Returns whether the state only stores the pressures and flow rates that changed since the previous state.")
 		.def("printState", &result::State<T>::printState, "Print the state.");
 
 	py::class_<result::SimulationResult<T>, py::smart_holder>(m, "SimulationResult")
@@ -75,6 +144,28 @@ void bind_results(py::module_& m) {
 		.def("printState", &result::SimulationResult<T>::printState, "Print state with given key.")
 		.def("getMixtures", &result::SimulationResult<T>::getMixtures, "Get read-only references to all mixtures that were defined during the simulation.")
 		.def("printMixtures", &result::SimulationResult<T>::printMixtures, "Print all mixtures that were defined during the simulation.")
-		.def("writeMixture", &result::SimulationResult<T>::writeMixture, "Write the concentration profile of the mixture with given id to a CSV file.");
+		.def("writeMixture", &result::SimulationResult<T>::writeMixture, "Write the concentration profile of the mixture with given id to a CSV file.")
+		.def("getThetaSchedules", &result::SimulationResult<T>::getThetaSchedules, "Get the theta used in each coupling round for all simulators with an adaptive update scheme.")
+		.def("getTimes", [](const result::SimulationResult<T>& result) {
+				auto table = result.getStateTable();
+				return stateTableView(table, table->times, {static_cast<py::ssize_t>(table->times.size())});
+			}, "Get the simulation time of each state as a read-only NumPy array.")
+		.def("getNodeIds", [](const result::SimulationResult<T>& result) {
+				auto table = result.getStateTable();
+				return stateTableView(table, table->nodeIds, {static_cast<py::ssize_t>(table->nodeIds.size())});
+			}, "Get the node id of each column of the pressure matrix as a read-only NumPy array.")
+		.def("getEdgeIds", [](const result::SimulationResult<T>& result) {
+				auto table = result.getStateTable();
+				return stateTableView(table, table->edgeIds, {static_cast<py::ssize_t>(table->edgeIds.size())});
+			}, "Get the edge id of each column of the flow rate matrix as a read-only NumPy array.")
+		.def("getPressureMatrix", [](const result::SimulationResult<T>& result) {
+				auto table = result.getStateTable();
+				return stateTableView(table, table->pressures, {static_cast<py::ssize_t>(table->times.size()), static_cast<py::ssize_t>(table->nodeIds.size())});
+			}, "Get the pressures of all states as a read-only (nStates x nNodes) NumPy array. Missing values are NaN.")
+		.def("getFlowRateMatrix", [](const result::SimulationResult<T>& result) {
+				auto table = result.getStateTable();
+				return stateTableView(table, table->flowRates, {static_cast<py::ssize_t>(table->times.size()), static_cast<py::ssize_t>(table->edgeIds.size())});
+			}, "Get the flow rates of all states as a read-only (nStates x nEdges) NumPy array. Missing values are NaN.")
+		.def("getProfile", &result::SimulationResult<T>::getProfile, "Get the run times and counters of the simulation, or None if profiling was disabled.");
 
 }
\ No newline at end of file
@@ -2,6 +2,15 @@
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include <chrono>
+#include <future>
+#include <optional>
+#include <stdexcept>
+
+#include "porting/binaryStreams.hh"
+#include "logging/Logger.hh"
+#include "result/Profiler.hh"
+
 #include "architecture/entities/Channel.hh"
 #include "architecture/entities/Edge.hh"
 #include "architecture/entities/FlowRatePump.hh"
@@ -52,6 +61,7 @@
 
 #include "simulation/simulators/CFDSim.hh"
 #include "simulation/simulators/cfdHandlers/cfdSimulator.hh"
+#include "simulation/simulators/cfdHandlers/geometryCache.hh"
 #include "simulation/simulators/cfdHandlers/olbContinuous.hh"
 #include "simulation/simulators/cfdHandlers/olbMixing.hh"
 
@@ -59,10 +69,12 @@
 
 #include "hybridDynamics/Scheme.hh"
 #include "hybridDynamics/Naive.hh"
+#include "hybridDynamics/Adaptive.hh"
 
 #include "porting/jsonReaders.hh"
 #include "porting/jsonWriters.hh"
 #include "porting/jsonPorter.hh"
+#include "porting/binaryPorter.hh"
 
 #include "result/Results.hh"
 
@@ -75,9 +87,77 @@ namespace py = pybind11;
 
 using T = double;
 
+namespace {
+
+/**
+ * @brief Handle to a simulation that is conducted on a native worker thread. The simulation is kept alive until
+ * it has finished, and the interpreter lock is released while waiting for it, including in the destructor.
+ * Only abstract simulations are supported, since hybrid and CFD simulations share the global OpenLB state.
+ */
+class SimulationFuture {
+private:
+	std::shared_ptr<sim::Simulation<T>> simulation;
+	std::shared_future<void> future;
+
+public:
+	explicit SimulationFuture(std::shared_ptr<sim::Simulation<T>> simulation_) : simulation(simulation_) {
+		if (simulation_ == nullptr || simulation_->getType() != sim::Type::Abstract) {
+			throw std::invalid_argument("simulate_async only supports abstract simulations. Hybrid and CFD simulations must be conducted with simulate().");
+		}
+		future = std::async(std::launch::async, [simulation = simulation_]() { simulation->simulate(); }).share();
+	}
+
+	SimulationFuture(const SimulationFuture&) = default;
+	SimulationFuture(SimulationFuture&&) = default;
+	SimulationFuture& operator=(const SimulationFuture&) = delete;
+	SimulationFuture& operator=(SimulationFuture&&) = delete;
+
+	/**
+	 * @brief The last reference to the shared state of std::async blocks until the simulation has finished.
+	 * The interpreter lock is released for that wait, so that other Python threads are not blocked.
+	 */
+	~SimulationFuture() {
+		if (future.valid() && !done() && PyGILState_Check()) {
+			py::gil_scoped_release release;
+			future = std::shared_future<void>();
+		}
+	}
+
+	bool done() const {
+		return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+
+	bool wait(std::optional<double> timeout) const {
+		if (!timeout.has_value()) {
+			future.wait();
+			return true;
+		}
+		return future.wait_for(std::chrono::duration<double>(timeout.value())) == std::future_status::ready;
+	}
+
+	std::shared_ptr<result::SimulationResult<T>> result() const {
+		future.get();	// rethrows an exception of the simulation
+		return simulation->getResults();
+	}
+
+	std::shared_ptr<sim::Simulation<T>> getSimulation() const {
+		return simulation;
+	}
+};
+
+}
+
 
 void bind_simulation(py::module_& m) {
 
+	py::class_<SimulationFuture>(m, "SimulationFuture")
+		.def("done", &SimulationFuture::done, "Returns whether the simulation has finished.")
+		.def("wait", &SimulationFuture::wait, py::arg("timeout")=py::none(), py::call_guard<py::gil_scoped_release>(), 
+			"Waits until the simulation has finished, or until the timeout in seconds has passed. Returns whether the simulation has finished.")
+		.def("result", &SimulationFuture::result, py::call_guard<py::gil_scoped_release>(), 
+			"Waits until the simulation has finished and returns its results. Raises the exception of a failed simulation.")
+		.def("getSimulation", &SimulationFuture::getSimulation, "Returns the simulation that is conducted.");
+
 	py::class_<sim::Simulation<T>, py::smart_holder>(m, "Simulation")
 		.def("getPlatform", &sim::Simulation<T>::getPlatform, "Returns the platform of the simulation.")
 		.def("getType", &sim::Simulation<T>::getType, "Returns the type of simulation [Abstract, Hybrid CFD].")
@@ -99,12 +179,26 @@ void bind_simulation(py::module_& m) {
 		.def("setContinuousPhase", py::overload_cast<const std::shared_ptr<sim::Fluid<T>>&>(&sim::Simulation<T>::setContinuousPhase), "Set the continuous phase of the simulation to the given fluid.")
 		.def("getCurrentIteration", &sim::Simulation<T>::getCurrentIteration, "Returns the current iteration number.")
 		.def("getMaxIterations", &sim::Simulation<T>::getMaxIterations, "Returns the maximum number of allowed iterations. When reached the simulation ends.")
-		.def("setWriteInterval", &sim::Simulation<T>::setWriteInterval, "Set the iterations interval at which the stat is saved in the results.")
+		.def("setWriteInterval", &sim::Simulation<T>::setWriteInterval, "Set the time interval [s] at which the state is saved in the results when sampling.")
 		.def("getTMax", &sim::Simulation<T>::getTMax, "Returns the maximum allowed physical time. When reached the simulation ends.")
 		.def("setMaxEndTime", &sim::Simulation<T>::setMaxEndTime, "Set the maximal physical time after which the simulation ends.")
+		.def("setSampling", &sim::Simulation<T>::setSampling, "Enable or disable recording the states only at multiples of the write interval, up to the maximal end time.")
+		.def("isSampling", &sim::Simulation<T>::isSampling, "Returns whether the states are sampled at the write interval.")
+		.def("setKeyframeInterval", &sim::Simulation<T>::setKeyframeInterval, "Set the number of states from one keyframe to the next. The states in between only store the pressures and flow rates that changed.")
+		.def("getKeyframeInterval", &sim::Simulation<T>::getKeyframeInterval, "Returns the keyframe interval of the states.")
+		.def("setProfiling", &sim::Simulation<T>::setProfiling, "Enable or disable the recording of run times and counters, which are available from the results.")
+		.def("isProfiling", &sim::Simulation<T>::isProfiling, "Returns whether run times and counters are recorded.")
 		.def("getResults", &sim::Simulation<T>::getResults, "Returns the results of the simulation.")
 		.def("printResults", &sim::Simulation<T>::printResults, "Prints the results of the simulation to the console.")
-		.def("simulate", &sim::Simulation<T>::simulate, "Conducts the simulation.");
+		.def("simulate", &sim::Simulation<T>::simulate, py::call_guard<py::gil_scoped_release>(), "Conducts the simulation.")
+		.def("start", &sim::Simulation<T>::start, "Prepares the simulation once for stepping with step and advanceTo.")
+		.def("step", &sim::Simulation<T>::step, py::arg("events") = 1, py::call_guard<py::gil_scoped_release>(),
+			"Performs the next events of the simulation. Returns whether events are left.")
+		.def("advanceTo", &sim::Simulation<T>::advanceTo, py::arg("time"), py::call_guard<py::gil_scoped_release>(),
+			"Advances the simulation to the given time [s]. Pump changes since the last call are taken into account. Returns whether events are left.")
+		.def("isFinished", &sim::Simulation<T>::isFinished, "Returns whether a stepped simulation has ended.")
+		.def("simulate_async", [](std::shared_ptr<sim::Simulation<T>> simulation) { return SimulationFuture(simulation); }, 
+			"Conducts an abstract simulation on a native worker thread and returns a SimulationFuture. Only independent simulations, i.e., with separate networks, may run concurrently.");
 
 }
 
@@ -162,6 +256,8 @@ void bind_abstractDroplet(py::module_& m) {
 		.def("addMergedDroplet", py::overload_cast<const std::shared_ptr<sim::Droplet<T>>&, const std::shared_ptr<sim::Droplet<T>>&>(&sim::AbstractDroplet<T>::addMergedDroplet), 
 			"Adds a droplet to the simulator, based on two existing droplets.")
 		.def("getDroplet", &sim::AbstractDroplet<T>::getDroplet, "Returns the droplet with the given id.")
+		.def("setCoalescing", &sim::AbstractDroplet<T>::setCoalescing, "Enable or disable performing all compatible events that take place at the same time in a single iteration.")
+		.def("isCoalescing", &sim::AbstractDroplet<T>::isCoalescing, "Returns whether simultaneous events are coalesced.")
 		.def("getDropletAtNode", py::overload_cast<int>(&sim::AbstractDroplet<T>::getDropletAtNode, py::const_), 
 			"Checks whether a droplet is present at the node with the given id. Returns true and the droplet if one is found.")
 		.def("getDropletAtNode", py::overload_cast<const std::shared_ptr<arch::Node<T>>&>(&sim::AbstractDroplet<T>::getDropletAtNode, py::const_), 
@@ -206,7 +302,9 @@ void bind_abstractConcentration(py::module_& m) {
 		.def(py::init([](std::string file, std::shared_ptr<arch::Network<T>> network){
 				std::unique_ptr<sim::Simulation<T>> tmpPtr = porting::simulationFromJSON<T>(file, network);
 				return std::shared_ptr<sim::AbstractConcentration<T>>(dynamic_cast<sim::AbstractConcentration<T>*>(tmpPtr.release()));
-			}));
+			}))
+		.def("setSteadyState", &sim::AbstractConcentration<T>::setSteadyState, "Set whether only the steady-state concentrations are computed, directly from the flow rates.")
+		.def("isSteadyState", &sim::AbstractConcentration<T>::isSteadyState, "Returns whether only the steady-state concentrations are computed.");
 }
 
 void bind_hybridContinuous(py::module_& m) {
@@ -233,6 +331,12 @@ void bind_hybridContinuous(py::module_& m) {
 			"Set the naive update scheme for the given simulator.")
 		.def("setNaiveHybridScheme", py::overload_cast<const std::shared_ptr<sim::CFDSimulator<T>>&, std::unordered_map<int, T>, std::unordered_map<int, T>, int>(&sim::HybridContinuous<T>::setNaiveHybridScheme), 
 			"Set the naive update scheme for the given simulator.")
+		.def("setAdaptiveHybridScheme", py::overload_cast<T, T, int, int>(&sim::HybridContinuous<T>::setAdaptiveHybridScheme), 
+			"Set the adaptive update scheme for all simulators.")
+		.def("setAdaptiveHybridScheme", py::overload_cast<const std::shared_ptr<sim::CFDSimulator<T>>&, T, T, int, int>(&sim::HybridContinuous<T>::setAdaptiveHybridScheme), 
+			"Set the adaptive update scheme for the given simulator.")
+		.def("setAdaptiveHybridScheme", py::overload_cast<const std::shared_ptr<sim::CFDSimulator<T>>&, std::unordered_map<int, T>, std::unordered_map<int, T>, int, int>(&sim::HybridContinuous<T>::setAdaptiveHybridScheme), 
+			"Set the adaptive update scheme for the given simulator.")
 		.def("getGlobalPressureBounds", &sim::HybridContinuous<T>::getGlobalPressureBounds, "Returns the global pressure bounds in the CFD simulators.")
 		.def("getGlobalVelocityBounds", &sim::HybridContinuous<T>::getGlobalVelocityBounds, "Returns the global velocity bounds in the CFD simulators.")
 		.def("writePressurePpm", &sim::HybridContinuous<T>::writePressurePpm, "Write the pressure field in ppm format for all simulators.")
@@ -261,7 +365,7 @@ void bind_hybridConcentration(py::module_& m) {
 		.def("setDiffusiveMixingModel", &sim::HybridConcentration<T>::setDiffusiveMixingModel, "Sets the diffusive mixing model.")
 		.def("getGlobalConcentrationBounds", &sim::HybridConcentration<T>::getGlobalConcentrationBounds, "Returns the global concentration bounds in the CFD simulators.")
 		.def("writeConcentrationPpm", &sim::HybridConcentration<T>::writeConcentrationPpm, "Write the concentration field in ppm format for all simulators.")
-		.def("simulate", &sim::HybridConcentration<T>::simulate, "Conducts the hybrid mixing simulation.");
+		.def("simulate", &sim::HybridConcentration<T>::simulate, py::call_guard<py::gil_scoped_release>(), "Conducts the hybrid mixing simulation.");
 		
 }
 
@@ -279,7 +383,21 @@ void bind_cfdSimulators(py::module_& m) {
 		.def("writePressurePpm", &sim::CFDSimulator<T>::writePressurePpm, "Write the ppm image of the pressure results.")
 		.def("writeVelocityPpm", &sim::CFDSimulator<T>::writeVelocityPpm, "Write the ppm image of the velocity results.")
 		.def("getPressureBounds", &sim::CFDSimulator<T>::getPressureBounds, "Returns the pressre bounds of the simulator.")
-		.def("getVelocityBounds", &sim::CFDSimulator<T>::getVelocityBounds, "Returns the velocity bounds of the simulator.");
+		.def("getVelocityBounds", &sim::CFDSimulator<T>::getVelocityBounds, "Returns the velocity bounds of the simulator.")
+		.def("writeCheckpoint", &sim::CFDSimulator<T>::writeCheckpoint, "Write a checkpoint of the simulator state to the output directory.")
+		.def("readCheckpoint", &sim::CFDSimulator<T>::readCheckpoint, "Restore the simulator state from a checkpoint in the output directory.")
+		.def("setCheckpointInterval", &sim::CFDSimulator<T>::setCheckpointInterval, "Set the number of iterations between automatic checkpoints (0 = disabled).")
+		.def("setRestartCheckpoint", &sim::CFDSimulator<T>::setRestartCheckpoint, "Set the checkpoint from which the simulator is restored after the lattice is prepared.")
+		.def("setWarmStartCheckpoint", &sim::CFDSimulator<T>::setWarmStartCheckpoint, "Set the checkpoint from which only the lattice populations are loaded as initial field.")
+		.def("setPoiseuilleWarmStart", &sim::CFDSimulator<T>::setPoiseuilleWarmStart, "Set whether the initial field is estimated from the Poiseuille channels of the module network.");
+
+	py::class_<sim::GeometryCache<T>>(m, "GeometryCache")
+		.def_static("setEnabled", &sim::GeometryCache<T>::setEnabled, "Enables or disables the cache of voxelized module geometries.")
+		.def_static("isEnabled", &sim::GeometryCache<T>::isEnabled, "Returns whether the geometry cache is enabled.")
+		.def_static("setDirectory", &sim::GeometryCache<T>::setDirectory, "Sets the directory in which geometries are cached on disk (empty = in memory only).")
+		.def_static("getDirectory", &sim::GeometryCache<T>::getDirectory, "Returns the directory in which geometries are cached on disk.")
+		.def_static("clear", &sim::GeometryCache<T>::clear, "Removes all geometries from memory.")
+		.def_static("size", &sim::GeometryCache<T>::size, "Returns the number of geometries in memory.");
 
 	py::class_<sim::lbmSimulator<T>, sim::CFDSimulator<T>, py::smart_holder>(m, "lbmSimulator")
 		.def("getCharPhysLength", &sim::lbmSimulator<T>::getCharPhysLength, "Returns the characteristic physical length of the lbm simulator.")
@@ -327,13 +445,19 @@ void bind_cfdContinuous(py::module_& m) {
 		.def("setCharPhysVelocity", &sim::CfdContinuous<T>::setCharPhysVelocity, "Sets the characteristic physical velocity of the LBM simulator.")
 		.def("setWritePpm", &sim::CfdContinuous<T>::setWritePpm, "Sets whether ppm images should be written during the simulation.")
 		.def("isWritePpm", &sim::CfdContinuous<T>::isWritePpm, "Returns whether ppm images are written during the simulation.")
+		.def("setCheckpointInterval", &sim::CfdContinuous<T>::setCheckpointInterval, "Sets the number of iterations between automatic checkpoints (0 = disabled).")
+		.def("setRestartCheckpoint", &sim::CfdContinuous<T>::setRestartCheckpoint, "Sets the checkpoint from which the CFD simulator is restored.")
+		.def("setWarmStartCheckpoint", &sim::CfdContinuous<T>::setWarmStartCheckpoint, "Sets the checkpoint from which the CFD simulator loads its initial field.")
+		.def("setWriteStl", &sim::CfdContinuous<T>::setWriteStl, "Sets whether the generated geometry is handed over through an STL file, the default, instead of in memory.")
+		.def("isWriteStl", &sim::CfdContinuous<T>::isWriteStl, "Returns whether the generated geometry is handed over through an STL file.")
+		.def("writeCheckpoint", &sim::CfdContinuous<T>::writeCheckpoint, "Write a checkpoint of the CFD simulator state.")
 		.def("getCharacteristicLength", &sim::CfdContinuous<T>::getCharacteristicLength, "Returns the characteristic length of the LBM simulator.")
 		.def("getCharacteristicVelocity", &sim::CfdContinuous<T>::getCharacteristicVelocity, "Returns the characteristic velocity of the LBM simulator.")
 		.def("getGlobalPressureBounds", &sim::CfdContinuous<T>::getGlobalPressureBounds, "Returns the global pressure bounds in the CFD simulator.")
 		.def("getGlobalVelocityBounds", &sim::CfdContinuous<T>::getGlobalVelocityBounds, "Returns the global velocity bounds in the CFD simulator.")
 		.def("writePressurePpm", &sim::CfdContinuous<T>::writePressurePpm, "Write the pressure field in ppm format.")
 		.def("writeVelocityPpm", &sim::CfdContinuous<T>::writeVelocityPpm, "Write the velocity field in ppm format.")
-		.def("simulate", &sim::CfdContinuous<T>::simulate, "Conducts the simulation.");
+		.def("simulate", &sim::CfdContinuous<T>::simulate, py::call_guard<py::gil_scoped_release>(), "Conducts the simulation.");
 
 }
 
@@ -353,10 +477,30 @@ void bind_cfdConcentration(py::module_& m) {
 		.def("removeConcentrationBC", &sim::CfdConcentration<T>::removeConcentrationBC, "Removes the concentration boundary condition from the given node.")
 		.def("getGlobalConcentrationBounds", &sim::CfdConcentration<T>::getGlobalConcentrationBounds, "Returns the global concentration bounds in the CFD simulator.")
 		.def("writeConcentrationPpm", &sim::CfdConcentration<T>::writeConcentrationPpm, "Write the concentration field in ppm format.")
-		.def("simulate", &sim::CfdConcentration<T>::simulate, "Conducts the simulation.");
+		.def("simulate", &sim::CfdConcentration<T>::simulate, py::call_guard<py::gil_scoped_release>(), "Conducts the simulation.");
 
 }
 
 void bind_porter(py::module_& m) {
-	m.def("networkFromJSON", py::overload_cast<std::string>(&porting::networkFromJSON<T>), "Create a Network object from JSON definition.");
+	m.def("networkFromJSON", py::overload_cast<std::string>(&porting::networkFromJSON<T>), py::call_guard<py::gil_scoped_release>(), "Create a Network object from JSON definition.");
+	m.def("networkAndSimulationFromJSON", [](std::string file) {
+			auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(file);
+			return std::make_pair(network, std::shared_ptr<sim::Simulation<T>>(std::move(simulation)));
+		}, py::call_guard<py::gil_scoped_release>(), "Create a Network and a Simulation object from JSON definition, parsing the file only once.");
+	m.def("networkAndSimulationToBinary", [](sim::Simulation<T>* simulation) {
+			std::string binary;
+			{
+				py::gil_scoped_release release;
+				binary = porting::networkAndSimulationToBinary<T>(simulation);
+			}
+			return py::bytes(binary);
+		}, "Write the network and the setup of a simulation to a compact binary snapshot, e.g., to send it to another process.");
+	m.def("networkAndSimulationFromBinary", [](const std::string& binary) {
+			auto [network, simulation] = porting::networkAndSimulationFromBinary<T>(binary);
+			return std::make_pair(network, std::shared_ptr<sim::Simulation<T>>(std::move(simulation)));
+		}, py::call_guard<py::gil_scoped_release>(), "Create a Network and a Simulation object from a binary snapshot.");
+	m.def("cloneNetworkAndSimulation", [](sim::Simulation<T>* simulation) {
+			auto [network, simulation_] = porting::cloneNetworkAndSimulation<T>(simulation);
+			return std::make_pair(network, std::shared_ptr<sim::Simulation<T>>(std::move(simulation_)));
+		}, py::call_guard<py::gil_scoped_release>(), "Create an independent copy of the network and the setup of a simulation.");
 }
\ No newline at end of file
@@ -4,16 +4,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
+#include "definitions/DenseIndex.h"
+
 using json = nlohmann::json;
 
 namespace test::definitions {
@@ -27,9 +33,9 @@ namespace porting {
 
 // Forward declared dependencies
 template<typename T>
-void readNodes (json jsonString, arch::Network<T>& network);
+void readNodes (const json& jsonString, arch::Network<T>& network);
 template<typename T>
-void readChannels (json jsonString, arch::Network<T>& network);
+void readChannels (const json& jsonString, arch::Network<T>& network);
 
 }
 
@@ -145,6 +151,18 @@ private:
 
     int virtualNodes = 0;
 
+    mutable DenseIndex nodeIndex;                                                   ///< Dense indices of the node ids.
+    mutable DenseIndex edgeIndex;                                                   ///< Dense indices of the ids of channels, flow rate pumps and pressure pumps.
+    mutable std::atomic<bool> indicesOutdated { true };                             ///< Whether nodes or edges were added or removed since the indices were built.
+    mutable std::mutex indexMutex;                                                  ///< Guards the rebuild of the indices against concurrent accesses.
+
+    /**
+     * @brief Rebuilds the node and edge indices if nodes or edges were added or removed since they were last built.
+     * The indices may be requested from several threads concurrently, only one of them rebuilds the indices while
+     * the others wait.
+    */
+    void updateIndices() const;
+
 protected:
     /**
      * @brief Constructor of the Network
@@ -287,6 +305,14 @@ public:
         return std::shared_ptr<Network<T>>(new Network<T>());
     }
 
+    /**
+     * @brief Creates a member-wise deep copy of the network, which keeps the ids of all elements. The nodes, channels of
+     * any shape (including their geometry, lengths and resistances), pumps, membranes, tanks and modules are copied.
+     * The groups are sorted again when a simulation is initialized on the copy.
+     * @returns Pointer to the copied network.
+    */
+    [[nodiscard]] std::shared_ptr<Network<T>> clone() const;
+
     /**
      * @brief Get all the nodes in the network that are dangling. I.e., that are connected to 1 ege.
      * @return A vector of all dangling nodes.
@@ -333,6 +359,17 @@ public:
     */
     [[maybe_unused]] std::shared_ptr<Node<T>> addNode(T x, T y, bool ground, bool sink);
 
+    /**
+     * @brief Adds a batch of new nodes to the network. Capacity for all nodes is reserved up front, which avoids
+     * rehashing while large networks are built.
+     * @param[in] xs x-coordinates of the nodes in m.
+     * @param[in] ys y-coordinates of the nodes in m.
+     * @param[in] ground Ground flags of the nodes. If empty, no node is a ground node.
+     * @return Ids of the newly created nodes, in the order of the given coordinates.
+     * @throws std::invalid_argument if the number of entries does not match.
+    */
+    [[maybe_unused]] std::vector<size_t> addNodes(const std::vector<T>& xs, const std::vector<T>& ys, const std::vector<bool>& ground={});
+
     /**
      * @brief Get a pointer to the node with the specific id.
     */
@@ -344,6 +381,15 @@ public:
     */
     [[nodiscard]] inline const std::unordered_map<size_t, std::shared_ptr<Node<T>>>& getNodes() const { return nodes; }
 
+    /**
+     * @brief Get the dense indices of the nodes, i.e., a contiguous index in [0, nNodes) for each node id, in
+     * ascending order of the ids. The index is rebuilt on access after nodes were added or removed. Only the index
+     * is dense, the nodes themselves are still stored by id.
+     * @note The index may be accessed concurrently, but not while nodes are added or removed.
+     * @returns Dense index of the node ids.
+    */
+    [[nodiscard]] const DenseIndex& getNodeIndex() const;
+
     /**
      * @brief Returns a pointer to the ground node.
      * @return Pointer to the ground node.
@@ -569,6 +615,22 @@ public:
         return addRectangularChannel(nodeA->getId(), nodeB->getId(), resistance, type); 
     }
 
+    /**
+     * @brief Adds a batch of new channels with rectangular cross-section to the chip. All arguments are validated
+     * before the network is modified, and capacity for the channels and the reach of each node is reserved up front.
+     * @param[in] nodeAIds Ids of the nodes at one end of the channels.
+     * @param[in] nodeBIds Ids of the nodes at the other end of the channels.
+     * @param[in] heights Heights of the channels in m.
+     * @param[in] widths Widths of the channels in m.
+     * @param[in] lengths Lengths of the channels in m. If empty, the distance between the nodes is used.
+     * @param[in] types What kind of channels they are. If empty, all channels are normal channels.
+     * @return Ids of the newly created channels, in the order of the given nodes.
+     * @throws std::invalid_argument if the number of entries does not match or a node is not in the network.
+     */
+    [[maybe_unused]] std::vector<size_t> addRectangularChannels(const std::vector<size_t>& nodeAIds, const std::vector<size_t>& nodeBIds, 
+                                                                const std::vector<T>& heights, const std::vector<T>& widths, 
+                                                                const std::vector<T>& lengths={}, const std::vector<ChannelType>& types={});
+
     /**
      * @brief Get a pointer to the channel with the specific id.
      * @param[in] channelId Id of the channel.
@@ -588,6 +650,15 @@ public:
     */
     [[nodiscard]] inline const std::unordered_map<size_t, std::shared_ptr<Channel<T>>>& getChannels() const { return channels; }
 
+    /**
+     * @brief Get the dense indices of the edges that carry a flow rate, i.e., the channels, flow rate pumps and
+     * pressure pumps, in ascending order of their ids. The index is rebuilt on access after edges were added or removed.
+     * Only the index is dense, the edges themselves are still stored by id.
+     * @note The index may be accessed concurrently, but not while edges are added or removed.
+     * @returns Dense index of the edge ids.
+    */
+    [[nodiscard]] const DenseIndex& getEdgeIndex() const;
+
     /**
      * @brief Get a map of all channels at a specific node.
      * @param[in] nodeId Id of the node at which the adherent channels should be returned.
@@ -635,6 +706,16 @@ public:
      */
     [[maybe_unused]] std::shared_ptr<FlowRatePump<T>> addFlowRatePump(size_t nodeAId, size_t nodeBId, T flowRate);
 
+    /**
+     * @brief Adds a new flow rate pump with a given id to the network.
+     * @param[in] nodeAId Id of the node at one end of the flow rate pump.
+     * @param[in] nodeBId Id of the node at the other end of the flow rate pump.
+     * @param[in] flowRate Volumetric flow rate of the pump in m^3/s.
+     * @param[in] pumpId Id of the flow rate pump.
+     * @return Pointer to the newly created flow rate pump.
+     */
+    [[maybe_unused]] std::shared_ptr<FlowRatePump<T>> addFlowRatePump(size_t nodeAId, size_t nodeBId, T flowRate, size_t pumpId);
+
     /**
      * @brief Adds a new flow rate pump to the network.
      * @param[in] nodeA Pointer to the node at one end of the flow rate pump.
@@ -687,6 +768,16 @@ public:
      */
     [[maybe_unused]] std::shared_ptr<PressurePump<T>> addPressurePump(size_t nodeAId, size_t nodeBId, T pressure);
 
+    /**
+     * @brief Adds a new pressure pump with a given id to the chip.
+     * @param[in] nodeAId Id of the node at one end of the pressure pump.
+     * @param[in] nodeBId Id of the node at the other end of the pressure pump.
+     * @param[in] pressure Pressure of the pump in Pas/L.
+     * @param[in] pumpId Id of the pressure pump.
+     * @return Pointer to the newly created pressure pump.
+     */
+    [[maybe_unused]] std::shared_ptr<PressurePump<T>> addPressurePump(size_t nodeAId, size_t nodeBId, T pressure, size_t pumpId);
+
     /**
      * @brief Adds a new pressure pump to the chip.
      * @param[in] nodeA Pointer to the node at one end of the pressure pump.
@@ -745,6 +836,21 @@ public:
                                                                 std::string stlFile,
                                                                 std::unordered_map<size_t, Opening<T>> openings);
 
+    /**
+     * @brief Adds a new module with a given id to the network.
+     * @param[in] position Absolute position of the module in the network w.r.t. bottom left corner.
+     * @param[in] size Absolute size of the module in m.
+     * @param[in] stlFile Location of the stl file that gives the geometry of the domain.
+     * @param[in] openings Map of openings corresponding to the nodes.
+     * @param[in] moduleId Id of the module.
+     * @return Pointer to the newly created module.
+    */
+    [[maybe_unused]] std::shared_ptr<CfdModule<T>> addCfdModule(std::vector<T> position,
+                                                                std::vector<T> size,
+                                                                std::string stlFile,
+                                                                std::unordered_map<size_t, Opening<T>> openings,
+                                                                size_t moduleId);
+
     /**
      * @brief Get a pointer to the module with the specidic id.
     */
@@ -778,6 +884,18 @@ public:
      */
     [[maybe_unused]] std::shared_ptr<Membrane<T>> addMembraneToChannel(size_t channelId, T height, T width, T poreRadius, T porosity);
 
+    /**
+     * @brief Creates and adds a membrane with a given id to a channel in the simulator.
+     * @param[in] channelId Id of the channel. Channel defines nodes, length and width.
+     * @param[in] height Height of the channel in m.
+     * @param[in] width Width of the channel in m.
+     * @param[in] poreSize Size of the pores in m.
+     * @param[in] porosity Porosity of the membrane in % (between 0 and 1).
+     * @param[in] membraneId Id of the membrane.
+     * @return Pointer to the membrane.
+     */
+    [[maybe_unused]] std::shared_ptr<Membrane<T>> addMembraneToChannel(size_t channelId, T height, T width, T poreRadius, T porosity, size_t membraneId);
+
     /**
      * @brief Creates and adds a membrane to a channel in the simulator.
      * @param[in] channel Pointer to the channel. Channel defines nodes, length and width.
@@ -858,6 +976,15 @@ public:
      */
     [[maybe_unused]] std::shared_ptr<Tank<T>> addTankToMembrane(size_t membraneId, T height, T width);
 
+    /**
+     * @brief Creates and adds a tank with a given id to a membrane in the simulator.
+     * @param[in] membraneId Id of the membrane. Membrane defines nodes, length and width.
+     * @param[in] height Height of the tank in m.
+     * @param[in] width Width of the channel in m.
+     * @param[in] tankId Id of the tank.
+     */
+    [[maybe_unused]] std::shared_ptr<Tank<T>> addTankToMembrane(size_t membraneId, T height, T width, size_t tankId);
+
     /**
      * @brief Creates and adds a tank to a membrane in the simulator.
      * @param[in] membrane Pointer to the membrane. Membrane defines nodes, length and width.
@@ -921,8 +1048,8 @@ public:
     friend class nodal::NodalAnalysis<T>;
     friend class sim::Simulation<T>;
     friend class test::definitions::GlobalTest<T>;
-    friend void porting::readNodes<T>(json, arch::Network<T>&);
-    friend void porting::readChannels<T>(json, arch::Network<T>&);
+    friend void porting::readNodes<T>(const json&, arch::Network<T>&);
+    friend void porting::readChannels<T>(const json&, arch::Network<T>&);
 };
 
 }   // namespace arch
@@ -38,6 +38,72 @@ Network<T>::Network(std::unordered_map<size_t, std::shared_ptr<Node<T>>> nodes_)
     }
 }
 
+template<typename T>
+std::shared_ptr<Network<T>> Network<T>::clone() const {
+    auto network = createNetwork();
+    network->virtualNodes = virtualNodes;
+
+    for (auto& [nodeId, node] : nodes) {
+        auto copy = std::make_shared<Node<T>>(*node);
+        network->nodes.try_emplace(nodeId, copy);
+        network->reach.try_emplace(nodeId);
+        if (copy->getGround()) {
+            network->groundNodes.emplace(copy);
+        }
+        if (copy->getSink()) {
+            network->sinks.emplace(copy);
+        }
+    }
+
+    for (auto& [channelId, channel] : channels) {
+        std::shared_ptr<Channel<T>> copy;
+        if (channel->isRectangular()) {
+            copy = std::make_shared<RectangularChannel<T>>(static_cast<const RectangularChannel<T>&>(*channel));
+        } else if (channel->isCylindrical()) {
+            copy = std::make_shared<CylindricalChannel<T>>(static_cast<const CylindricalChannel<T>&>(*channel));
+        } else {
+            throw std::logic_error("Cannot copy channel " + std::to_string(channelId) + " of unknown shape.");
+        }
+        network->channels.try_emplace(channelId, copy);
+        network->reach.at(copy->getNodeAId()).try_emplace(channelId, copy);
+        network->reach.at(copy->getNodeBId()).try_emplace(channelId, copy);
+    }
+
+    for (auto& [pumpId, pump] : flowRatePumps) {
+        network->flowRatePumps.try_emplace(pumpId, std::make_shared<FlowRatePump<T>>(*pump));
+    }
+    for (auto& [pumpId, pump] : pressurePumps) {
+        network->pressurePumps.try_emplace(pumpId, std::make_shared<PressurePump<T>>(*pump));
+    }
+
+    // membranes and tanks refer to the copied channels and tanks
+    for (auto& [tankId, tank] : tanks) {
+        network->tanks.try_emplace(tankId, std::make_shared<Tank<T>>(*tank));
+    }
+    for (auto& [membraneId, membrane] : membranes) {
+        auto copy = std::make_shared<Membrane<T>>(*membrane);
+        if (membrane->getChannel() != nullptr) {
+            copy->setChannel(network->channels.at(membrane->getChannel()->getId()));
+        }
+        if (membrane->getTank() != nullptr) {
+            copy->setTank(network->tanks.at(membrane->getTank()->getId()));
+        }
+        network->membranes.try_emplace(membraneId, copy);
+    }
+
+    // modules are added anew, with openings at the copied nodes
+    for (auto& [moduleId, module] : modules) {
+        auto openings = module->getOpenings();
+        for (auto& [nodeId, opening] : openings) {
+            opening.node = network->nodes.at(nodeId);
+        }
+        network->addCfdModule(module->getPosition(), module->getSize(), module->getStlFile(), std::move(openings), moduleId);
+    }
+
+    network->indicesOutdated = true;
+    return network;
+}
+
 template<typename T>
 void Network<T>::visitNodes(size_t id, std::unordered_map<size_t, bool>& visitedNodes, std::unordered_map<size_t, bool>& visitedChannels, std::unordered_map<size_t, bool>& visitedModules) {
     const auto net = reach.at(id);
@@ -64,6 +130,49 @@ void Network<T>::visitNodes(size_t id, std::unordered_map<size_t, bool>& visited
     }
 }
 
+template<typename T>
+void Network<T>::updateIndices() const {
+    if (!indicesOutdated.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(indexMutex);
+    if (!indicesOutdated.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::vector<size_t> nodeIds;
+    nodeIds.reserve(nodes.size());
+    for (auto& [nodeId, node] : nodes) {
+        nodeIds.push_back(nodeId);
+    }
+    nodeIndex.assign(std::move(nodeIds));
+
+    std::vector<size_t> edgeIds;
+    edgeIds.reserve(channels.size() + flowRatePumps.size() + pressurePumps.size());
+    for (auto& [channelId, channel] : channels) {
+        edgeIds.push_back(channelId);
+    }
+    for (auto& [pumpId, pump] : flowRatePumps) {
+        edgeIds.push_back(pumpId);
+    }
+    for (auto& [pumpId, pump] : pressurePumps) {
+        edgeIds.push_back(pumpId);
+    }
+    edgeIndex.assign(std::move(edgeIds));
+    indicesOutdated.store(false, std::memory_order_release);
+}
+
+template<typename T>
+const DenseIndex& Network<T>::getNodeIndex() const {
+    updateIndices();
+    return nodeIndex;
+}
+
+template<typename T>
+const DenseIndex& Network<T>::getEdgeIndex() const {
+    updateIndices();
+    return edgeIndex;
+}
+
 template<typename T>
 size_t Network<T>::edgeCount() const {
     return channels.size() + flowRatePumps.size() + pressurePumps.size() + membranes.size() + tanks.size();
@@ -84,6 +193,7 @@ void Network<T>::removeFlowRatePumpsFromNodeReach(size_t nodeId) {
         auto pump = it->second;
         if (pump->getNodeAId() == nodeId || pump->getNodeBId() == nodeId) {
             it = flowRatePumps.erase(it);
+            indicesOutdated = true;
         } else {
             ++it;
         }
@@ -97,6 +207,7 @@ void Network<T>::removePressurePumpsFromNodeReach(size_t nodeId) {
         auto pump = it->second;
         if (pump->getNodeAId() == nodeId || pump->getNodeBId() == nodeId) {
             it = pressurePumps.erase(it);
+            indicesOutdated = true;
         } else {
             ++it;
         }
@@ -150,6 +261,7 @@ template<typename T>
 std::shared_ptr<Node<T>> Network<T>::addNode(size_t nodeId, T x_, T y_, bool ground_) {
     auto nodePtr = std::shared_ptr<Node<T>>(new Node<T>(nodeId, x_, y_, ground_));
     auto result = nodes.insert({nodeId, nodePtr});
+    indicesOutdated = true;
 
     if (result.second) {
         // insertion happened and we have to add an additional entry into the reach
@@ -167,6 +279,26 @@ std::shared_ptr<Node<T>> Network<T>::addNode(size_t nodeId, T x_, T y_, bool gro
     return nodePtr;
 }
 
+template<typename T>
+std::vector<size_t> Network<T>::addNodes(const std::vector<T>& xs, const std::vector<T>& ys, const std::vector<bool>& ground) {
+    if (xs.size() != ys.size() || (!ground.empty() && ground.size() != xs.size())) {
+        throw std::invalid_argument("Could not add nodes. The coordinates and ground flags must have the same number of entries.");
+    }
+
+    nodes.reserve(nodes.size() + xs.size());
+    reach.reserve(reach.size() + xs.size());
+
+    std::vector<size_t> nodeIds;
+    nodeIds.reserve(xs.size());
+    for (size_t i = 0; i < xs.size(); ++i) {
+        size_t nodeId = nodes.size();
+        addNode(nodeId, xs[i], ys[i], !ground.empty() && ground[i]);
+        nodeIds.push_back(nodeId);
+    }
+
+    return nodeIds;
+}
+
 template<typename T>
 std::shared_ptr<Node<T>> Network<T>::getNode(size_t nodeId) const {
     if (nodes.count(nodeId)) {
@@ -232,6 +364,7 @@ void Network<T>::removeNode(const std::shared_ptr<Node<T>>& node) {
         sinks.erase(node);
         groundNodes.erase(node);
         nodes.erase(nodeId);
+        indicesOutdated = true;
     } else {
         throw std::logic_error("Network does not contain node " + std::to_string(nodeId) + ".");
     }
@@ -256,6 +389,7 @@ std::shared_ptr<RectangularChannel<T>> Network<T>::addRectangularChannel(size_t
 
     // add channel
     auto [it, is_inserted] = channels.try_emplace(channelId, addRectangularChannel);
+    indicesOutdated = true;
     assert(is_inserted);
 
     return addRectangularChannel;
@@ -296,6 +430,47 @@ std::shared_ptr<RectangularChannel<T>> Network<T>::addRectangularChannel(size_t
     return addChannel;
 }
 
+template<typename T>
+std::vector<size_t> Network<T>::addRectangularChannels(const std::vector<size_t>& nodeAIds, const std::vector<size_t>& nodeBIds, 
+                                                       const std::vector<T>& heights, const std::vector<T>& widths, 
+                                                       const std::vector<T>& lengths, const std::vector<ChannelType>& types) {
+    const size_t count = nodeAIds.size();
+    if (nodeBIds.size() != count || heights.size() != count || widths.size() != count || 
+        (!lengths.empty() && lengths.size() != count) || (!types.empty() && types.size() != count)) {
+        throw std::invalid_argument("Could not add channels. The nodes, dimensions and types must have the same number of entries.");
+    }
+
+    // Validate the nodes and count the new channels at each node, before anything is added
+    std::unordered_map<size_t, size_t> nodeDegrees;
+    nodeDegrees.reserve(std::min(2 * count, nodes.size()));
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t nodeId : {nodeAIds[i], nodeBIds[i]}) {
+            if (!nodes.count(nodeId)) {
+                throw std::invalid_argument("Could not add channels. Network does not contain node " + std::to_string(nodeId) + ".");
+            }
+            nodeDegrees[nodeId]++;
+        }
+    }
+
+    channels.reserve(channels.size() + count);
+    for (auto& [nodeId, degree] : nodeDegrees) {
+        auto& nodeReach = reach.at(nodeId);
+        nodeReach.reserve(nodeReach.size() + degree);
+    }
+
+    std::vector<size_t> channelIds;
+    channelIds.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t channelId = edgeCount();
+        T length = lengths.empty() ? calculateNodeDistance(nodeAIds[i], nodeBIds[i]) : lengths[i];
+        ChannelType type = types.empty() ? ChannelType::NORMAL : types[i];
+        addRectangularChannel(nodeAIds[i], nodeBIds[i], heights[i], widths[i], length, type, channelId);
+        channelIds.push_back(channelId);
+    }
+
+    return channelIds;
+}
+
 template<typename T>
 std::shared_ptr<RectangularChannel<T>> Network<T>::getRectangularChannel(size_t channelId) const {
     if (channels.at(channelId)->isRectangular()) {
@@ -328,6 +503,7 @@ void Network<T>::removeChannel(const std::shared_ptr<Channel<T>>& channel) {
 
         // remove channel from channels map
         channels.erase(channelId);
+        indicesOutdated = true;
     } else {
         throw std::logic_error("Network does not contain channel " + std::to_string(channelId) + ".");
     }
@@ -335,12 +511,17 @@ void Network<T>::removeChannel(const std::shared_ptr<Channel<T>>& channel) {
 
 template<typename T>
 std::shared_ptr<FlowRatePump<T>> Network<T>::addFlowRatePump(size_t nodeAId, size_t nodeBId, T flowRate) {
+    return addFlowRatePump(nodeAId, nodeBId, flowRate, edgeCount());
+}
+
+template<typename T>
+std::shared_ptr<FlowRatePump<T>> Network<T>::addFlowRatePump(size_t nodeAId, size_t nodeBId, T flowRate, size_t id) {
     // create pump
-    auto id = edgeCount();
     auto addPump = std::shared_ptr<FlowRatePump<T>>(new FlowRatePump<T>(id, nodeAId, nodeBId, flowRate));
 
     // add pump
     auto [it, is_inserted] = flowRatePumps.try_emplace(id, addPump);
+    indicesOutdated = true;
     assert(is_inserted);
 
     return addPump;
@@ -354,6 +535,7 @@ void Network<T>::setFlowRatePump(size_t channelId_, T flowRate_) {
     auto [it, is_inserted] = flowRatePumps.try_emplace(channelId_, std::move(newPump));
     assert(is_inserted);
     channels.erase(channelId_);
+    indicesOutdated = true;
     reach.at(nodeAId).erase(channelId_);
     reach.at(nodeBId).erase(channelId_);
 }
@@ -364,6 +546,7 @@ void Network<T>::removeFlowRatePump(const std::shared_ptr<FlowRatePump<T>>& pump
     if (flowRatePumps.find(pumpId) != flowRatePumps.end()) {
         // remove pump from flow rate pumps map
         flowRatePumps.erase(pumpId);
+        indicesOutdated = true;
     } else {
         throw std::logic_error("Network does not contain flow rate pump " + std::to_string(pumpId) + ".");
     }
@@ -371,12 +554,17 @@ void Network<T>::removeFlowRatePump(const std::shared_ptr<FlowRatePump<T>>& pump
 
 template<typename T>
 std::shared_ptr<PressurePump<T>> Network<T>::addPressurePump(size_t nodeAId, size_t nodeBId, T pressure) {
+    return addPressurePump(nodeAId, nodeBId, pressure, edgeCount());
+}
+
+template<typename T>
+std::shared_ptr<PressurePump<T>> Network<T>::addPressurePump(size_t nodeAId, size_t nodeBId, T pressure, size_t id) {
     // create pump
-    auto id = edgeCount();
     auto addPump = std::shared_ptr<PressurePump<T>>(new PressurePump<T>(id, nodeAId, nodeBId, pressure));
 
     // add pump
     auto [it, is_inserted] = pressurePumps.try_emplace(id, addPump);
+    indicesOutdated = true;
     assert(is_inserted);
 
     return addPump;
@@ -390,6 +578,7 @@ void Network<T>::setPressurePump(size_t channelId_, T pressure_) {
     auto [it, is_inserted] = pressurePumps.try_emplace(channelId_, std::move(newPump));
     assert(is_inserted);
     channels.erase(channelId_);
+    indicesOutdated = true;
     reach.at(nodeAId).erase(channelId_);
     reach.at(nodeBId).erase(channelId_);
 }
@@ -400,6 +589,7 @@ void Network<T>::removePressurePump(const std::shared_ptr<PressurePump<T>>& pump
     if (pressurePumps.find(pumpId) != pressurePumps.end()) {
         // remove pump from pressure pumps map
         pressurePumps.erase(pumpId);
+        indicesOutdated = true;
     } else {
         throw std::logic_error("Network does not contain pressure pump " + std::to_string(pumpId) + ".");
     }
@@ -410,9 +600,18 @@ std::shared_ptr<CfdModule<T>> Network<T>::addCfdModule(std::vector<T> position,
                                                     std::vector<T> size,
                                                     std::string stlFile,
                                                     std::unordered_map<size_t, Opening<T>> openings) 
+{
+    return addCfdModule(std::move(position), std::move(size), std::move(stlFile), std::move(openings), modules.size());
+}
+
+template<typename T>
+std::shared_ptr<CfdModule<T>> Network<T>::addCfdModule(std::vector<T> position,
+                                                    std::vector<T> size,
+                                                    std::string stlFile,
+                                                    std::unordered_map<size_t, Opening<T>> openings,
+                                                    size_t id) 
 {
     // create module
-    auto id = modules.size();
     auto addModule = std::shared_ptr<CfdModule<T>>(new CfdModule<T>(id, position, size, stlFile, openings));
 
     // add this module to the reach of each node
@@ -445,8 +644,12 @@ void Network<T>::removeModule(const std::shared_ptr<Module<T>>& module_) {
 
 template<typename T>
 std::shared_ptr<Membrane<T>> Network<T>::addMembraneToChannel(size_t channelId, T height, T width, T poreRadius, T porosity) {
+    return addMembraneToChannel(channelId, height, width, poreRadius, porosity, edgeCount());
+}
+
+template<typename T>
+std::shared_ptr<Membrane<T>> Network<T>::addMembraneToChannel(size_t channelId, T height, T width, T poreRadius, T porosity, size_t id) {
     auto channel = getChannel(channelId);
-    auto id = edgeCount();
     auto nodeA = this->getNode(channel->getNodeAId());
     auto nodeB = this->getNode(channel->getNodeBId());
     auto membrane = std::shared_ptr<Membrane<T>>(new Membrane<T>(id, nodeA, nodeB, height,
@@ -492,8 +695,12 @@ std::vector<std::shared_ptr<Membrane<T>>> Network<T>::getMembranesAtNode(size_t
 
 template<typename T>
 std::shared_ptr<Tank<T>> Network<T>::addTankToMembrane(size_t membraneId, T height, T width) {
+    return addTankToMembrane(membraneId, height, width, edgeCount());
+}
+
+template<typename T>
+std::shared_ptr<Tank<T>> Network<T>::addTankToMembrane(size_t membraneId, T height, T width, size_t id) {
     auto membrane = getMembrane(membraneId);
-    auto id = edgeCount();
     auto nodeA = this->getNode(membrane->getNodeAId());
     auto nodeB = this->getNode(membrane->getNodeBId());
     auto tank = std::shared_ptr<Tank<T>>(new Tank<T>(id, nodeA, nodeB, height, 
@@ -0,0 +1,171 @@
+/**
+ * @file NetworkGenerator.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arch {
+
+// Forward declared dependencies
+template<typename T>
+class FlowRatePump;
+template<typename T>
+class Network;
+
+/**
+ * @brief A generated network, together with the in- and outlets that are needed to drive a simulation on it.
+*/
+template<typename T>
+struct GeneratedNetwork {
+    std::shared_ptr<Network<T>> network;                        ///< The generated network.
+    std::vector<size_t> inlets;                                 ///< Ids of the nodes at which the flow enters the network.
+    size_t outlet = 0;                                          ///< Id of the ground and sink node at which the flow leaves the network.
+    std::vector<size_t> inletChannels;                          ///< Ids of the first channel at each inlet, e.g., for injections.
+    std::vector<std::shared_ptr<FlowRatePump<T>>> pumps;        ///< Flow rate pumps from the outlet to each inlet.
+};
+
+/**
+ * @brief Class that generates valid networks of parametric topology and size, e.g., to measure how the simulation
+ * scales with the network size. Each generated network has a single ground and sink node at its outlet, and each
+ * inlet is fed by a flow rate pump from the outlet. Random topologies are reproducible for a given seed.
+*/
+template<typename T>
+class NetworkGenerator {
+private:
+    /**
+     * @brief The nodes and channels of a network before it is built.
+    */
+    struct Blueprint {
+        std::vector<T> xs;
+        std::vector<T> ys;
+        std::vector<size_t> nodeAIds;
+        std::vector<size_t> nodeBIds;
+        std::vector<T> lengths;
+        std::vector<size_t> inlets;
+        size_t outlet = 0;
+
+        size_t addNode(T x, T y);
+        void addChannel(size_t nodeAId, size_t nodeBId, T length);
+        void addStraightChannel(size_t nodeAId, size_t nodeBId);
+    };
+
+    std::mt19937_64 randomGenerator;    ///< Random number generator for random topologies.
+    T spacing = 1e-3;                   ///< Distance between neighboring nodes in m.
+    T width = 100e-6;                   ///< Width of the generated channels in m.
+    T height = 30e-6;                   ///< Height of the generated channels in m.
+    T flowRate = 1e-11;                 ///< Flow rate of each inlet pump in m^3/s.
+
+    /**
+     * @brief Builds the network of a blueprint and places the ground node, the sink and the pumps.
+     * @param[in] blueprint The blueprint of the network.
+     * @returns The generated network.
+    */
+    [[nodiscard]] GeneratedNetwork<T> build(const Blueprint& blueprint) const;
+
+    /**
+     * @brief Draws a uniformly distributed number in [0, 1). Unlike the standard distributions, the draws only depend
+     * on std::mt19937_64, so a seed generates the same topology with every standard library.
+     * @returns The random number.
+    */
+    [[nodiscard]] T drawUniform();
+
+    /**
+     * @brief Draws a uniformly distributed integer in [0, count), without modulo bias.
+     * @param[in] count Number of possible values.
+     * @returns The random integer.
+    */
+    [[nodiscard]] size_t drawIndex(size_t count);
+
+    /**
+     * @brief Shuffles the elements of a vector with the Fisher-Yates algorithm and drawIndex().
+     * @param[in,out] elements The elements to shuffle.
+    */
+    template<typename E>
+    void shuffle(std::vector<E>& elements);
+
+public:
+    /**
+     * @brief Constructor of the network generator.
+     * @param[in] seed Seed for random topologies.
+    */
+    explicit NetworkGenerator(uint64_t seed = 0);
+
+    /**
+     * @brief Reseeds the generator for random topologies.
+     * @param[in] seed The seed.
+    */
+    void setSeed(uint64_t seed);
+
+    /**
+     * @brief Sets the distance between neighboring nodes.
+     * @param[in] spacing Distance in m.
+    */
+    void setSpacing(T spacing);
+
+    /**
+     * @brief Sets the cross-section of the generated channels.
+     * @param[in] width Width of the channels in m.
+     * @param[in] height Height of the channels in m.
+    */
+    void setChannelDimensions(T width, T height);
+
+    /**
+     * @brief Sets the flow rate of the pump at each inlet.
+     * @param[in] flowRate Flow rate in m^3/s.
+    */
+    void setFlowRate(T flowRate);
+
+    [[nodiscard]] inline T getSpacing() const { return spacing; }
+    [[nodiscard]] inline T getChannelWidth() const { return width; }
+    [[nodiscard]] inline T getChannelHeight() const { return height; }
+    [[nodiscard]] inline T getFlowRate() const { return flowRate; }
+
+    /**
+     * @brief Generates a rectangular grid with the inlet and outlet at opposite corners.
+     * @param[in] nx Number of nodes in x-direction.
+     * @param[in] ny Number of nodes in y-direction.
+     * @returns The generated network with nx*ny nodes.
+    */
+    [[nodiscard]] GeneratedNetwork<T> grid(size_t nx, size_t ny);
+
+    /**
+     * @brief Generates a binary bifurcation tree that is mirrored into a binary merging tree.
+     * @param[in] depth Number of bifurcation levels.
+     * @returns The generated network with 3*2^depth - 2 nodes.
+    */
+    [[nodiscard]] GeneratedNetwork<T> binaryTree(size_t depth);
+
+    /**
+     * @brief Generates a cascade of a gradient generator ("christmas tree") with two inlets. Each stage adds one
+     * node, which is connected to its upstream neighbors by meandering mixing channels.
+     * @param[in] stages Number of mixing stages.
+     * @param[in] meanderLength Length of the mixing channels in m.
+     * @returns The generated network.
+    */
+    [[nodiscard]] GeneratedNetwork<T> gradientGenerator(size_t stages, T meanderLength);
+
+    /**
+     * @brief Generates a ladder of two straight rails that are connected by serpentine rungs.
+     * @param[in] rungs Number of rungs.
+     * @param[in] serpentineLength Length of the serpentine rungs in m.
+     * @returns The generated network with 2*rungs nodes.
+    */
+    [[nodiscard]] GeneratedNetwork<T> serpentineLadder(size_t rungs, T serpentineLength);
+
+    /**
+     * @brief Generates a random connected planar graph on a jittered grid. The graph contains a random spanning tree
+     * of the grid edges and cell diagonals, and each further edge with the given probability.
+     * @param[in] nx Number of nodes in x-direction.
+     * @param[in] ny Number of nodes in y-direction.
+     * @param[in] edgeProbability Probability of each edge that is not in the spanning tree.
+     * @returns The generated network with nx*ny nodes.
+    */
+    [[nodiscard]] GeneratedNetwork<T> randomPlanar(size_t nx, size_t ny, T edgeProbability);
+};
+
+}   // namespace arch
@@ -0,0 +1,275 @@
+#include "NetworkGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace arch {
+
+template<typename T>
+size_t NetworkGenerator<T>::Blueprint::addNode(T x, T y) {
+    xs.push_back(x);
+    ys.push_back(y);
+    return xs.size() - 1;
+}
+
+template<typename T>
+void NetworkGenerator<T>::Blueprint::addChannel(size_t nodeAId, size_t nodeBId, T length) {
+    nodeAIds.push_back(nodeAId);
+    nodeBIds.push_back(nodeBId);
+    lengths.push_back(length);
+}
+
+template<typename T>
+void NetworkGenerator<T>::Blueprint::addStraightChannel(size_t nodeAId, size_t nodeBId) {
+    T dx = xs[nodeAId] - xs[nodeBId];
+    T dy = ys[nodeAId] - ys[nodeBId];
+    addChannel(nodeAId, nodeBId, std::sqrt(dx*dx + dy*dy));
+}
+
+template<typename T>
+NetworkGenerator<T>::NetworkGenerator(uint64_t seed) : randomGenerator(seed) { }
+
+template<typename T>
+void NetworkGenerator<T>::setSeed(uint64_t seed) {
+    randomGenerator.seed(seed);
+}
+
+template<typename T>
+T NetworkGenerator<T>::drawUniform() {
+    // The 53 most significant bits fill the mantissa of a double
+    return static_cast<T>(static_cast<double>(randomGenerator() >> 11) * 0x1.0p-53);
+}
+
+template<typename T>
+size_t NetworkGenerator<T>::drawIndex(size_t count) {
+    // Reject the draws above the largest multiple of count
+    const uint64_t limit = std::numeric_limits<uint64_t>::max() - std::numeric_limits<uint64_t>::max() % count;
+    uint64_t draw = randomGenerator();
+    while (draw >= limit) {
+        draw = randomGenerator();
+    }
+    return static_cast<size_t>(draw % count);
+}
+
+template<typename T>
+template<typename E>
+void NetworkGenerator<T>::shuffle(std::vector<E>& elements) {
+    for (size_t i = elements.size(); i > 1; --i) {
+        std::swap(elements[i - 1], elements[drawIndex(i)]);
+    }
+}
+
+template<typename T>
+void NetworkGenerator<T>::setSpacing(T spacing_) {
+    if (spacing_ <= 0.0) {
+        throw std::invalid_argument("The spacing of a generated network must be positive.");
+    }
+    spacing = spacing_;
+}
+
+template<typename T>
+void NetworkGenerator<T>::setChannelDimensions(T width_, T height_) {
+    if (width_ <= 0.0 || height_ <= 0.0) {
+        throw std::invalid_argument("The channel dimensions of a generated network must be positive.");
+    }
+    width = width_;
+    height = height_;
+}
+
+template<typename T>
+void NetworkGenerator<T>::setFlowRate(T flowRate_) {
+    flowRate = flowRate_;
+}
+
+template<typename T>
+GeneratedNetwork<T> NetworkGenerator<T>::build(const Blueprint& blueprint) const {
+    GeneratedNetwork<T> generated;
+    generated.network = Network<T>::createNetwork();
+    generated.inlets = blueprint.inlets;
+    generated.outlet = blueprint.outlet;
+
+    std::vector<bool> ground(blueprint.xs.size(), false);
+    ground[blueprint.outlet] = true;
+    generated.network->addNodes(blueprint.xs, blueprint.ys, ground);
+    auto channelIds = generated.network->addRectangularChannels(blueprint.nodeAIds, blueprint.nodeBIds,
+                                                                std::vector<T>(blueprint.nodeAIds.size(), height),
+                                                                std::vector<T>(blueprint.nodeAIds.size(), width),
+                                                                blueprint.lengths);
+    generated.network->setSink(blueprint.outlet);
+
+    for (size_t inlet : blueprint.inlets) {
+        for (size_t i = 0; i < channelIds.size(); ++i) {
+            if (blueprint.nodeAIds[i] == inlet || blueprint.nodeBIds[i] == inlet) {
+                generated.inletChannels.push_back(channelIds[i]);
+                break;
+            }
+        }
+        generated.pumps.push_back(generated.network->addFlowRatePump(blueprint.outlet, inlet, flowRate));
+    }
+
+    return generated;
+}
+
+template<typename T>
+GeneratedNetwork<T> NetworkGenerator<T>::grid(size_t nx, size_t ny) {
+    if (nx < 1 || ny < 1 || nx*ny < 2) {
+        throw std::invalid_argument("A generated grid requires at least two nodes.");
+    }
+    Blueprint blueprint;
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            size_t nodeId = blueprint.addNode(spacing*i, spacing*j);
+            if (j > 0) { blueprint.addStraightChannel(nodeId - 1, nodeId); }
+            if (i > 0) { blueprint.addStraightChannel(nodeId - ny, nodeId); }
+        }
+    }
+    blueprint.inlets = { 0 };
+    blueprint.outlet = nx*ny - 1;
+    return build(blueprint);
+}
+
+template<typename T>
+GeneratedNetwork<T> NetworkGenerator<T>::binaryTree(size_t depth) {
+    if (depth < 1) {
+        throw std::invalid_argument("A generated binary tree requires at least one bifurcation level.");
+    }
+    Blueprint blueprint;
+    size_t leaves = size_t(1) << depth;
+    // Bifurcation tree, level by level, the leaves are shared with the merging tree
+    for (size_t level = 0; level <= depth; ++level) {
+        size_t levelWidth = size_t(1) << level;
+        for (size_t k = 0; k < levelWidth; ++k) {
+            size_t nodeId = blueprint.addNode(spacing*level, spacing*(k + 0.5)*leaves/levelWidth);
+            if (level > 0) { blueprint.addStraightChannel(levelWidth/2 - 1 + k/2, nodeId); }
+        }
+    }
+    // Merging tree, from the leaves towards the outlet
+    size_t previous = leaves - 1;
+    for (size_t level = depth; level-- > 0;) {
+        size_t levelWidth = size_t(1) << level;
+        size_t first = blueprint.xs.size();
+        for (size_t k = 0; k < levelWidth; ++k) {
+            size_t nodeId = blueprint.addNode(spacing*(2*depth - level), spacing*(k + 0.5)*leaves/levelWidth);
+            blueprint.addStraightChannel(previous + 2*k, nodeId);
+            blueprint.addStraightChannel(previous + 2*k + 1, nodeId);
+        }
+        previous = first;
+    }
+    blueprint.inlets = { 0 };
+    blueprint.outlet = blueprint.xs.size() - 1;
+    return build(blueprint);
+}
+
+template<typename T>
+GeneratedNetwork<T> NetworkGenerator<T>::gradientGenerator(size_t stages, T meanderLength) {
+    if (stages < 1 || meanderLength <= 0.0) {
+        throw std::invalid_argument("A generated gradient generator requires at least one stage and a positive meander length.");
+    }
+    Blueprint blueprint;
+    // Two inlets, each stage has one node more than the previous stage
+    std::vector<size_t> previous = { blueprint.addNode(0.0, -0.5*spacing), blueprint.addNode(0.0, 0.5*spacing) };
+    for (size_t stage = 1; stage <= stages; ++stage) {
+        std::vector<size_t> current;
+        for (size_t k = 0; k < previous.size() + 1; ++k) {
+            current.push_back(blueprint.addNode(spacing*stage, spacing*(k - 0.5*previous.size())));
+        }
+        for (size_t k = 0; k < previous.size(); ++k) {
+            blueprint.addChannel(previous[k], current[k], meanderLength);
+            blueprint.addChannel(previous[k], current[k+1], meanderLength);
+        }
+        previous = std::move(current);
+    }
+    // All outlets of the last stage are collected at the outlet
+    size_t outlet = blueprint.addNode(spacing*(stages + 1), 0.0);
+    for (size_t nodeId : previous) {
+        blueprint.addStraightChannel(nodeId, outlet);
+    }
+    blueprint.inlets = { 0, 1 };
+    blueprint.outlet = outlet;
+    return build(blueprint);
+}
+
+template<typename T>
+GeneratedNetwork<T> NetworkGenerator<T>::serpentineLadder(size_t rungs, T serpentineLength) {
+    if (rungs < 1 || serpentineLength <= 0.0) {
+        throw std::invalid_argument("A generated serpentine ladder requires at least one rung and a positive serpentine length.");
+    }
+    Blueprint blueprint;
+    for (size_t i = 0; i < rungs; ++i) {
+        size_t lower = blueprint.addNode(spacing*i, 0.0);
+        size_t upper = blueprint.addNode(spacing*i, spacing);
+        blueprint.addChannel(lower, upper, serpentineLength);
+        if (i > 0) {
+            blueprint.addStraightChannel(lower - 2, lower);
+            blueprint.addStraightChannel(upper - 2, upper);
+        }
+    }
+    blueprint.inlets = { 0 };
+    blueprint.outlet = 2*rungs - 1;
+    return build(blueprint);
+}
+
+template<typename T>
+GeneratedNetwork<T> NetworkGenerator<T>::randomPlanar(size_t nx, size_t ny, T edgeProbability) {
+    if (nx < 2 || ny < 2) {
+        throw std::invalid_argument("A generated random planar graph requires at least 2x2 nodes.");
+    }
+    if (edgeProbability < 0.0 || edgeProbability > 1.0) {
+        throw std::invalid_argument("The edge probability of a generated random planar graph must be in [0, 1].");
+    }
+    Blueprint blueprint;
+    // Jitter of at most 0.2*spacing keeps every grid cell convex, hence, grid edges and one diagonal per cell never cross
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            T jitterX = (0.4*drawUniform() - 0.2)*spacing;
+            T jitterY = (0.4*drawUniform() - 0.2)*spacing;
+            blueprint.addNode(spacing*i + jitterX, spacing*j + jitterY);
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> candidates;
+    for (size_t i = 0; i < nx; ++i) {
+        for (size_t j = 0; j < ny; ++j) {
+            size_t nodeId = i*ny + j;
+            if (j > 0) { candidates.emplace_back(nodeId - 1, nodeId); }
+            if (i > 0) { candidates.emplace_back(nodeId - ny, nodeId); }
+            if (i > 0 && j > 0) {
+                if (drawUniform() < 0.5) {
+                    candidates.emplace_back(nodeId - ny - 1, nodeId);
+                } else {
+                    candidates.emplace_back(nodeId - ny, nodeId - 1);
+                }
+            }
+        }
+    }
+    shuffle(candidates);
+
+    // Random spanning tree (Kruskal) keeps the graph connected, the remaining edges are added randomly
+    std::vector<size_t> parent(blueprint.xs.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](size_t nodeId) {
+        while (parent[nodeId] != nodeId) {
+            parent[nodeId] = parent[parent[nodeId]];
+            nodeId = parent[nodeId];
+        }
+        return nodeId;
+    };
+    for (auto& [nodeAId, nodeBId] : candidates) {
+        size_t rootA = find(nodeAId);
+        size_t rootB = find(nodeBId);
+        if (rootA != rootB) {
+            parent[rootA] = rootB;
+            blueprint.addStraightChannel(nodeAId, nodeBId);
+        } else if (drawUniform() < edgeProbability) {
+            blueprint.addStraightChannel(nodeAId, nodeBId);
+        }
+    }
+    blueprint.inlets = { 0 };
+    blueprint.outlet = nx*ny - 1;
+    return build(blueprint);
+}
+
+}   // namespace arch
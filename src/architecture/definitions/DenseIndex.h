@@ -0,0 +1,112 @@
+/**
+ * @file DenseIndex.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace arch {
+
+/**
+ * @brief Maps a set of sparse ids to the contiguous indices 0, ..., n-1, in ascending order of the ids. Values that
+ * belong to the ids can then be stored in flat vectors. When the ids are compact, an id is looked up in a direct
+ * address table, otherwise by a binary search over the sorted ids. No hashing is involved in either case. The network
+ * still stores its nodes and edges by id, the index provides their positions, e.g., the rows of the nodal analysis.
+*/
+class DenseIndex {
+private:
+    std::vector<size_t> sortedIds;      ///< The ids in ascending order, i.e., the id of each index.
+    std::vector<size_t> slots;          ///< Index of each id in [0, maxId], or npos. Empty if the ids are not compact.
+
+public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();  ///< Index of ids that are not contained.
+
+    /**
+     * @brief Constructor of an empty index.
+    */
+    DenseIndex() = default;
+
+    /**
+     * @brief Constructor of an index over the given ids.
+     * @param[in] ids The ids, in arbitrary order and without duplicates.
+    */
+    explicit DenseIndex(std::vector<size_t> ids) { assign(std::move(ids)); }
+
+    /**
+     * @brief Replace the ids of the index. The indices of all ids are recomputed.
+     * @param[in] ids The ids, in arbitrary order and without duplicates.
+    */
+    inline void assign(std::vector<size_t> ids) {
+        sortedIds = std::move(ids);
+        std::sort(sortedIds.begin(), sortedIds.end());
+        slots.clear();
+        // A direct address table is used as long as it is at most a few times larger than the number of ids
+        if (!sortedIds.empty() && sortedIds.back() < 4 * sortedIds.size() + 64) {
+            slots.assign(sortedIds.back() + 1, npos);
+            for (size_t i = 0; i < sortedIds.size(); ++i) {
+                slots[sortedIds[i]] = i;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of ids in the index.
+     * @returns Number of ids.
+    */
+    [[nodiscard]] inline size_t size() const { return sortedIds.size(); }
+
+    /**
+     * @brief Get the index of an id.
+     * @param[in] id The id.
+     * @returns The index of the id, or npos if the id is not contained.
+    */
+    [[nodiscard]] inline size_t find(size_t id) const {
+        if (!slots.empty()) {
+            return id < slots.size() ? slots[id] : npos;
+        }
+        auto it = std::lower_bound(sortedIds.begin(), sortedIds.end(), id);
+        return (it != sortedIds.end() && *it == id) ? size_t(it - sortedIds.begin()) : npos;
+    }
+
+    /**
+     * @brief Get the index of an id.
+     * @param[in] id The id.
+     * @returns The index of the id.
+     * @throws out_of_range if the id is not contained.
+    */
+    [[nodiscard]] inline size_t index(size_t id) const {
+        size_t i = find(id);
+        if (i == npos) {
+            throw std::out_of_range("Id " + std::to_string(id) + " is not contained in the index.");
+        }
+        return i;
+    }
+
+    /**
+     * @brief Check whether an id is contained in the index.
+     * @param[in] id The id.
+     * @returns Whether the id is contained.
+    */
+    [[nodiscard]] inline bool contains(size_t id) const { return find(id) != npos; }
+
+    /**
+     * @brief Get the id at an index.
+     * @param[in] index The index.
+     * @returns The id.
+    */
+    [[nodiscard]] inline size_t id(size_t index) const { return sortedIds[index]; }
+
+    /**
+     * @brief Get all ids in ascending order, i.e., the id of each index.
+     * @returns Read-only reference to the sorted ids.
+    */
+    [[nodiscard]] inline const std::vector<size_t>& ids() const { return sortedIds; }
+};
+
+}   // namespace arch
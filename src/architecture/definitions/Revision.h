@@ -0,0 +1,34 @@
+/**
+ * @file Revision.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace arch {
+
+/**
+ * @brief Global revision counter of the network quantities. Nodes and edges store the revision at which their values
+ * last changed, which allows a reader to collect only the values that changed since it last read the network.
+ * @return Reference to the counter.
+ */
+inline std::atomic<size_t>& revisionCounter() {
+    static std::atomic<size_t> counter { 0 };
+    return counter;
+}
+
+/**
+ * @brief Draws a new revision, which is larger than all revisions that were drawn before.
+ * @return The new revision.
+ */
+inline size_t nextRevision() { return ++revisionCounter(); }
+
+/**
+ * @brief Get the latest revision that was drawn. Values that change afterwards have a larger revision.
+ * @return The latest revision.
+ */
+inline size_t currentRevision() { return revisionCounter().load(); }
+
+}   // namespace arch
@@ -150,25 +150,45 @@ protected:
      * @brief Set the pressure difference over a channel.
      * @param[in] Pressure in Pa.
      */
-    inline void setPressure(T pressure) { this->pressure = pressure; }
+    inline void setPressure(T pressure) {
+        if (pressure != this->pressure) {
+            this->pressure = pressure;
+            this->markChanged();
+        }
+    }
 
     /**
      * @brief Set resistance of a channel without droplets.
      * @param[in] channelResistance Resistance of a channel without droplets in Pas/L.
      */
-    void setResistance(T channelResistance) { this->channelResistance = channelResistance; }
+    void setResistance(T channelResistance) {
+        if (channelResistance != this->channelResistance) {
+            this->channelResistance = channelResistance;
+            this->markChanged();
+        }
+    }
 
     /**
      * @brief Set resistance caused by droplets within channel.
      * @param[in] dropletResistance Resistance caused by droplets within channel in Pas/L.
      */
-    inline void setDropletResistance(T dropletResistance) { this->dropletResistance = dropletResistance; }
+    inline void setDropletResistance(T dropletResistance) {
+        if (dropletResistance != this->dropletResistance) {
+            this->dropletResistance = dropletResistance;
+            this->markChanged();
+        }
+    }
 
     /**
      * @brief Add resistance caused by a droplet to droplet resistance of channel that is caused by all droplets currently in the channel.
      * @param[in] dropletResistance Resistance caused by a droplet in Pas/L.
      */
-    inline void addDropletResistance(T dropletResistance) { this->dropletResistance += dropletResistance; }
+    inline void addDropletResistance(T dropletResistance) {
+        if (dropletResistance != 0) {
+            this->dropletResistance += dropletResistance;
+            this->markChanged();
+        }
+    }
 
 public:
     /**
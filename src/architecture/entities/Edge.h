@@ -6,6 +6,8 @@
 
 #include <vector>
 
+#include "../definitions/Revision.h"
+
 namespace arch {
 
 // Forward declared dependencies
@@ -21,6 +23,7 @@ private:
   const size_t id;          ///< Id of the edge.
   size_t nodeA;             ///< Node at one end of the edge.
   size_t nodeB;             ///< Node at other end of the edge.
+  size_t revision = nextRevision();   ///< Revision at which the flow rate of the edge last changed.
 
 protected:
   /**
@@ -31,6 +34,11 @@ protected:
    */
   Edge(size_t id, size_t nodeA, size_t nodeB);
 
+  /**
+   * @brief Records that the flow rate of the edge changed, by assigning a new revision to the edge.
+   */
+  inline void markChanged() { revision = nextRevision(); }
+
 public:
 
   virtual ~Edge() = default;
@@ -77,6 +85,12 @@ public:
    */
   virtual T getResistance() const = 0;
 
+  /**
+   * @brief Get the revision at which the flow rate of the edge last changed (see arch::nextRevision).
+   * @return Revision of the flow rate.
+   */
+  [[nodiscard]] inline size_t getRevision() const { return revision; }
+
 };
 
 }  // namespace arch
\ No newline at end of file
@@ -51,7 +51,12 @@ public:
      * @brief Set volumetric flow rate of the pump.
      * @param[in] flowRate New volumetric flow rate to set in m^3/s.
      */
-    inline void setFlowRate(T flowRate) { this->flowRate = flowRate; }
+    inline void setFlowRate(T flowRate) {
+        if (flowRate != this->flowRate) {
+            this->flowRate = flowRate;
+            this->markChanged();
+        }
+    }
 
     /**
      * @brief Get pressure of the pump.
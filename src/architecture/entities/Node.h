@@ -6,6 +6,8 @@
 
 #include <vector>
 
+#include "../definitions/Revision.h"
+
 namespace nodal {
 
 // Forward declared dependencies
@@ -28,6 +30,7 @@ private:
     const size_t id;
     std::vector<T> pos;
     T pressure = 0;
+    size_t revision = nextRevision();   ///< Revision at which the pressure last changed.
     bool ground = false;
     bool sink = false;
 
@@ -45,7 +48,12 @@ private:
      * @brief Set pressure level at the node.
      * @param[in] pressure Pressure level at the node in Pa.
      */
-    inline void setPressure(T pressure) { this->pressure = pressure; }
+    inline void setPressure(T pressure) {
+        if (pressure != this->pressure) {
+            this->pressure = pressure;
+            revision = nextRevision();
+        }
+    }
 
 public:
     /**
@@ -72,6 +80,12 @@ public:
      */
     [[nodiscard]] inline T getPressure() const { return pressure; }
 
+    /**
+     * @brief Get the revision at which the pressure of the node last changed (see arch::nextRevision).
+     * @return Revision of the pressure.
+     */
+    [[nodiscard]] inline size_t getRevision() const { return revision; }
+
     /**
      * @brief Set the sink role to the node.
      * @param[in] sink Boolean value for sink role.
@@ -43,7 +43,12 @@ private:
    * @brief Set flow rate of the pump.
    * @param[in] flowRate Flow rate of pump in m^3/s.
    */
-  inline void setFlowRate(T flowRate) { this->flowRate = flowRate; }
+  inline void setFlowRate(T flowRate) {
+    if (flowRate != this->flowRate) {
+      this->flowRate = flowRate;
+      this->markChanged();
+    }
+  }
 
 public:
   /**
@@ -3,6 +3,8 @@
  */
 #pragma once
 
+#include "logging/Logger.h"
+
 #include "simulation/entities/Droplet.h"
 #include "simulation/entities/Fluid.h"
 #include "simulation/entities/Mixture.h"
@@ -32,9 +34,11 @@
 #include "simulation/simulators/HybridConcentration.h"
 #include "simulation/simulators/CfdContinuous.h"
 #include "simulation/simulators/CfdConcentration.h"
+#include "simulation/simulators/SimulationPool.h"
 
 #include "simulation/simulators/CFDSim.h"
 #include "simulation/simulators/cfdHandlers/cfdSimulator.h"
+#include "simulation/simulators/cfdHandlers/geometryCache.h"
 #include "simulation/simulators/cfdHandlers/olbContinuous.h"
 #include "simulation/simulators/cfdHandlers/olbMixing.h"
 // #include "simulation/simulators/cfdHandlers/olbOoc.h"    //** TODO: HybridOocSimulation */
@@ -43,9 +47,12 @@
 
 #include "hybridDynamics/Scheme.h"
 #include "hybridDynamics/Naive.h"
+#include "hybridDynamics/Adaptive.h"
 
 #include "architecture/definitions/ChannelPosition.h"
+#include "architecture/definitions/DenseIndex.h"
 #include "architecture/definitions/ModuleOpening.h"
+#include "architecture/definitions/Revision.h"
 
 #include "architecture/entities/Channel.h"
 #include "architecture/entities/Edge.h"
@@ -57,15 +64,20 @@
 #include "architecture/entities/Tank.h"
 
 #include "architecture/Network.h"
+#include "architecture/NetworkGenerator.h"
 
 #include "olbProcessors/navierStokesAdvectionDiffusionCouplingPostProcessor2D.h"
 #include "olbProcessors/saturatedFluxPostProcessor2D.h"
 #include "olbProcessors/setFunctionalRegularizedHeatFlux.h"
 
+#include "porting/binaryStreams.h"
+#include "porting/binaryPorter.h"
 #include "porting/jsonPorter.h"
 #include "porting/jsonReaders.h"
 #include "porting/jsonWriters.h"
+#include "porting/batchRunner.h"
 
+#include "result/Profiler.h"
 #include "result/Results.h"
 
 #include <architecture/pNetwork.h>
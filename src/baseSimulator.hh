@@ -1,3 +1,5 @@
+#include "logging/Logger.hh"
+
 #include "simulation/entities/Droplet.hh"
 #include "simulation/entities/Fluid.hh"
 #include "simulation/entities/Mixture.hh"
@@ -26,9 +28,11 @@
 #include "simulation/simulators/HybridConcentration.hh"
 #include "simulation/simulators/CfdContinuous.hh"
 #include "simulation/simulators/CfdConcentration.hh"
+#include "simulation/simulators/SimulationPool.hh"
 
 #include "simulation/simulators/CFDSim.hh"
 #include "simulation/simulators/cfdHandlers/cfdSimulator.hh"
+#include "simulation/simulators/cfdHandlers/geometryCache.hh"
 #include "simulation/simulators/cfdHandlers/olbContinuous.hh"
 #include "simulation/simulators/cfdHandlers/olbMixing.hh"
 // #include "simulation/simulators/cfdHandlers/olbOoc.hh"    //** TODO: HybridOocSimulation */
@@ -38,6 +42,7 @@
 
 #include "hybridDynamics/Scheme.hh"
 #include "hybridDynamics/Naive.hh"
+#include "hybridDynamics/Adaptive.hh"
 
 #include "architecture/definitions/ChannelPosition.hh"
 
@@ -51,15 +56,20 @@
 #include "architecture/entities/Tank.hh"
 
 #include "architecture/Network.hh"
+#include "architecture/NetworkGenerator.hh"
 
 #include "olbProcessors/navierStokesAdvectionDiffusionCouplingPostProcessor2D.hh"
 #include "olbProcessors/saturatedFluxPostProcessor2D.hh"
 #include "olbProcessors/setFunctionalRegularizedHeatFlux.hh"
 
+#include "porting/binaryStreams.hh"
+#include "porting/binaryPorter.hh"
 #include "porting/jsonPorter.hh"
 #include "porting/jsonReaders.hh"
 #include "porting/jsonWriters.hh"
+#include "porting/batchRunner.hh"
 
+#include "result/Profiler.hh"
 #include "result/Results.hh"
 
 #include <architecture/pNetwork.hh>
@@ -0,0 +1,149 @@
+/**
+ * @file Adaptive.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace arch {
+
+// Forward declared dependencies
+template<typename T>
+class CfdModule;
+
+}
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class HybridContinuous;
+
+}
+
+namespace mmft{
+
+/**
+ * @brief The Adaptive Scheme is an update scheme with constant relaxation factors, for which the amount of LBM
+ * stream and collide cycles between updates (theta) is adapted after every coupling round. The adaptation is based
+ * on the relative change of the interface values (pressures and flow rates at the openings) between two rounds.
+ * A large change halves theta, a small change doubles theta, always within the bounds [thetaMin, thetaMax].
+ */
+template<typename T>
+class AdaptiveScheme final : public Scheme<T> {
+
+private:
+
+    int thetaMin;                                   // Lower bound for theta
+    int thetaMax;                                   // Upper bound for theta
+    T lowerTolerance = 1e-3;                        // Relative interface change below which theta is increased
+    T upperTolerance = 1e-1;                        // Relative interface change above which theta is decreased
+    bool hasHistory = false;                        // Whether interface values of a previous round are stored
+    std::unordered_map<size_t, T> prevPressures;    // Interface pressures of the previous coupling round <nodeId, pressure>
+    std::unordered_map<size_t, T> prevFlowRates;    // Interface flow rates of the previous coupling round <nodeId, flowRate>
+    std::vector<int> thetaSchedule;                 // The theta that was used in each coupling round
+
+    /**
+     * @brief Constructor of the Adaptive Scheme with provided constants.
+     * @param[in] module The module with boundary nodes upon which this scheme acts.
+     * @param[in] alpha The relaxation value for the pressure value update.
+     * @param[in] beta The relaxation value of the flow rate value update.
+     * @param[in] thetaMin The minimal amount of LBM stream and collide cycles between updates for a module.
+     * @param[in] thetaMax The maximal amount of LBM stream and collide cycles between updates for a module.
+     * @throws invalid_argument if the bounds for theta are ill-defined.
+     */
+    AdaptiveScheme(const std::shared_ptr<arch::CfdModule<T>> module, T alpha, T beta, int thetaMin, int thetaMax);
+
+    /**
+     * @brief Constructor of the Adaptive Scheme with provided constants.
+     * @param[in] module The module with boundary nodes upon which this scheme acts.
+     * @param[in] alpha The relaxation value for the pressure value update. <nodeId, alpha>
+     * @param[in] beta The relaxation value of the flow rate value update. <nodeId, beta>
+     * @param[in] thetaMin The minimal amount of LBM stream and collide cycles between updates for a module.
+     * @param[in] thetaMax The maximal amount of LBM stream and collide cycles between updates for a module.
+     * @throws invalid_argument if the bounds for theta are ill-defined.
+     */
+    AdaptiveScheme(const std::shared_ptr<arch::CfdModule<T>> module, std::unordered_map<int, T> alpha, std::unordered_map<int, T> beta, int thetaMin, int thetaMax);
+
+    /**
+     * @brief Checks the bounds for theta.
+     * @throws invalid_argument if thetaMin < 1 or thetaMax < thetaMin.
+     */
+    void checkBounds() const;
+
+    /**
+     * @brief Returns the largest relative change between the given interface values and those of the previous round.
+     * @param[in] current The current interface values. <nodeId, value>
+     * @param[in] previous The interface values of the previous round. <nodeId, value>
+     * @returns The largest relative change.
+     */
+    T relativeChange(const std::unordered_map<size_t, T>& current, const std::unordered_map<size_t, T>& previous) const;
+
+public:
+
+    /**
+     * @brief Sets the tolerances on the relative interface change that steer the adaptation of theta.
+     * @param[in] lowerTolerance Below this relative change, theta is doubled.
+     * @param[in] upperTolerance Above this relative change, theta is halved.
+     * @throws invalid_argument if the tolerances are not 0 < lowerTolerance < upperTolerance.
+     */
+    void setTolerances(T lowerTolerance, T upperTolerance);
+
+    /**
+     * @brief Returns the lower bound for theta.
+     * @returns thetaMin.
+     */
+    [[nodiscard]] inline int getThetaMin() const { return thetaMin; }
+
+    /**
+     * @brief Returns the upper bound for theta.
+     * @returns thetaMax.
+     */
+    [[nodiscard]] inline int getThetaMax() const { return thetaMax; }
+
+    /**
+     * @brief Records the theta of the coupling round that just finished and adapts theta for the next round
+     * from the change of the interface values.
+     * @param[in] pressures The pressures at the openings after the last coupling round. <nodeId, pressure>
+     * @param[in] flowRates The flow rates at the openings after the last coupling round. <nodeId, flowRate>
+     */
+    void updateTheta(const std::unordered_map<size_t, T>& pressures, const std::unordered_map<size_t, T>& flowRates) override;
+
+    /**
+     * @brief Returns the theta that was used in each coupling round so far.
+     * @returns The theta schedule.
+     */
+    [[nodiscard]] inline const std::vector<int>& getThetaSchedule() const { return thetaSchedule; }
+
+    /**
+     * @brief Writes the state of this scheme, including the residual history and theta schedule, to a binary stream.
+     * @param[in] stream The binary output stream.
+     */
+    void writeState(std::ostream& stream) const override;
+
+    /**
+     * @brief Reads the state of this scheme from a binary stream that was written by writeState().
+     * @param[in] stream The binary input stream.
+     */
+    void readState(std::istream& stream) override;
+
+    /**
+     * @brief Returns whether this scheme is adaptive or not
+     * @returns true
+     * @note This function overrides Scheme::isAdaptive() which defaults to false
+     */
+    bool isAdaptive() const override { return true; }
+
+    // Friend class definition, because the Scheme constructors are private
+    friend class sim::HybridContinuous<T>;
+
+};
+
+}   // namespace mmft
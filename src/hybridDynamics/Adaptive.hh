@@ -0,0 +1,102 @@
+#include "Adaptive.h"
+
+namespace mmft {
+
+template<typename T>
+AdaptiveScheme<T>::AdaptiveScheme(const std::shared_ptr<arch::CfdModule<T>> module, T alpha, T beta, int thetaMin_, int thetaMax_) :
+    Scheme<T>(module, alpha, beta, thetaMin_), thetaMin(thetaMin_), thetaMax(thetaMax_)
+{
+    checkBounds();
+}
+
+template<typename T>
+AdaptiveScheme<T>::AdaptiveScheme(const std::shared_ptr<arch::CfdModule<T>> module, std::unordered_map<int, T> alpha, std::unordered_map<int, T> beta, int thetaMin_, int thetaMax_) :
+    Scheme<T>(module, alpha, beta, thetaMin_), thetaMin(thetaMin_), thetaMax(thetaMax_)
+{
+    checkBounds();
+}
+
+template<typename T>
+void AdaptiveScheme<T>::checkBounds() const {
+    if (thetaMin < 1) {
+        throw std::invalid_argument("The lower bound for theta of an adaptive update scheme must be at least 1.");
+    }
+    if (thetaMax < thetaMin) {
+        throw std::invalid_argument("The upper bound for theta of an adaptive update scheme must not be smaller than the lower bound.");
+    }
+}
+
+template<typename T>
+void AdaptiveScheme<T>::setTolerances(T lowerTolerance_, T upperTolerance_) {
+    if (lowerTolerance_ <= 0.0 || upperTolerance_ <= lowerTolerance_) {
+        throw std::invalid_argument("The tolerances of an adaptive update scheme must satisfy 0 < lowerTolerance < upperTolerance.");
+    }
+    lowerTolerance = lowerTolerance_;
+    upperTolerance = upperTolerance_;
+}
+
+template<typename T>
+T AdaptiveScheme<T>::relativeChange(const std::unordered_map<size_t, T>& current, const std::unordered_map<size_t, T>& previous) const {
+    T maxChange = 0.0;
+    for (auto& [key, value] : current) {
+        auto it = previous.find(key);
+        if (it == previous.end()) {
+            continue;
+        }
+        T reference = std::max(std::abs(value), std::abs(it->second));
+        if (reference > std::numeric_limits<T>::epsilon()) {
+            maxChange = std::max(maxChange, std::abs(value - it->second) / reference);
+        }
+    }
+    return maxChange;
+}
+
+template<typename T>
+void AdaptiveScheme<T>::updateTheta(const std::unordered_map<size_t, T>& pressures, const std::unordered_map<size_t, T>& flowRates) {
+    int theta = this->getTheta();
+    thetaSchedule.push_back(theta);
+
+    if (hasHistory) {
+        T change = std::max(relativeChange(pressures, prevPressures), relativeChange(flowRates, prevFlowRates));
+        if (change > upperTolerance) {
+            // Interface values are still far off, update the boundaries more often
+            this->setTheta(std::max(thetaMin, theta / 2));
+        } else if (change < lowerTolerance) {
+            // Interface values have settled, avoid unnecessary nodal analyses
+            this->setTheta((theta > thetaMax / 2) ? thetaMax : 2 * theta);
+        }
+    }
+
+    prevPressures = pressures;
+    prevFlowRates = flowRates;
+    hasHistory = true;
+}
+
+template<typename T>
+void AdaptiveScheme<T>::writeState(std::ostream& stream) const {
+    Scheme<T>::writeState(stream);
+    porting::writeBinary(stream, thetaMin);
+    porting::writeBinary(stream, thetaMax);
+    porting::writeBinary(stream, lowerTolerance);
+    porting::writeBinary(stream, upperTolerance);
+    porting::writeBinary(stream, hasHistory);
+    porting::writeBinary(stream, prevPressures);
+    porting::writeBinary(stream, prevFlowRates);
+    porting::writeBinary(stream, thetaSchedule);
+}
+
+template<typename T>
+void AdaptiveScheme<T>::readState(std::istream& stream) {
+    Scheme<T>::readState(stream);
+    porting::readBinary(stream, thetaMin);
+    porting::readBinary(stream, thetaMax);
+    porting::readBinary(stream, lowerTolerance);
+    porting::readBinary(stream, upperTolerance);
+    porting::readBinary(stream, hasHistory);
+    porting::readBinary(stream, prevPressures);
+    porting::readBinary(stream, prevFlowRates);
+    porting::readBinary(stream, thetaSchedule);
+    checkBounds();
+}
+
+}   // namespace mmft
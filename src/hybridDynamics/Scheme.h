@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <iostream>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -166,6 +167,33 @@ public:
      */
     virtual bool isNaive() const { return false; }
 
+    /**
+     * @brief Returns whether this scheme adapts theta during the simulation or not
+     * @returns false
+     * @note This function is overriden by AdaptiveScheme::isAdaptive() which defaults to true
+     */
+    virtual bool isAdaptive() const { return false; }
+
+    /**
+     * @brief Hook that is called by the CFD simulator after every coupling round with the interface values at the openings.
+     * Schemes with a constant theta ignore the values.
+     * @param[in] pressures The pressures at the openings after the last coupling round. <nodeId, pressure>
+     * @param[in] flowRates The flow rates at the openings after the last coupling round. <nodeId, flowRate>
+     */
+    virtual void updateTheta(const std::unordered_map<size_t, T>& pressures, const std::unordered_map<size_t, T>& flowRates) { }
+
+    /**
+     * @brief Writes the state of this scheme (relaxation values and theta) to a binary stream.
+     * @param[in] stream The binary output stream.
+     */
+    virtual void writeState(std::ostream& stream) const;
+
+    /**
+     * @brief Reads the state of this scheme from a binary stream that was written by writeState().
+     * @param[in] stream The binary input stream.
+     */
+    virtual void readState(std::istream& stream);
+
     virtual ~Scheme() = default;
 
 };
@@ -104,4 +104,18 @@ int Scheme<T>::getTheta() const {
     return theta;
 }
 
+template<typename T>
+void Scheme<T>::writeState(std::ostream& stream) const {
+    porting::writeBinary(stream, alpha);
+    porting::writeBinary(stream, beta);
+    porting::writeBinary(stream, theta);
+}
+
+template<typename T>
+void Scheme<T>::readState(std::istream& stream) {
+    porting::readBinary(stream, alpha);
+    porting::readBinary(stream, beta);
+    porting::readBinary(stream, theta);
+}
+
 }   // namespace mmft
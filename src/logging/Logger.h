@@ -0,0 +1,192 @@
+/**
+ * @file Logger.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace logging {
+
+/**
+ * @brief Severity of a log message. Messages below the level of the logger are discarded.
+ */
+enum class LogLevel {
+    Trace,      ///< Fine-grained messages, e.g., of single iterations.
+    Debug,      ///< Diagnostic messages, e.g., iteration progress and convergence.
+    Info,       ///< Progress of the simulation stages.
+    Warning,    ///< Recoverable problems.
+    Error,      ///< Errors.
+    Off         ///< Disables all messages.
+};
+
+/**
+ * @brief Returns the name of a log level.
+ * @param[in] level The log level.
+ * @returns Name of the log level.
+ */
+inline std::string levelName(LogLevel level);
+
+/**
+ * @brief Parses the name of a log level, e.g., "debug" or "WARNING".
+ * @param[in] name The name of the log level.
+ * @returns The log level.
+ * @throws std::invalid_argument if the name is not a log level.
+ */
+inline LogLevel parseLevel(const std::string& name);
+
+/**
+ * @brief Process-wide logger with a runtime log level. Messages are written to the console, or to a user-defined sink,
+ * either synchronously or by a background thread that writes them in batches. The console is only flushed once per
+ * batch, or when the log is flushed explicitly.
+ * The initial level and mode can be set with the environment variables MMFT_LOG_LEVEL and MMFT_LOG_ASYNC.
+ */
+class Logger {
+public:
+    using Sink = std::function<void(LogLevel, const std::string&)>;
+
+private:
+    struct State {
+        std::atomic<int> level;                                     ///< Minimal level of the messages that are logged.
+        std::atomic<int64_t> rateLimit { 1000 };                    ///< Minimal interval between rate-limited messages in ms.
+        std::mutex mutex;                                           ///< Guards all following members.
+        std::condition_variable queued;                             ///< Notifies the worker about queued messages.
+        std::condition_variable written;                            ///< Notifies waiting threads about written messages.
+        std::vector<std::pair<LogLevel, std::string>> queue;        ///< Messages that were not written yet.
+        size_t queuedCount = 0;                                     ///< Number of messages that were queued in total.
+        size_t writtenCount = 0;                                    ///< Number of queued messages that were written in total.
+        Sink sink = nullptr;                                        ///< Custom sink, or nullptr for the console.
+        std::thread worker;                                         ///< Background thread in asynchronous mode.
+        bool stop = false;                                          ///< Requests the worker to stop.
+
+        inline State();
+        inline ~State();
+    };
+
+    static inline State& getState();
+
+    static inline void write(const Sink& sink, LogLevel level, const std::string& message);
+
+    static inline void run(State& state);
+
+    static inline void stopWorker(State& state, std::unique_lock<std::mutex>& lock);
+
+public:
+    /**
+     * @brief Set the minimal level of the messages that are logged.
+     * @param[in] level The log level.
+     */
+    static inline void setLevel(LogLevel level);
+
+    /**
+     * @brief Returns the minimal level of the messages that are logged.
+     */
+    [[nodiscard]] static inline LogLevel getLevel();
+
+    /**
+     * @brief Returns whether messages of a level are logged. This is a single atomic load, so that disabled messages
+     * cost (almost) nothing.
+     * @param[in] level The log level.
+     */
+    [[nodiscard]] static inline bool isEnabled(LogLevel level) {
+        return static_cast<int>(level) >= getState().level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enable or disable the background thread that writes the messages.
+     * @param[in] asynchronous Whether messages are written by a background thread.
+     */
+    static inline void setAsynchronous(bool asynchronous);
+
+    /**
+     * @brief Returns whether messages are written by a background thread.
+     */
+    [[nodiscard]] static inline bool isAsynchronous();
+
+    /**
+     * @brief Set the sink that receives the messages.
+     * @param[in] sink Function that writes a message, or nullptr to write to the console.
+     */
+    static inline void setSink(Sink sink);
+
+    /**
+     * @brief Set the minimal interval between two rate-limited messages of the same RateLimiter, e.g., for messages
+     * that would otherwise be logged in every iteration.
+     * @param[in] interval The interval.
+     */
+    static inline void setRateLimit(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Returns the minimal interval between two rate-limited messages.
+     */
+    [[nodiscard]] static inline std::chrono::milliseconds getRateLimit();
+
+    /**
+     * @brief Logs a message if its level is enabled.
+     * @param[in] level Level of the message.
+     * @param[in] message The message, without a trailing newline.
+     */
+    static inline void log(LogLevel level, std::string message);
+
+    /**
+     * @brief Blocks until all queued messages were written and flushes the console.
+     */
+    static inline void flush();
+};
+
+/**
+ * @brief Limits a message that is logged repeatedly, e.g., in each iteration, to one message per rate limit interval
+ * of the logger.
+ */
+class RateLimiter {
+private:
+    std::chrono::steady_clock::time_point last;
+    bool first = true;
+
+public:
+    /**
+     * @brief Returns whether the next message may be logged, and if so, restarts the interval.
+     */
+    inline bool ready();
+};
+
+}   // namespace logging
+
+/**
+ * @brief Logs a message that is composed with the stream operator, e.g., MMFT_LOG(logging::LogLevel::Info, "a" << 1).
+ * The message is only composed if the level is enabled.
+ */
+#define MMFT_LOG(level, message)                                                \
+    do {                                                                        \
+        if (::logging::Logger::isEnabled(level)) {                              \
+            std::ostringstream mmftLogStream;                                   \
+            mmftLogStream << message;                                           \
+            ::logging::Logger::log(level, mmftLogStream.str());                 \
+        }                                                                       \
+    } while (false)
+
+/**
+ * @brief Logs a message at most once per rate limit interval of the given RateLimiter.
+ */
+#define MMFT_LOG_RATE_LIMITED(limiter, level, message)                          \
+    do {                                                                        \
+        if (::logging::Logger::isEnabled(level) && (limiter).ready()) {         \
+            MMFT_LOG(level, message);                                           \
+        }                                                                       \
+    } while (false)
+
+#define MMFT_LOG_TRACE(message) MMFT_LOG(::logging::LogLevel::Trace, message)
+#define MMFT_LOG_DEBUG(message) MMFT_LOG(::logging::LogLevel::Debug, message)
+#define MMFT_LOG_INFO(message) MMFT_LOG(::logging::LogLevel::Info, message)
+#define MMFT_LOG_WARNING(message) MMFT_LOG(::logging::LogLevel::Warning, message)
+#define MMFT_LOG_ERROR(message) MMFT_LOG(::logging::LogLevel::Error, message)
@@ -0,0 +1,172 @@
+#include "Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+namespace logging {
+
+inline std::string levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return "trace";
+        case LogLevel::Debug: return "debug";
+        case LogLevel::Info: return "info";
+        case LogLevel::Warning: return "warning";
+        case LogLevel::Error: return "error";
+        case LogLevel::Off: return "off";
+    }
+    throw std::invalid_argument("Unknown log level.");
+}
+
+inline LogLevel parseLevel(const std::string& name) {
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    for (LogLevel level : { LogLevel::Trace, LogLevel::Debug, LogLevel::Info, LogLevel::Warning, LogLevel::Error, LogLevel::Off }) {
+        if (lower == levelName(level)) {
+            return level;
+        }
+    }
+    throw std::invalid_argument("Unknown log level " + name + ".");
+}
+
+inline Logger::State::State() : level(static_cast<int>(LogLevel::Info)) {
+    if (const char* levelVariable = std::getenv("MMFT_LOG_LEVEL")) {
+        level = static_cast<int>(parseLevel(levelVariable));
+    }
+    if (const char* asyncVariable = std::getenv("MMFT_LOG_ASYNC")) {
+        if (std::string(asyncVariable) == "1") {
+            worker = std::thread(&Logger::run, std::ref(*this));
+        }
+    }
+}
+
+inline Logger::State::~State() {
+    std::unique_lock<std::mutex> lock(mutex);
+    stopWorker(*this, lock);
+    std::cout.flush();
+}
+
+inline Logger::State& Logger::getState() {
+    static State state;
+    return state;
+}
+
+inline void Logger::write(const Sink& sink, LogLevel level, const std::string& message) {
+    if (sink) {
+        sink(level, message);
+    } else if (level >= LogLevel::Warning) {
+        std::cerr << message << '\n';
+    } else {
+        std::cout << message << '\n';
+    }
+}
+
+inline void Logger::run(State& state) {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    while (true) {
+        state.queued.wait(lock, [&state] { return state.stop || !state.queue.empty(); });
+        if (state.queue.empty()) {
+            break;
+        }
+        std::vector<std::pair<LogLevel, std::string>> batch;
+        batch.swap(state.queue);
+        Sink sink = state.sink;
+        lock.unlock();
+        // Write the whole batch and flush the console once
+        for (auto& [level, message] : batch) {
+            write(sink, level, message);
+        }
+        std::cout.flush();
+        lock.lock();
+        state.writtenCount += batch.size();
+        state.written.notify_all();
+    }
+}
+
+inline void Logger::stopWorker(State& state, std::unique_lock<std::mutex>& lock) {
+    if (!state.worker.joinable()) {
+        return;
+    }
+    state.stop = true;
+    state.queued.notify_one();
+    std::thread worker = std::move(state.worker);
+    lock.unlock();
+    worker.join();
+    lock.lock();
+    state.stop = false;
+}
+
+inline void Logger::setLevel(LogLevel level) {
+    getState().level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+inline LogLevel Logger::getLevel() {
+    return static_cast<LogLevel>(getState().level.load(std::memory_order_relaxed));
+}
+
+inline void Logger::setAsynchronous(bool asynchronous) {
+    State& state = getState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    if (asynchronous && !state.worker.joinable()) {
+        state.worker = std::thread(&Logger::run, std::ref(state));
+    } else if (!asynchronous) {
+        stopWorker(state, lock);
+    }
+}
+
+inline bool Logger::isAsynchronous() {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.worker.joinable();
+}
+
+inline void Logger::setSink(Sink sink) {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.sink = std::move(sink);
+}
+
+inline void Logger::setRateLimit(std::chrono::milliseconds interval) {
+    getState().rateLimit.store(interval.count(), std::memory_order_relaxed);
+}
+
+inline std::chrono::milliseconds Logger::getRateLimit() {
+    return std::chrono::milliseconds(getState().rateLimit.load(std::memory_order_relaxed));
+}
+
+inline void Logger::log(LogLevel level, std::string message) {
+    if (!isEnabled(level)) {
+        return;
+    }
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.worker.joinable()) {
+        state.queue.emplace_back(level, std::move(message));
+        state.queuedCount++;
+        state.queued.notify_one();
+    } else {
+        write(state.sink, level, message);
+    }
+}
+
+inline void Logger::flush() {
+    State& state = getState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    size_t target = state.queuedCount;
+    state.written.wait(lock, [&state, target] { return !state.worker.joinable() || state.writtenCount >= target; });
+    std::cout.flush();
+}
+
+inline bool RateLimiter::ready() {
+    auto now = std::chrono::steady_clock::now();
+    if (!first && now - last < Logger::getRateLimit()) {
+        return false;
+    }
+    first = false;
+    last = now;
+    return true;
+}
+
+}   // namespace logging
@@ -1,7 +1,11 @@
 //#include <pybind11/pybind11.h>
 
 //namespace py = pybind11;
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <baseSimulator.h>
 #include <baseSimulator.hh>
@@ -12,33 +16,142 @@
 
 using T = double;
 
+/**
+ * @brief Simulates all fixtures of a JSON file concurrently. The number of threads also applies to the export of the
+ * results to the output file.
+ * Usage: MMFTSim --fixtures <file> [--threads <n>] [--output <file>]
+ */
+int simulateFixtures(const std::vector<std::string>& args) {
+    std::string file;
+    std::string output;
+    size_t threads = 0;
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--threads" && i + 1 < args.size()) {
+            threads = std::stoul(args[++i]);
+        } else if (args[i] == "--output" && i + 1 < args.size()) {
+            output = args[++i];
+        } else if (file.empty()) {
+            file = args[i];
+        } else {
+            std::cerr << "[Main] Unknown argument " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    if (file.empty()) {
+        std::cerr << "[Main] Usage: MMFTSim --fixtures <file> [--threads <n>] [--output <file>]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "[Main] Create networks and simulation objects of all fixtures..." << std::endl;
+    auto fixtures = porting::fixturesFromJSON<T>(file);
+
+    std::cout << "[Main] Simulation of " << fixtures.size() << " fixtures..." << std::endl;
+    std::vector<sim::Simulation<T>*> simulations;
+    for (auto& [network, simulation] : fixtures) {
+        simulations.push_back(simulation.get());
+    }
+    sim::simulateConcurrently(simulations, threads);
+
+    std::cout << "[Main] Results..." << std::endl;
+    if (!output.empty()) {
+        porting::fixturesResultToJSON<T>(output, fixtures, threads);
+    } else {
+        for (auto& [network, simulation] : fixtures) {
+            std::cout << "[Main] Fixture " << simulation->getFixtureId() << std::endl;
+            simulation->getResults()->printStates();
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Runs the jobs of a manifest on a pool of worker threads and writes the results of each job to its file.
+ * Usage: MMFTSim --batch <manifest> [--threads <n>] [--pin none|compact|spread] [--format json|binary] [--report <file>]
+ */
+int simulateBatch(const std::vector<std::string>& args) {
+    std::string manifest;
+    std::string report;
+    porting::BatchOptions options;
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--threads" && i + 1 < args.size()) {
+            options.threads = std::stoul(args[++i]);
+        } else if (args[i] == "--pin" && i + 1 < args.size()) {
+            options.pinning = porting::readPinning(args[++i]);
+        } else if (args[i] == "--format" && i + 1 < args.size()) {
+            options.format = porting::readResultFormat(args[++i]);
+        } else if (args[i] == "--report" && i + 1 < args.size()) {
+            report = args[++i];
+        } else if (manifest.empty()) {
+            manifest = args[i];
+        } else {
+            std::cerr << "[Main] Unknown argument " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    if (manifest.empty()) {
+        std::cerr << "[Main] Usage: MMFTSim --batch <manifest> [--threads <n>] [--pin none|compact|spread] [--format json|binary] [--report <file>]" << std::endl;
+        return 1;
+    }
+
+    auto jobs = porting::readManifest(manifest);
+    std::cout << "[Main] Run " << jobs.size() << " jobs on " << sim::workerCount(options.threads, jobs.size()) << " workers..." << std::endl;
+    auto begin = std::chrono::steady_clock::now();
+    auto reports = porting::runBatch<T>(jobs, options);
+    double totalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    if (!report.empty()) {
+        std::ofstream file(report);
+        porting::writeBatchReport(file, reports);
+    }
+    size_t failed = 0;
+    for (auto& jobReport : reports) {
+        if (!jobReport.success) {
+            ++failed;
+            std::cerr << "[Main] " << jobReport.input << " failed: " << jobReport.error << std::endl;
+        }
+    }
+    std::cout << "[Main] Finished " << jobs.size() << " jobs in " << totalTime << " s, " << failed << " failed." << std::endl;
+
+    return failed == 0 ? 0 : 1;
+}
+
 int main(int argc, char const* argv []) {
 
+    std::vector<std::string> args(argv + 1, argv + argc);
+    if (args.empty()) {
+        std::cerr << "[Main] Usage: MMFTSim <file>, MMFTSim --fixtures <file> ... or MMFTSim --batch <manifest> ..." << std::endl;
+        return 1;
+    }
+
     #ifdef USE_ESSLBM
     MPI_Init(NULL,NULL);
     #endif
 
-    std::string file = argv[1];
-
-    // Load and set the network from a JSON file
-    std::cout << "[Main] Create network object..." << std::endl;
-    std::shared_ptr<arch::Network<T>> network = porting::networkFromJSON<T>(file);
+    int status = 0;
+    if (args.front() == "--fixtures") {
+        status = simulateFixtures(args);
+    } else if (args.front() == "--batch") {
+        status = simulateBatch(args);
+    } else {
+        std::string file = args.front();
 
-    // Load and set the simulation from a JSON file
-    std::cout << "[Main] Create simulation object..." << std::endl;
-    std::unique_ptr<sim::Simulation<T>> testSimulation = porting::simulationFromJSON<T>(file, network);
+        // Load and set the network and the simulation from a JSON file
+        std::cout << "[Main] Create network and simulation object..." << std::endl;
+        auto [network, testSimulation] = porting::networkAndSimulationFromJSON<T>(file);
 
-    std::cout << "[Main] Simulation..." << std::endl;
-    // Perform simulation and store result
-    testSimulation->simulate();
+        std::cout << "[Main] Simulation..." << std::endl;
+        // Perform simulation and store result
+        testSimulation->simulate();
 
-    std::cout << "[Main] Results..." << std::endl;
-    // Print the result
-    testSimulation->getResults()->printStates();
+        std::cout << "[Main] Results..." << std::endl;
+        // Print the result
+        testSimulation->getResults()->printStates();
+    }
 
     #ifdef USE_ESSLBM
     MPI_Finalize();
     #endif
 
-    return 0;
+    return status;
 }
@@ -6,7 +6,7 @@
 
 #include <iostream>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 #include "Eigen/Dense"
 
@@ -16,6 +16,7 @@ using Eigen::VectorXd;
 namespace arch {
 
 // Forward declared dependencies
+class DenseIndex;
 template<typename T>
 class Network;
 
@@ -35,6 +36,7 @@ template<typename T>
 class NodalAnalysis {
 private:
     const arch::Network<T>* network = nullptr;
+    const arch::DenseIndex* nodeIndex = nullptr;    // Dense index of the nodes, which gives the matrix row of each node
 
     int nNodes;             // Number of nodes
     int nPressurePumps;     // Number of pressurePumps
@@ -45,7 +47,7 @@ private:
     Eigen::VectorXd z;      // vector z = [i; e]
     Eigen::VectorXd x;      // vector x = [v; j]
 
-    std::unordered_set<int> conductingNodeIds;
+    std::vector<bool> conductingNodes;          // Whether the node at each matrix row is a conducting node
     std::unordered_map<int, int> groundNodeIds;
 
     void readConductance();         // loop through channels and build matrix G
@@ -63,7 +65,9 @@ private:
     void initGroundNodes(const std::unordered_map<int, std::shared_ptr<sim::CFDSimulator<T>>>& cfdSimulators);
 
     // Helper functions
-    bool contains( const std::unordered_set<int>& set, int key);
+    int row(size_t nodeId) const;                       // matrix row of the node with the given id
+    bool isConducting(size_t nodeId) const;
+    void setConducting(size_t nodeId, bool conducting);
     bool contains( const std::unordered_map<int,int>& map, int key);
     void printSystem();
 
@@ -5,7 +5,9 @@ namespace nodal {
 template<typename T>
 NodalAnalysis<T>::NodalAnalysis(const arch::Network<T>* network_) {
     network = network_;
-    nNodes = network->getNodes().size() + network->getVirtualNodes();
+    nodeIndex = &network->getNodeIndex();
+    nNodes = nodeIndex->size();
+    conductingNodes.assign(nNodes, false);
 
     // loop through modules
     for (const auto& [key, module] : network->getCfdModules()) {
@@ -25,7 +27,7 @@ NodalAnalysis<T>::NodalAnalysis(const arch::Network<T>* network_) {
         for (const auto& nodeId : group->nodeIds) {
             // The node is a conducting node
             if(!network->getNodes().at(nodeId)->getGround() && nodeId != size_t(group->groundNodeId)) {
-                conductingNodeIds.emplace(nodeId);
+                setConducting(nodeId, true);
             } 
             // The node is an overall ground node, or counts as ground to a group
             else if (!network->getNodes().at(nodeId)->getGround() && nodeId == size_t(group->groundNodeId)) {
@@ -49,10 +51,12 @@ void NodalAnalysis<T>::clear() {
 
     pressureConvergence = true;
 
-    conductingNodeIds.clear();
+    nodeIndex = &network->getNodeIndex();
+    nNodes = nodeIndex->size();
+    conductingNodes.assign(nNodes, false);
     groundNodeIds.clear();
 
-    int iPump = network->getNodes().size() + network->getVirtualNodes() + network->getPressurePumps().size();
+    int iPump = nNodes + network->getPressurePumps().size();
 
     for (const auto& [key, group] : network->getGroups()) {
         group->checkGroundValue();
@@ -60,7 +64,7 @@ void NodalAnalysis<T>::clear() {
         for (const auto& nodeId : group->nodeIds) {
             // The node is a conducting node
             if(!network->getNodes().at(nodeId)->getGround() && nodeId != size_t(group->groundNodeId)) {
-                conductingNodeIds.emplace(nodeId);
+                setConducting(nodeId, true);
             } 
             // The node is an overall ground node, or counts as ground to a group
             else if (!network->getNodes().at(nodeId)->getGround() && nodeId == size_t(group->groundNodeId)) {
@@ -82,6 +86,7 @@ void NodalAnalysis<T>::clear() {
 
 template<typename T>
 void NodalAnalysis<T>::conductNodalAnalysis() {
+    result::ScopedTimer timer(result::Phase::NodalAnalysis);
     clear();
     readConductance();
     readPressurePumps();
@@ -93,6 +98,7 @@ void NodalAnalysis<T>::conductNodalAnalysis() {
 
 template<typename T>
 bool NodalAnalysis<T>::conductNodalAnalysis(const std::unordered_map<int, std::shared_ptr<sim::CFDSimulator<T>>>& cfdSimulators) {
+    result::ScopedTimer timer(result::Phase::NodalAnalysis);
     clear();
     readConductance();
     readCfdSimulators(cfdSimulators);
@@ -110,21 +116,23 @@ template<typename T>
 void NodalAnalysis<T>::readConductance() {
     // loop through channels and build matrix G
     for (const auto& channel : network->getChannels()) {
-        auto nodeAMatrixId = channel.second->getNodeAId();
-        auto nodeBMatrixId = channel.second->getNodeBId();
+        const bool groundA = network->getNodes().at(channel.second->getNodeAId())->getGround();
+        const bool groundB = network->getNodes().at(channel.second->getNodeBId())->getGround();
+        auto nodeAMatrixId = row(channel.second->getNodeAId());
+        auto nodeBMatrixId = row(channel.second->getNodeBId());
         const T conductance = 1. / channel.second->getResistance();
 
         // main diagonal elements of G
-        if (!network->getNodes().at(nodeAMatrixId)->getGround()) {
+        if (!groundA) {
             A(nodeAMatrixId, nodeAMatrixId) += conductance;
         }
 
-        if (!network->getNodes().at(nodeBMatrixId)->getGround()) {
+        if (!groundB) {
             A(nodeBMatrixId, nodeBMatrixId) += conductance;
         }
 
         // minor diagonal elements of G (if no ground node was present)
-        if (!network->getNodes().at(nodeAMatrixId)->getGround() && !network->getNodes().at(nodeBMatrixId)->getGround()) {
+        if (!groundA && !groundB) {
             A(nodeAMatrixId, nodeBMatrixId) -= conductance;
             A(nodeBMatrixId, nodeAMatrixId) -= conductance;
         }
@@ -140,8 +148,8 @@ void NodalAnalysis<T>::updateReferenceP() {
             group->pRef = node->getPressure();
             int pumpId = groundNodeIds.at(group->groundNodeId);
 
-            A(group->groundNodeId, pumpId) = 1;   // matrix B
-            A(pumpId, group->groundNodeId) = 1;   // matrix C
+            A(row(group->groundNodeId), pumpId) = 1;   // matrix B
+            A(pumpId, row(group->groundNodeId)) = 1;   // matrix C
 
             z(pumpId) = node->getPressure();
         }
@@ -153,15 +161,15 @@ void NodalAnalysis<T>::readPressurePumps() {
     int iPump = nNodes;
     // loop through pressurePumps and build matrix B, C and vector e
     for (const auto& pressurePump : network->getPressurePumps()) {
-        auto nodeAMatrixId = pressurePump.second->getNodeAId();
-        auto nodeBMatrixId = pressurePump.second->getNodeBId();
+        auto nodeAMatrixId = row(pressurePump.second->getNodeAId());
+        auto nodeBMatrixId = row(pressurePump.second->getNodeBId());
 
-        if (contains(conductingNodeIds, nodeAMatrixId)) {
+        if (conductingNodes[nodeAMatrixId]) {
             A(nodeAMatrixId, iPump) = -1;   // matrix B
             A(iPump, nodeAMatrixId) = -1;   // matrix C
         }
 
-        if (contains(conductingNodeIds, nodeBMatrixId)) {
+        if (conductingNodes[nodeBMatrixId]) {
             A(nodeBMatrixId, iPump) = 1;   // matrix B
             A(iPump, nodeBMatrixId) = 1;   // matrix C
         }
@@ -176,14 +184,14 @@ template<typename T>
 void NodalAnalysis<T>::readFlowRatePumps() {
     // loop through flowRatePumps and build vector i
     for (const auto& flowRatePump : network->getFlowRatePumps()) {
-        auto nodeAMatrixId = flowRatePump.second->getNodeAId();
-        auto nodeBMatrixId = flowRatePump.second->getNodeBId();
+        auto nodeAMatrixId = row(flowRatePump.second->getNodeAId());
+        auto nodeBMatrixId = row(flowRatePump.second->getNodeBId());
         const T flowRate = flowRatePump.second->getFlowRate();
 
-        if (contains(conductingNodeIds, nodeAMatrixId)){
+        if (conductingNodes[nodeAMatrixId]){
             z(nodeAMatrixId) = -flowRate;
         }
-        if (contains(conductingNodeIds, nodeBMatrixId)){
+        if (conductingNodes[nodeBMatrixId]){
             z(nodeBMatrixId) = flowRate;
         }
     }
@@ -191,6 +199,8 @@ void NodalAnalysis<T>::readFlowRatePumps() {
 
 template<typename T>
 void NodalAnalysis<T>::solve() {
+    result::ScopedTimer timer(result::Phase::NodalSolve);
+    result::Profiler::count(result::Counter::NodalUnknowns, z.size());
     // solve equation x = A^(-1) * z
     x = A.colPivHouseholderQr().solve(z);
 }
@@ -199,9 +209,10 @@ template<typename T>
 void NodalAnalysis<T>::setResults() {
     // set pressure of nodes to result value
     for (const auto& [key, group] : network->getGroups()) {
-        for (auto nodeMatrixId : group->nodeIds) {
-            auto& node = network->getNodes().at(nodeMatrixId);
-            if (contains(conductingNodeIds, nodeMatrixId)) {
+        for (auto nodeId : group->nodeIds) {
+            auto& node = network->getNodes().at(nodeId);
+            auto nodeMatrixId = row(nodeId);
+            if (conductingNodes[nodeMatrixId]) {
                 node->setPressure(x(nodeMatrixId));
             } else if (node->getGround()) {
                 node->setPressure(0.0);
@@ -231,11 +242,11 @@ void NodalAnalysis<T>::initGroundNodes() {
             T pMin = -1.0;
             for (auto nodeId : group->nodeIds) {
                 if (pMin < 0.0) {
-                    pMin = x(nodeId);
+                    pMin = x(row(nodeId));
                     group->groundNodeId = nodeId;
                 }
-                if (x(nodeId) < pMin) {
-                    pMin = x(nodeId);
+                if (x(row(nodeId)) < pMin) {
+                    pMin = x(row(nodeId));
                     group->groundNodeId = nodeId;
                 }
             }
@@ -249,7 +260,7 @@ void NodalAnalysis<T>::initGroundNodes() {
                 }
             }
             groundNodeIds.emplace(group->groundNodeId, 0);
-            conductingNodeIds.erase(group->groundNodeId);
+            setConducting(group->groundNodeId, false);
             group->initialized = true;
         }
     }
@@ -266,11 +277,11 @@ void NodalAnalysis<T>::initGroundNodes(const std::unordered_map<int, std::shared
                     throw std::runtime_error("Node ID " + std::to_string(nodeId) + " is too large to be converted to int.");
                 }
                 if (pMin < 0.0) {
-                    pMin = x(nodeId);
+                    pMin = x(row(nodeId));
                     group->groundNodeId = int(nodeId);  // This is fine becasue we checked the range 
                 }
-                if (x(nodeId) < pMin) {
-                    pMin = x(nodeId);
+                if (x(row(nodeId)) < pMin) {
+                    pMin = x(row(nodeId));
                     group->groundNodeId = int(nodeId);  // This is fine becasue we checked the range
                 }
             }
@@ -284,7 +295,7 @@ void NodalAnalysis<T>::initGroundNodes(const std::unordered_map<int, std::shared
                 }
             }
             groundNodeIds.emplace(group->groundNodeId, 0);
-            conductingNodeIds.erase(group->groundNodeId);
+            setConducting(group->groundNodeId, false);
             group->initialized = true;
         }
     }
@@ -323,21 +334,21 @@ void NodalAnalysis<T>::readCfdSimulators(const std::unordered_map<int, std::shar
         // If module is not initialized (1st loop), loop over channels of fully connected graph
         if ( ! cfdSimulator->getInitialized() ) {
             for (const auto& [key, channel] : cfdSimulator->getModule()->getNetwork()->getChannels()) {
-                auto nodeAMatrixId = channel->getNodeAId();
-                auto nodeBMatrixId = channel->getNodeBId();
+                auto nodeAMatrixId = row(channel->getNodeAId());
+                auto nodeBMatrixId = row(channel->getNodeBId());
                 const T conductance = 1. / channel->getResistance();
 
                 // main diagonal elements of G
-                if (contains(conductingNodeIds, nodeAMatrixId)) {
+                if (conductingNodes[nodeAMatrixId]) {
                     A(nodeAMatrixId, nodeAMatrixId) += conductance;
                 }
 
-                if (contains(conductingNodeIds, nodeBMatrixId)) {
+                if (conductingNodes[nodeBMatrixId]) {
                     A(nodeBMatrixId, nodeBMatrixId) += conductance;
                 }
 
                 // minor diagonal elements of G (if no ground node was present)
-                if (contains(conductingNodeIds, nodeAMatrixId) && contains(conductingNodeIds, nodeBMatrixId)) {
+                if (conductingNodes[nodeAMatrixId] && conductingNodes[nodeBMatrixId]) {
                     A(nodeAMatrixId, nodeBMatrixId) -= conductance;
                     A(nodeBMatrixId, nodeAMatrixId) -= conductance;
                 }
@@ -350,9 +361,9 @@ void NodalAnalysis<T>::readCfdSimulators(const std::unordered_map<int, std::shar
         else if ( cfdSimulator->getInitialized() ) {
             for (const auto& [key, node] : cfdSimulator->getModule()->getNodes()) {
                 // Write the module's flowrates into vector i if the node is not a group's ground node
-                if (contains(conductingNodeIds, key)) {
+                if (isConducting(key)) {
                     T flowRate = cfdSimulator->getFlowRates().at(key) * cfdSimulator->getModule()->getOpenings().at(key).height;
-                    z(key) = -flowRate;
+                    z(row(key)) = -flowRate;
                 } 
                 // Write module's pressure into matrix B, C and vector e
                 else if (contains(groundNodeIds, key)) {
@@ -375,7 +386,7 @@ void NodalAnalysis<T>::writeCfdSimulators(const std::unordered_map<int, std::sha
         std::unordered_map<size_t, T> flowRates_ = cfdSimulator.second->getFlowRates();
         for (auto& [key, node] : cfdSimulator.second->getModule()->getNodes()){
             // Communicate pressure to the module
-            if (contains(conductingNodeIds, key)) {
+            if (isConducting(key)) {
                 T old_pressure = old_pressures.at(key);
                 T new_pressure = node->getPressure();
                 T set_pressure = 0.0;
@@ -413,25 +424,23 @@ void NodalAnalysis<T>::writeCfdSimulators(const std::unordered_map<int, std::sha
 }
 
 template<typename T>
-bool NodalAnalysis<T>::contains( const std::unordered_set<int>& set, int key) {
-    bool contain = false;
-    for (auto& nodeId : set) {
-        if (key == nodeId) {
-            contain = true;
-        }
-    }
-    return contain;
+int NodalAnalysis<T>::row(size_t nodeId) const {
+    return int(nodeIndex->index(nodeId));
+}
+
+template<typename T>
+bool NodalAnalysis<T>::isConducting(size_t nodeId) const {
+    return conductingNodes[nodeIndex->index(nodeId)];
+}
+
+template<typename T>
+void NodalAnalysis<T>::setConducting(size_t nodeId, bool conducting) {
+    conductingNodes[nodeIndex->index(nodeId)] = conducting;
 }
 
 template<typename T>
 bool NodalAnalysis<T>::contains( const std::unordered_map<int, int>& map, int key) {
-    bool contain = false;
-    for (auto& [nodeId, pumpId] : map) {
-        if (key == nodeId) {
-            contain = true;
-        }
-    }
-    return contain;
+    return map.find(key) != map.end();
 }
 
 template<typename T>
@@ -0,0 +1,118 @@
+/**
+ * @file batchRunner.h
+ */
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../simulation/simulators/SimulationPool.h"
+
+namespace porting {
+
+/**
+ * @brief Enum to specify the format in which the results of a batch job are written.
+*/
+enum class ResultFormat {
+    JSON,       ///< The results are written by resultToJSON.
+    Binary      ///< The state table of the results is written by resultToBinary. Only for continuous simulations.
+};
+
+/**
+ * @brief A job of a batch, i.e., a simulation that is read from a JSON file and of which the results are written to
+ * another file.
+*/
+struct BatchJob {
+    std::string input;      ///< Location of the JSON definition of the network and the simulation.
+    std::string output;     ///< Location at which the results are written.
+};
+
+/**
+ * @brief Settings of a batch run.
+*/
+struct BatchOptions {
+    size_t threads = 0;                             ///< Number of worker threads, 0 selects the number of hardware threads.
+    sim::Pinning pinning = sim::Pinning::None;      ///< Pinning of the worker threads to the processors.
+    ResultFormat format = ResultFormat::JSON;       ///< Format in which the results are written.
+};
+
+/**
+ * @brief Report of a batch job, with the run times of the stages of the job in [s].
+*/
+struct BatchReport {
+    std::string input;              ///< Location of the JSON definition of the job.
+    std::string output;             ///< Location of the results of the job.
+    size_t worker = 0;              ///< Index of the worker that ran the job.
+    bool success = false;           ///< Whether the results of the job were written.
+    std::string error;              ///< Message of the error that stopped the job, if it failed.
+    double loadTime = 0.0;          ///< Time to read and construct the network and the simulation.
+    double simulationTime = 0.0;    ///< Time to simulate.
+    double writeTime = 0.0;         ///< Time to write the results.
+};
+
+/**
+ * @brief Reads a manifest of batch jobs from a file. Each line holds the input and the output location of one job,
+ * separated by whitespace. Empty lines and lines starting with '#' are ignored. Relative locations are relative to the
+ * directory of the manifest.
+ * @param[in] manifestFile Location of the manifest.
+ * @returns The jobs, in the order of the manifest.
+ * @throws runtime_error if the manifest cannot be read.
+ * @throws invalid_argument if a line does not hold exactly two locations.
+*/
+inline std::vector<BatchJob> readManifest(const std::string& manifestFile);
+
+/**
+ * @brief Reads a manifest of batch jobs from a stream, see readManifest(const std::string&).
+ * @param[in] manifest The manifest.
+ * @param[in] directory Directory to which relative locations are relative. Empty keeps them as they are, i.e.,
+ * relative to the working directory.
+ * @returns The jobs, in the order of the manifest.
+ * @throws invalid_argument if a line does not hold exactly two locations.
+*/
+inline std::vector<BatchJob> readManifest(std::istream& manifest, const std::string& directory = "");
+
+/**
+ * @brief Returns the result format with the given name.
+ * @param[in] name Name of the format, either "json" or "binary".
+ * @returns The result format.
+ * @throws invalid_argument if the name is not a result format.
+*/
+inline ResultFormat readResultFormat(const std::string& name);
+
+/**
+ * @brief Returns the pinning strategy with the given name.
+ * @param[in] name Name of the pinning strategy, either "none", "compact" or "spread".
+ * @returns The pinning strategy.
+ * @throws invalid_argument if the name is not a pinning strategy.
+*/
+inline sim::Pinning readPinning(const std::string& name);
+
+/**
+ * @brief Runs the jobs of a batch on a pool of worker threads within this process. Each job reads its network and
+ * simulation from the JSON file, simulates it and writes the results to the output file. A failing job does not stop
+ * the other jobs, its error is recorded in its report. A job that is not a continuous simulation fails before it is
+ * simulated if the results are written in the binary format, since that format only holds pressures and flow rates. Hybrid and CFD simulations share process-wide state of the CFD
+ * solvers, hence only one of them is constructed and simulated at a time.
+ * @param[in] jobs The jobs.
+ * @param[in] options The settings of the run.
+ * @returns The report of each job, in the order of the jobs.
+*/
+template<typename T>
+std::vector<BatchReport> runBatch(const std::vector<BatchJob>& jobs, const BatchOptions& options);
+
+/**
+ * @brief Writes the reports of a batch run as CSV table, with one row per job.
+ * @param[in] stream The output stream.
+ * @param[in] reports The reports of the jobs.
+*/
+inline void writeBatchReport(std::ostream& stream, const std::vector<BatchReport>& reports);
+
+}   // namespace porting
@@ -0,0 +1,143 @@
+#include "batchRunner.h"
+
+namespace porting {
+
+inline std::vector<BatchJob> readManifest(const std::string& manifestFile) {
+    std::ifstream manifest(manifestFile);
+    if (!manifest) {
+        throw std::runtime_error("Could not open " + manifestFile + ".");
+    }
+    return readManifest(manifest, std::filesystem::path(manifestFile).parent_path().string());
+}
+
+inline std::vector<BatchJob> readManifest(std::istream& manifest, const std::string& directory) {
+    auto resolve = [&directory](std::string& location) {
+        std::filesystem::path path(location);
+        if (!directory.empty() && path.is_relative()) {
+            location = (std::filesystem::path(directory) / path).string();
+        }
+    };
+
+    std::vector<BatchJob> jobs;
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(manifest, line)) {
+        ++lineNumber;
+        std::istringstream fields(line);
+        BatchJob job;
+        if (!(fields >> job.input) || job.input.front() == '#') {
+            continue;
+        }
+        std::string rest;
+        if (!(fields >> job.output) || (fields >> rest)) {
+            throw std::invalid_argument("Line " + std::to_string(lineNumber) + " of the manifest must hold an input and an output location.");
+        }
+        resolve(job.input);
+        resolve(job.output);
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+inline ResultFormat readResultFormat(const std::string& name) {
+    if (name == "json") {
+        return ResultFormat::JSON;
+    } else if (name == "binary") {
+        return ResultFormat::Binary;
+    }
+    throw std::invalid_argument("Invalid result format " + name + ". Please select one of the following:\n\tjson\n\tbinary");
+}
+
+inline sim::Pinning readPinning(const std::string& name) {
+    if (name == "none") {
+        return sim::Pinning::None;
+    } else if (name == "compact") {
+        return sim::Pinning::Compact;
+    } else if (name == "spread") {
+        return sim::Pinning::Spread;
+    }
+    throw std::invalid_argument("Invalid pinning " + name + ". Please select one of the following:\n\tnone\n\tcompact\n\tspread");
+}
+
+template<typename T>
+std::vector<BatchReport> runBatch(const std::vector<BatchJob>& jobs, const BatchOptions& options) {
+    using clock = std::chrono::steady_clock;
+    auto seconds = [](clock::time_point begin, clock::time_point end) { return std::chrono::duration<double>(end - begin).count(); };
+
+    std::vector<BatchReport> reports(jobs.size());
+    std::mutex cfdMutex;
+    static thread_local size_t currentWorker = 0;
+    size_t workers = sim::workerCount(options.threads, jobs.size());
+
+    auto startWorker = [&](size_t worker) {
+        currentWorker = worker;
+        if (options.pinning != sim::Pinning::None) {
+            sim::pinCurrentThread(sim::pinnedProcessor(options.pinning, worker, workers));
+        }
+    };
+
+    auto runJob = [&](size_t i) {
+        BatchReport& report = reports[i];
+        report.input = jobs[i].input;
+        report.output = jobs[i].output;
+        report.worker = currentWorker;
+        auto begin = clock::now();
+        auto stage = begin;
+        try {
+            json jsonString = parseJSONFile(jobs[i].input);
+            std::unique_lock<std::mutex> lock(cfdMutex, std::defer_lock);
+            if (readType<T>(jsonString) != sim::Type::Abstract) {
+                lock.lock();
+            }
+            auto [network, simulation] = networkAndSimulationFromJSON<T>(jsonString);
+            if (options.format == ResultFormat::Binary) {
+                assertBinaryResult(simulation.get());
+            }
+            stage = clock::now();
+            report.loadTime = seconds(begin, stage);
+
+            simulation->simulate();
+            auto simulated = clock::now();
+            report.simulationTime = seconds(stage, simulated);
+            stage = simulated;
+            if (lock.owns_lock()) {
+                lock.unlock();
+            }
+
+            if (options.format == ResultFormat::Binary) {
+                resultToBinary<T>(jobs[i].output, simulation.get());
+            } else {
+                resultToJSON<T>(jobs[i].output, simulation.get(), 1);
+            }
+            report.writeTime = seconds(stage, clock::now());
+            report.success = true;
+        } catch (const std::exception& e) {
+            report.error = e.what();
+        } catch (...) {
+            report.error = "Unknown error.";
+        }
+    };
+
+    sim::runJobs(jobs.size(), options.threads, runJob, startWorker);
+    return reports;
+}
+
+inline void writeBatchReport(std::ostream& stream, const std::vector<BatchReport>& reports) {
+    auto quote = [](const std::string& text) {
+        std::string quoted = "\"";
+        for (char c : text) {
+            quoted += (c == '"') ? std::string("\"\"") : std::string(1, c);
+        }
+        return quoted + "\"";
+    };
+
+    stream << "job,input,output,worker,status,load [s],simulation [s],write [s],error\n";
+    for (size_t i = 0; i < reports.size(); ++i) {
+        const BatchReport& report = reports[i];
+        stream << i << ',' << quote(report.input) << ',' << quote(report.output) << ',' << report.worker << ','
+               << (report.success ? "ok" : "failed") << ',' << report.loadTime << ',' << report.simulationTime << ','
+               << report.writeTime << ',' << quote(report.error) << '\n';
+    }
+}
+
+}   // namespace porting
@@ -0,0 +1,230 @@
+/**
+ * @file binaryPorter.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace arch {
+
+// Forward declared dependencies
+template<typename T>
+class Network;
+
+}   // namespace arch
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class Simulation;
+
+}   // namespace sim
+
+namespace result {
+
+// Forward declared dependencies
+template<typename T>
+struct StateTable;
+
+}   // namespace result
+
+namespace porting {
+
+inline constexpr uint32_t networkBinaryVersion = 1;       ///< Version of the binary network format.
+inline constexpr uint32_t simulationBinaryVersion = 1;    ///< Version of the binary simulation format.
+inline constexpr uint32_t resultBinaryVersion = 1;        ///< Version of the binary result format.
+
+/**
+ * @brief Binary record of a node. All records are zero-initialized before they are filled, such that the padding
+ * bytes, if any, are deterministic.
+*/
+template<typename T>
+struct NodeRecord {
+    uint64_t id;
+    uint64_t ground;
+    uint64_t sink;
+    T x;
+    T y;
+};
+
+/**
+ * @brief Binary record of a rectangular channel.
+*/
+template<typename T>
+struct ChannelRecord {
+    uint64_t id;
+    uint64_t nodeA;
+    uint64_t nodeB;
+    uint64_t type;
+    T height;
+    T width;
+    T length;
+};
+
+/**
+ * @brief Binary record of a flow rate or pressure pump. The value is the flow rate or the pressure of the pump.
+*/
+template<typename T>
+struct PumpRecord {
+    uint64_t id;
+    uint64_t nodeA;
+    uint64_t nodeB;
+    T value;
+};
+
+/**
+ * @brief Binary record of a membrane, which lies along a channel.
+*/
+template<typename T>
+struct MembraneRecord {
+    uint64_t id;
+    uint64_t channel;
+    T height;
+    T width;
+    T poreRadius;
+    T porosity;
+};
+
+/**
+ * @brief Binary record of a tank, which lies along a membrane.
+*/
+template<typename T>
+struct TankRecord {
+    uint64_t id;
+    uint64_t membrane;
+    T height;
+    T width;
+};
+
+/**
+ * @brief Returns the keys of a map in ascending order.
+ * @param[in] map The map.
+ * @returns Vector of the sorted keys.
+*/
+template<typename K, typename V>
+std::vector<K> sortedKeys(const std::unordered_map<K, V>& map);
+
+/**
+ * @brief Write the definition of a network to a binary stream. The nodes, channels, pumps, membranes, tanks and
+ * modules are written in the order of their ids, such that equal networks give equal binary representations.
+ * Values that are computed during a simulation, such as pressures and resistances, are not written.
+ * @param[in] stream The binary output stream.
+ * @param[in] network The network that is written.
+ * @throws invalid_argument if the network contains a channel that is not rectangular.
+*/
+template<typename T>
+void networkToBinary(std::ostream& stream, const arch::Network<T>& network);
+
+/**
+ * @brief Constructor of the Network from a binary stream that was written by networkToBinary. All elements keep
+ * their ids.
+ * @param[in] stream The binary input stream.
+ * @returns Network network
+ * @throws runtime_error if the stream is not a binary network of this version, or ends prematurely.
+*/
+template<typename T>
+std::shared_ptr<arch::Network<T>> networkFromBinary(std::istream& stream);
+
+/**
+ * @brief Write the setup of a simulation to a binary stream, i.e., the settings, fluids, resistance model and,
+ * depending on the platform, the droplets and droplet injections or the mixing model, species, mixtures and mixture
+ * injections. The network of the simulation is not written.
+ * @param[in] stream The binary output stream.
+ * @param[in] simulation Pointer to the simulation that is written.
+ * @throws invalid_argument if the simulation is not an Abstract continuous, droplet or concentration simulation, or if
+ * it contains a mixture with a concentration profile.
+ * @throws logic_error if the continuous phase of the simulation is not set.
+*/
+template<typename T>
+void simulationToBinary(std::ostream& stream, sim::Simulation<T>* simulation);
+
+/**
+ * @brief Constructor of the Simulation from a binary stream that was written by simulationToBinary. The fluids,
+ * droplets, species and mixtures receive new ids, the references between them are translated accordingly.
+ * @param[in] stream The binary input stream.
+ * @param[in] network Pointer to the network on which the simulation acts. Must contain the channels of the injections.
+ * @returns unique_ptr<sim::Simulation<T>> simulation
+ * @throws runtime_error if the stream is not a binary simulation of this version, or ends prematurely.
+*/
+template<typename T>
+std::unique_ptr<sim::Simulation<T>> simulationFromBinary(std::istream& stream, std::shared_ptr<arch::Network<T>> network);
+
+/**
+ * @brief Generates a binary string of the network and the setup of the simulation that acts on it.
+ * @param[in] simulation Pointer to the simulation.
+ * @returns The binary string.
+*/
+template<typename T>
+std::string networkAndSimulationToBinary(sim::Simulation<T>* simulation);
+
+/**
+ * @brief Constructor of the Network and the Simulation from a binary string that was generated by
+ * networkAndSimulationToBinary.
+ * @param[in] binary The binary string.
+ * @returns Pair of the network and the simulation that acts on the network
+*/
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> networkAndSimulationFromBinary(const std::string& binary);
+
+/**
+ * @brief Creates a deep copy of the network and the setup of a simulation. The copy acts on the copied network and
+ * can be simulated independently of the original. The network is copied member-wise (see arch::Network::clone), the
+ * setup of the simulation is copied through its binary representation (see simulationToBinary).
+ * @param[in] simulation Pointer to the simulation that is copied.
+ * @returns Pair of the copied network and the copied simulation
+*/
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> cloneNetworkAndSimulation(sim::Simulation<T>* simulation);
+
+/**
+ * @brief Checks that the results of a simulation can be written in the binary format, which only holds the pressures
+ * and flow rates. The droplet and mixture positions of droplet, concentration and membrane simulations are not part of
+ * the format, hence these simulations are rejected instead of losing their results silently.
+ * @param[in] simulation Pointer to the simulation of which the results are written.
+ * @throws invalid_argument if the simulation is not a continuous simulation.
+*/
+template<typename T>
+void assertBinaryResult(const sim::Simulation<T>* simulation);
+
+/**
+ * @brief Write the pressures and flow rates of all states of a simulation to a binary stream, as the dense state table
+ * of the simulation result (see result::SimulationResult::getStateTable). Values that are missing in a state are NaN.
+ * @param[in] stream The binary output stream.
+ * @param[in] simulation Pointer to the simulation of which the results are written.
+ * @throws invalid_argument if the simulation is not a continuous simulation, see assertBinaryResult.
+*/
+template<typename T>
+void resultToBinary(std::ostream& stream, sim::Simulation<T>* simulation);
+
+/**
+ * @brief Write the pressures and flow rates of all states of a simulation to a binary file.
+ * @param[in] binaryFile Location at which the binary file should be written.
+ * @param[in] simulation Pointer to the simulation of which the results are written.
+ * @throws invalid_argument if the simulation is not a continuous simulation, see assertBinaryResult.
+ * @throws runtime_error if the file cannot be written.
+*/
+template<typename T>
+void resultToBinary(std::string binaryFile, sim::Simulation<T>* simulation);
+
+/**
+ * @brief Reads the state table of a simulation result from a binary stream that was written by resultToBinary.
+ * @param[in] stream The binary input stream.
+ * @returns The state table.
+ * @throws runtime_error if the stream is not a binary result of this version, or ends prematurely.
+*/
+template<typename T>
+result::StateTable<T> resultFromBinary(std::istream& stream);
+
+}   // namespace porting
@@ -0,0 +1,595 @@
+#include "binaryPorter.h"
+
+namespace porting {
+
+template<typename K, typename V>
+std::vector<K> sortedKeys(const std::unordered_map<K, V>& map) {
+    std::vector<K> keys;
+    keys.reserve(map.size());
+    for (auto& [key, value] : map) {
+        keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+template<typename T>
+void networkToBinary(std::ostream& stream, const arch::Network<T>& network) {
+    writeBinaryHeader(stream, "MMFT-NETWORK", networkBinaryVersion);
+    writeBinary(stream, static_cast<int64_t>(network.getVirtualNodes()));
+
+    // Nodes
+    const auto nodeIds = sortedKeys(network.getNodes());
+    std::vector<NodeRecord<T>> nodes(nodeIds.size());
+    for (size_t i = 0; i < nodeIds.size(); ++i) {
+        const auto& node = network.getNodes().at(nodeIds[i]);
+        nodes[i].id = nodeIds[i];
+        nodes[i].ground = node->getGround();
+        nodes[i].sink = node->getSink();
+        nodes[i].x = node->getPosition()[0];
+        nodes[i].y = node->getPosition()[1];
+    }
+    writeBinary(stream, nodes);
+
+    // Channels
+    const auto channelIds = sortedKeys(network.getChannels());
+    std::vector<ChannelRecord<T>> channels(channelIds.size());
+    for (size_t i = 0; i < channelIds.size(); ++i) {
+        const auto& channel = network.getChannels().at(channelIds[i]);
+        if (!channel->isRectangular()) {
+            throw std::invalid_argument("Cannot write channel " + std::to_string(channelIds[i]) + " to binary: Only rectangular channels are supported.");
+        }
+        const auto* rectChannel = static_cast<const arch::RectangularChannel<T>*>(channel.get());
+        channels[i].id = channelIds[i];
+        channels[i].nodeA = channel->getNodeAId();
+        channels[i].nodeB = channel->getNodeBId();
+        channels[i].type = static_cast<uint64_t>(channel->getChannelType());
+        channels[i].height = rectChannel->getHeight();
+        channels[i].width = rectChannel->getWidth();
+        channels[i].length = channel->getLength();
+    }
+    writeBinary(stream, channels);
+
+    // Pumps
+    const auto flowRatePumpIds = sortedKeys(network.getFlowRatePumps());
+    std::vector<PumpRecord<T>> flowRatePumps(flowRatePumpIds.size());
+    for (size_t i = 0; i < flowRatePumpIds.size(); ++i) {
+        const auto& pump = network.getFlowRatePumps().at(flowRatePumpIds[i]);
+        flowRatePumps[i].id = flowRatePumpIds[i];
+        flowRatePumps[i].nodeA = pump->getNodeAId();
+        flowRatePumps[i].nodeB = pump->getNodeBId();
+        flowRatePumps[i].value = pump->getFlowRate();
+    }
+    writeBinary(stream, flowRatePumps);
+
+    const auto pressurePumpIds = sortedKeys(network.getPressurePumps());
+    std::vector<PumpRecord<T>> pressurePumps(pressurePumpIds.size());
+    for (size_t i = 0; i < pressurePumpIds.size(); ++i) {
+        const auto& pump = network.getPressurePumps().at(pressurePumpIds[i]);
+        pressurePumps[i].id = pressurePumpIds[i];
+        pressurePumps[i].nodeA = pump->getNodeAId();
+        pressurePumps[i].nodeB = pump->getNodeBId();
+        pressurePumps[i].value = pump->getPressure();
+    }
+    writeBinary(stream, pressurePumps);
+
+    // Membranes and tanks
+    const auto membraneIds = sortedKeys(network.getMembranes());
+    std::vector<MembraneRecord<T>> membranes(membraneIds.size());
+    for (size_t i = 0; i < membraneIds.size(); ++i) {
+        const auto& membrane = network.getMembranes().at(membraneIds[i]);
+        membranes[i].id = membraneIds[i];
+        membranes[i].channel = membrane->getChannel()->getId();
+        membranes[i].height = membrane->getHeight();
+        membranes[i].width = membrane->getWidth();
+        membranes[i].poreRadius = membrane->getPoreRadius();
+        membranes[i].porosity = membrane->getPorosity();
+    }
+    writeBinary(stream, membranes);
+
+    // A tank is written together with the membrane it lies along
+    std::vector<TankRecord<T>> tanks;
+    for (size_t i = 0; i < membraneIds.size(); ++i) {
+        const auto tank = network.getMembranes().at(membraneIds[i])->getTank();
+        if (tank != nullptr) {
+            tanks.resize(tanks.size() + 1);
+            TankRecord<T>& record = tanks.back();
+            record.id = tank->getId();
+            record.membrane = membraneIds[i];
+            record.height = tank->getHeight();
+            record.width = tank->getWidth();
+        }
+    }
+    writeBinary(stream, tanks);
+
+    // Modules
+    const auto moduleIds = sortedKeys(network.getCfdModules());
+    writeBinary(stream, static_cast<uint64_t>(moduleIds.size()));
+    for (size_t moduleId : moduleIds) {
+        const auto& module = network.getCfdModules().at(moduleId);
+        writeBinary(stream, static_cast<uint64_t>(moduleId));
+        writeBinary(stream, module->getPosition());
+        writeBinary(stream, module->getSize());
+        writeBinary(stream, module->getStlFile());
+        const auto openingIds = sortedKeys(module->getOpenings());
+        writeBinary(stream, static_cast<uint64_t>(openingIds.size()));
+        for (size_t nodeId : openingIds) {
+            const auto& opening = module->getOpenings().at(nodeId);
+            writeBinary(stream, static_cast<uint64_t>(nodeId));
+            writeBinary(stream, opening.normal);
+            writeBinary(stream, opening.width);
+            writeBinary(stream, opening.height);
+        }
+    }
+}
+
+template<typename T>
+std::shared_ptr<arch::Network<T>> networkFromBinary(std::istream& stream) {
+    readBinaryHeader(stream, "MMFT-NETWORK", networkBinaryVersion);
+
+    auto network = arch::Network<T>::createNetwork();
+
+    int64_t virtualNodes;
+    readBinary(stream, virtualNodes);
+
+    std::vector<NodeRecord<T>> nodes;
+    readBinary(stream, nodes);
+    for (auto& node : nodes) {
+        network->addNode(node.id, node.x, node.y, node.ground != 0);
+        if (node.sink != 0) {
+            network->setSink(node.id);
+        }
+    }
+    network->setVirtualNodes(static_cast<int>(virtualNodes));
+
+    std::vector<ChannelRecord<T>> channels;
+    readBinary(stream, channels);
+    for (auto& channel : channels) {
+        network->addRectangularChannel(channel.nodeA, channel.nodeB, channel.height, channel.width, channel.length, static_cast<arch::ChannelType>(channel.type), channel.id);
+    }
+
+    std::vector<PumpRecord<T>> pumps;
+    readBinary(stream, pumps);
+    for (auto& pump : pumps) {
+        network->addFlowRatePump(pump.nodeA, pump.nodeB, pump.value, pump.id);
+    }
+    readBinary(stream, pumps);
+    for (auto& pump : pumps) {
+        network->addPressurePump(pump.nodeA, pump.nodeB, pump.value, pump.id);
+    }
+
+    std::vector<MembraneRecord<T>> membranes;
+    readBinary(stream, membranes);
+    for (auto& membrane : membranes) {
+        network->addMembraneToChannel(membrane.channel, membrane.height, membrane.width, membrane.poreRadius, membrane.porosity, membrane.id);
+    }
+
+    std::vector<TankRecord<T>> tanks;
+    readBinary(stream, tanks);
+    for (auto& tank : tanks) {
+        network->addTankToMembrane(tank.membrane, tank.height, tank.width, tank.id);
+    }
+
+    uint64_t moduleCount;
+    readBinary(stream, moduleCount);
+    for (uint64_t i = 0; i < moduleCount; ++i) {
+        uint64_t moduleId;
+        std::vector<T> position;
+        std::vector<T> size;
+        std::string stlFile;
+        uint64_t openingCount;
+        readBinary(stream, moduleId);
+        readBinary(stream, position);
+        readBinary(stream, size);
+        readBinary(stream, stlFile);
+        readBinary(stream, openingCount);
+        std::unordered_map<size_t, arch::Opening<T>> openings;
+        for (uint64_t j = 0; j < openingCount; ++j) {
+            uint64_t nodeId;
+            std::vector<T> normal;
+            T width;
+            T height;
+            readBinary(stream, nodeId);
+            readBinary(stream, normal);
+            readBinary(stream, width);
+            readBinary(stream, height);
+            openings.try_emplace(nodeId, network->getNode(nodeId), normal, width, height);
+        }
+        network->addCfdModule(position, size, stlFile, openings, moduleId);
+    }
+
+    return network;
+}
+
+template<typename T>
+void simulationToBinary(std::ostream& stream, sim::Simulation<T>* simulation) {
+    if (simulation->getType() != sim::Type::Abstract ||
+        (simulation->getPlatform() != sim::Platform::Continuous &&
+         simulation->getPlatform() != sim::Platform::Droplet &&
+         simulation->getPlatform() != sim::Platform::Concentration)) {
+        throw std::invalid_argument("Cannot write simulation to binary: Only Abstract continuous, droplet and concentration simulations are supported.");
+    }
+
+    writeBinaryHeader(stream, "MMFT-SIMULATION", simulationBinaryVersion);
+    writeBinary(stream, static_cast<int32_t>(simulation->getType()));
+    writeBinary(stream, static_cast<int32_t>(simulation->getPlatform()));
+    writeBinary(stream, static_cast<int32_t>(simulation->getFixtureId()));
+
+    // Settings
+    writeBinary(stream, static_cast<T>(simulation->getWriteInterval()));
+    writeBinary(stream, static_cast<T>(simulation->getTMax()));
+    writeBinary(stream, static_cast<uint64_t>(simulation->getMaxIterations()));
+    writeBinary(stream, static_cast<uint64_t>(simulation->getKeyframeInterval()));
+    writeBinary(stream, static_cast<uint8_t>(simulation->isSampling()));
+    writeBinary(stream, static_cast<uint8_t>(simulation->isProfiling()));
+
+    // Fluids
+    const auto& fluids = simulation->getFluids();
+    writeBinary(stream, static_cast<uint64_t>(fluids.size()));
+    for (size_t fluidId : sortedKeys(fluids)) {
+        const auto& fluid = fluids.at(fluidId);
+        writeBinary(stream, static_cast<uint64_t>(fluidId));
+        writeBinary(stream, fluid->getViscosity());
+        writeBinary(stream, fluid->getDensity());
+        writeBinary(stream, fluid->getName());
+    }
+    try {
+        writeBinary(stream, static_cast<uint64_t>(simulation->getContinuousPhase()->getId()));
+    } catch (const std::out_of_range& e) {
+        throw std::logic_error("Cannot write simulation to binary: The continuous phase is not set.");
+    }
+
+    // Resistance model
+    uint8_t resistanceModel = 0;
+    if (simulation->getResistanceModel() != nullptr) {
+        if (simulation->getResistanceModel()->is1dModel()) {
+            resistanceModel = 1;
+        } else if (simulation->getResistanceModel()->isPoiseuilleModel()) {
+            resistanceModel = 2;
+        }
+    }
+    writeBinary(stream, resistanceModel);
+
+    if (simulation->getPlatform() == sim::Platform::Droplet) {
+        auto* dropletSimulation = dynamic_cast<sim::AbstractDroplet<T>*>(simulation);
+        writeBinary(stream, static_cast<uint8_t>(dropletSimulation->isCoalescing()));
+
+        const auto droplets = dropletSimulation->readDroplets();
+        writeBinary(stream, static_cast<uint64_t>(droplets.size()));
+        for (int dropletId : sortedKeys(droplets)) {
+            const auto* droplet = droplets.at(dropletId);
+            writeBinary(stream, static_cast<uint64_t>(dropletId));
+            writeBinary(stream, static_cast<uint64_t>(droplet->readFluid()->getId()));
+            writeBinary(stream, droplet->getVolume());
+            writeBinary(stream, droplet->getName());
+        }
+
+        const auto& injections = dropletSimulation->getDropletInjections();
+        writeBinary(stream, static_cast<uint64_t>(injections.size()));
+        for (int injectionId : sortedKeys(injections)) {
+            const auto& injection = injections.at(injectionId);
+            writeBinary(stream, static_cast<uint64_t>(injection->getDropletId()));
+            writeBinary(stream, static_cast<uint64_t>(injection->getInjectionChannel()->getId()));
+            writeBinary(stream, injection->getInjectionTime());
+            writeBinary(stream, injection->getInjectionPosition());
+            writeBinary(stream, injection->getName());
+        }
+    } else if (simulation->getPlatform() == sim::Platform::Concentration) {
+        auto* concentrationSimulation = dynamic_cast<sim::ConcentrationSemantics<T>*>(simulation);
+
+        uint8_t mixingModel = 0;
+        if (concentrationSimulation->getMixingModel() != nullptr) {
+            if (concentrationSimulation->getMixingModel()->isInstantaneous()) {
+                mixingModel = 1;
+            } else if (concentrationSimulation->getMixingModel()->isDiffusive()) {
+                mixingModel = 2;
+            }
+        }
+        writeBinary(stream, mixingModel);
+
+        const auto& species = concentrationSimulation->getSpecies();
+        writeBinary(stream, static_cast<uint64_t>(species.size()));
+        for (size_t specieId : sortedKeys(species)) {
+            const auto& specie = species.at(specieId);
+            writeBinary(stream, static_cast<uint64_t>(specieId));
+            writeBinary(stream, specie->getDiffusivity());
+            writeBinary(stream, specie->getSatConc());
+            writeBinary(stream, specie->getName());
+        }
+
+        const auto mixtures = concentrationSimulation->readMixtures();
+        writeBinary(stream, static_cast<uint64_t>(mixtures.size()));
+        for (size_t mixtureId : sortedKeys(mixtures)) {
+            const auto* mixture = mixtures.at(mixtureId);
+            if (mixture->isDiffusive() && !static_cast<const sim::DiffusiveMixture<T>*>(mixture)->getIsConstant()) {
+                throw std::invalid_argument("Cannot write mixture " + std::to_string(mixtureId) + " to binary: Mixtures with a concentration profile are not supported.");
+            }
+            writeBinary(stream, static_cast<uint64_t>(mixtureId));
+            writeBinary(stream, static_cast<uint8_t>(mixture->isDiffusive()));
+            writeBinary(stream, mixture->getName());
+            const auto& concentrations = mixture->getSpecieConcentrations();
+            writeBinary(stream, static_cast<uint64_t>(concentrations.size()));
+            for (size_t specieId : sortedKeys(concentrations)) {
+                writeBinary(stream, static_cast<uint64_t>(specieId));
+                writeBinary(stream, concentrations.at(specieId));
+            }
+        }
+
+        // Non-permanent and permanent injections, each preceded by their count
+        for (const auto* injections : { &concentrationSimulation->getMixtureInjections(), &concentrationSimulation->getPermanentMixtureInjections() }) {
+            writeBinary(stream, static_cast<uint64_t>(injections->size()));
+            for (size_t injectionId : sortedKeys(*injections)) {
+                const auto& injection = injections->at(injectionId);
+                writeBinary(stream, static_cast<uint64_t>(injection->getMixtureId()));
+                writeBinary(stream, static_cast<uint64_t>(injection->getInjectionChannel()->getId()));
+                writeBinary(stream, injection->getInjectionTime());
+                writeBinary(stream, injection->getName());
+            }
+        }
+    }
+}
+
+template<typename T>
+std::unique_ptr<sim::Simulation<T>> simulationFromBinary(std::istream& stream, std::shared_ptr<arch::Network<T>> network) {
+    readBinaryHeader(stream, "MMFT-SIMULATION", simulationBinaryVersion);
+
+    int32_t type;
+    int32_t platform;
+    int32_t fixtureId;
+    readBinary(stream, type);
+    readBinary(stream, platform);
+    readBinary(stream, fixtureId);
+
+    std::unique_ptr<sim::Simulation<T>> simPtr = nullptr;
+    if (static_cast<sim::Type>(type) != sim::Type::Abstract) {
+        throw std::runtime_error("Cannot read simulation from binary: Only Abstract simulations are supported.");
+    }
+    if (static_cast<sim::Platform>(platform) == sim::Platform::Continuous) {
+        simPtr = std::make_unique<sim::AbstractContinuous<T>>(network);
+    } else if (static_cast<sim::Platform>(platform) == sim::Platform::Droplet) {
+        simPtr = std::make_unique<sim::AbstractDroplet<T>>(network);
+    } else if (static_cast<sim::Platform>(platform) == sim::Platform::Concentration) {
+        simPtr = std::make_unique<sim::AbstractConcentration<T>>(network);
+    } else {
+        throw std::runtime_error("Cannot read simulation from binary: Invalid platform.");
+    }
+    simPtr->setFixtureId(fixtureId);
+
+    // Settings
+    T writeInterval;
+    T tMax;
+    uint64_t maxIterations;
+    uint64_t keyframeInterval;
+    uint8_t sampling;
+    uint8_t profiling;
+    readBinary(stream, writeInterval);
+    readBinary(stream, tMax);
+    readBinary(stream, maxIterations);
+    readBinary(stream, keyframeInterval);
+    readBinary(stream, sampling);
+    readBinary(stream, profiling);
+    simPtr->setWriteInterval(writeInterval);
+    simPtr->setMaxEndTime(tMax);
+    simPtr->setMaxIterations(maxIterations);
+    simPtr->setKeyframeInterval(keyframeInterval);
+    simPtr->setSampling(sampling != 0);
+    simPtr->setProfiling(profiling != 0);
+
+    // Fluids receive new ids, which are looked up by their old ids
+    std::unordered_map<size_t, size_t> fluidIds;
+    uint64_t fluidCount;
+    readBinary(stream, fluidCount);
+    for (uint64_t i = 0; i < fluidCount; ++i) {
+        uint64_t fluidId;
+        T viscosity;
+        T density;
+        std::string name;
+        readBinary(stream, fluidId);
+        readBinary(stream, viscosity);
+        readBinary(stream, density);
+        readBinary(stream, name);
+        auto fluid = simPtr->addFluid(viscosity, density);
+        fluid->setName(name);
+        fluidIds.try_emplace(fluidId, fluid->getId());
+    }
+    uint64_t continuousPhase;
+    readBinary(stream, continuousPhase);
+    simPtr->setContinuousPhase(fluidIds.at(continuousPhase));
+
+    uint8_t resistanceModel;
+    readBinary(stream, resistanceModel);
+    if (resistanceModel == 1) {
+        simPtr->set1DResistanceModel();
+    } else if (resistanceModel == 2) {
+        simPtr->setPoiseuilleResistanceModel();
+    }
+
+    if (static_cast<sim::Platform>(platform) == sim::Platform::Droplet) {
+        auto* dropletSimulation = dynamic_cast<sim::AbstractDroplet<T>*>(simPtr.get());
+        uint8_t coalescing;
+        readBinary(stream, coalescing);
+        dropletSimulation->setCoalescing(coalescing != 0);
+
+        std::unordered_map<size_t, size_t> dropletIds;
+        uint64_t dropletCount;
+        readBinary(stream, dropletCount);
+        for (uint64_t i = 0; i < dropletCount; ++i) {
+            uint64_t dropletId;
+            uint64_t fluidId;
+            T volume;
+            std::string name;
+            readBinary(stream, dropletId);
+            readBinary(stream, fluidId);
+            readBinary(stream, volume);
+            readBinary(stream, name);
+            auto droplet = dropletSimulation->addDroplet(fluidIds.at(fluidId), volume);
+            droplet->setName(name);
+            dropletIds.try_emplace(dropletId, droplet->getId());
+        }
+
+        uint64_t injectionCount;
+        readBinary(stream, injectionCount);
+        for (uint64_t i = 0; i < injectionCount; ++i) {
+            uint64_t dropletId;
+            uint64_t channelId;
+            T injectionTime;
+            T injectionPosition;
+            std::string name;
+            readBinary(stream, dropletId);
+            readBinary(stream, channelId);
+            readBinary(stream, injectionTime);
+            readBinary(stream, injectionPosition);
+            readBinary(stream, name);
+            auto injection = dropletSimulation->addDropletInjection(dropletIds.at(dropletId), injectionTime, channelId, injectionPosition);
+            injection->setName(name);
+        }
+    } else if (static_cast<sim::Platform>(platform) == sim::Platform::Concentration) {
+        auto* concentrationSimulation = dynamic_cast<sim::ConcentrationSemantics<T>*>(simPtr.get());
+        uint8_t mixingModel;
+        readBinary(stream, mixingModel);
+        if (mixingModel == 1) {
+            concentrationSimulation->setInstantaneousMixingModel();
+        } else if (mixingModel == 2) {
+            concentrationSimulation->setDiffusiveMixingModel();
+        }
+
+        std::unordered_map<size_t, std::shared_ptr<sim::Specie<T>>> species;
+        uint64_t specieCount;
+        readBinary(stream, specieCount);
+        for (uint64_t i = 0; i < specieCount; ++i) {
+            uint64_t specieId;
+            T diffusivity;
+            T satConc;
+            std::string name;
+            readBinary(stream, specieId);
+            readBinary(stream, diffusivity);
+            readBinary(stream, satConc);
+            readBinary(stream, name);
+            auto specie = concentrationSimulation->addSpecie(diffusivity, satConc);
+            specie->setName(name);
+            species.try_emplace(specieId, specie);
+        }
+
+        std::unordered_map<size_t, size_t> mixtureIds;
+        uint64_t mixtureCount;
+        readBinary(stream, mixtureCount);
+        for (uint64_t i = 0; i < mixtureCount; ++i) {
+            uint64_t mixtureId;
+            uint8_t diffusive;
+            std::string name;
+            uint64_t concentrationCount;
+            readBinary(stream, mixtureId);
+            readBinary(stream, diffusive);
+            readBinary(stream, name);
+            readBinary(stream, concentrationCount);
+            std::vector<std::shared_ptr<sim::Specie<T>>> mixtureSpecies;
+            std::vector<T> concentrations;
+            for (uint64_t j = 0; j < concentrationCount; ++j) {
+                uint64_t specieId;
+                T concentration;
+                readBinary(stream, specieId);
+                readBinary(stream, concentration);
+                mixtureSpecies.push_back(species.at(specieId));
+                concentrations.push_back(concentration);
+            }
+            auto mixture = (diffusive != 0) ? concentrationSimulation->addDiffusiveMixture(mixtureSpecies, concentrations)
+                                            : concentrationSimulation->addMixture(mixtureSpecies, concentrations);
+            mixture->setName(name);
+            mixtureIds.try_emplace(mixtureId, mixture->getId());
+        }
+
+        for (bool isPermanent : { false, true }) {
+            uint64_t injectionCount;
+            readBinary(stream, injectionCount);
+            for (uint64_t i = 0; i < injectionCount; ++i) {
+                uint64_t mixtureId;
+                uint64_t channelId;
+                T injectionTime;
+                std::string name;
+                readBinary(stream, mixtureId);
+                readBinary(stream, channelId);
+                readBinary(stream, injectionTime);
+                readBinary(stream, name);
+                auto injection = concentrationSimulation->addMixtureInjection(mixtureIds.at(mixtureId), channelId, injectionTime, isPermanent);
+                injection->setName(name);
+            }
+        }
+    }
+
+    return simPtr;
+}
+
+template<typename T>
+std::string networkAndSimulationToBinary(sim::Simulation<T>* simulation) {
+    std::ostringstream stream(std::ios::binary);
+    networkToBinary(stream, *simulation->getNetwork());
+    simulationToBinary(stream, simulation);
+    return stream.str();
+}
+
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> networkAndSimulationFromBinary(const std::string& binary) {
+    std::istringstream stream(binary, std::ios::binary);
+    auto network = networkFromBinary<T>(stream);
+    auto simulation = simulationFromBinary<T>(stream, network);
+    return { network, std::move(simulation) };
+}
+
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> cloneNetworkAndSimulation(sim::Simulation<T>* simulation) {
+    auto network = simulation->getNetwork()->clone();
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    simulationToBinary(stream, simulation);
+    auto copy = simulationFromBinary<T>(stream, network);
+    return { network, std::move(copy) };
+}
+
+template<typename T>
+void assertBinaryResult(const sim::Simulation<T>* simulation) {
+    if (simulation->getPlatform() != sim::Platform::Continuous) {
+        throw std::invalid_argument("Cannot write the results to binary: Only the results of continuous simulations are supported, "
+            "the droplet and mixture positions of other platforms must be written to JSON.");
+    }
+}
+
+template<typename T>
+void resultToBinary(std::ostream& stream, sim::Simulation<T>* simulation) {
+    assertBinaryResult(simulation);
+    auto table = simulation->getResults()->getStateTable();
+    writeBinaryHeader(stream, "MMFT-RESULT", resultBinaryVersion);
+    writeBinary(stream, table->times);
+    writeBinary(stream, table->nodeIds);
+    writeBinary(stream, table->edgeIds);
+    writeBinary(stream, table->pressures);
+    writeBinary(stream, table->flowRates);
+}
+
+template<typename T>
+void resultToBinary(std::string binaryFile, sim::Simulation<T>* simulation) {
+    assertBinaryResult(simulation);
+    std::ofstream file(binaryFile, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Could not open " + binaryFile + ".");
+    }
+    resultToBinary(file, simulation);
+    if (!file) {
+        throw std::runtime_error("Could not write " + binaryFile + ".");
+    }
+}
+
+template<typename T>
+result::StateTable<T> resultFromBinary(std::istream& stream) {
+    result::StateTable<T> table;
+    readBinaryHeader(stream, "MMFT-RESULT", resultBinaryVersion);
+    readBinary(stream, table.times);
+    readBinary(stream, table.nodeIds);
+    readBinary(stream, table.edgeIds);
+    readBinary(stream, table.pressures);
+    readBinary(stream, table.flowRates);
+    if (table.pressures.size() != table.times.size() * table.nodeIds.size() || table.flowRates.size() != table.times.size() * table.edgeIds.size()) {
+        throw std::runtime_error("Inconsistent dimensions of binary result.");
+    }
+    return table;
+}
+
+}   // namespace porting
@@ -0,0 +1,102 @@
+/**
+ * @file binaryStreams.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace porting {
+
+/**
+ * @brief Write a trivially copyable value to a binary stream.
+ * @param[in] stream The binary output stream.
+ * @param[in] value The value that is written.
+ */
+template<typename V>
+void writeBinary(std::ostream& stream, const V& value);
+
+/**
+ * @brief Write a string to a binary stream, prefixed by its length.
+ * @param[in] stream The binary output stream.
+ * @param[in] value The string that is written.
+ */
+template<typename C>
+void writeBinary(std::ostream& stream, const std::basic_string<C>& value);
+
+/**
+ * @brief Write a vector to a binary stream, prefixed by its length.
+ * @param[in] stream The binary output stream.
+ * @param[in] value The vector that is written.
+ */
+template<typename V>
+void writeBinary(std::ostream& stream, const std::vector<V>& value);
+
+/**
+ * @brief Write an unordered map to a binary stream, prefixed by its size.
+ * @param[in] stream The binary output stream.
+ * @param[in] value The map that is written.
+ */
+template<typename K, typename V>
+void writeBinary(std::ostream& stream, const std::unordered_map<K, V>& value);
+
+/**
+ * @brief Read a trivially copyable value from a binary stream.
+ * @param[in] stream The binary input stream.
+ * @param[out] value The value that is read.
+ * @throws runtime_error if the stream ends prematurely.
+ */
+template<typename V>
+void readBinary(std::istream& stream, V& value);
+
+/**
+ * @brief Read a length-prefixed string from a binary stream.
+ * @param[in] stream The binary input stream.
+ * @param[out] value The string that is read.
+ * @throws runtime_error if the stream ends prematurely.
+ */
+template<typename C>
+void readBinary(std::istream& stream, std::basic_string<C>& value);
+
+/**
+ * @brief Read a length-prefixed vector from a binary stream.
+ * @param[in] stream The binary input stream.
+ * @param[out] value The vector that is read.
+ * @throws runtime_error if the stream ends prematurely.
+ */
+template<typename V>
+void readBinary(std::istream& stream, std::vector<V>& value);
+
+/**
+ * @brief Read a size-prefixed unordered map from a binary stream. The map is cleared before reading.
+ * @param[in] stream The binary input stream.
+ * @param[out] value The map that is read.
+ * @throws runtime_error if the stream ends prematurely.
+ */
+template<typename K, typename V>
+void readBinary(std::istream& stream, std::unordered_map<K, V>& value);
+
+/**
+ * @brief Write the header of a binary file, consisting of a magic string and a format version.
+ * @param[in] stream The binary output stream.
+ * @param[in] magic The magic string that identifies the file type.
+ * @param[in] version The version of the file format.
+ */
+inline void writeBinaryHeader(std::ostream& stream, const std::string& magic, uint32_t version);
+
+/**
+ * @brief Read and check the header of a binary file.
+ * @param[in] stream The binary input stream.
+ * @param[in] magic The expected magic string.
+ * @param[in] version The expected version of the file format.
+ * @throws runtime_error if the magic string or version do not match.
+ */
+inline void readBinaryHeader(std::istream& stream, const std::string& magic, uint32_t version);
+
+}   // namespace porting
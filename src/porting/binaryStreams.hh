@@ -0,0 +1,109 @@
+#include "binaryStreams.h"
+
+namespace porting {
+
+template<typename V>
+void writeBinary(std::ostream& stream, const V& value) {
+    static_assert(std::is_trivially_copyable<V>::value, "Only trivially copyable types can be written as raw binary.");
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(V));
+}
+
+template<typename C>
+void writeBinary(std::ostream& stream, const std::basic_string<C>& value) {
+    writeBinary(stream, static_cast<uint64_t>(value.size()));
+    stream.write(reinterpret_cast<const char*>(value.data()), value.size()*sizeof(C));
+}
+
+template<typename V>
+void writeBinary(std::ostream& stream, const std::vector<V>& value) {
+    writeBinary(stream, static_cast<uint64_t>(value.size()));
+    if constexpr (std::is_trivially_copyable<V>::value) {
+        stream.write(reinterpret_cast<const char*>(value.data()), value.size()*sizeof(V));
+    } else {
+        for (auto& element : value) {
+            writeBinary(stream, element);
+        }
+    }
+}
+
+template<typename K, typename V>
+void writeBinary(std::ostream& stream, const std::unordered_map<K, V>& value) {
+    writeBinary(stream, static_cast<uint64_t>(value.size()));
+    for (auto& [key, element] : value) {
+        writeBinary(stream, key);
+        writeBinary(stream, element);
+    }
+}
+
+template<typename V>
+void readBinary(std::istream& stream, V& value) {
+    static_assert(std::is_trivially_copyable<V>::value, "Only trivially copyable types can be read as raw binary.");
+    stream.read(reinterpret_cast<char*>(&value), sizeof(V));
+    if (!stream) {
+        throw std::runtime_error("Unexpected end of binary stream.");
+    }
+}
+
+template<typename C>
+void readBinary(std::istream& stream, std::basic_string<C>& value) {
+    uint64_t size = 0;
+    readBinary(stream, size);
+    value.resize(size);
+    stream.read(reinterpret_cast<char*>(value.data()), size*sizeof(C));
+    if (!stream) {
+        throw std::runtime_error("Unexpected end of binary stream.");
+    }
+}
+
+template<typename V>
+void readBinary(std::istream& stream, std::vector<V>& value) {
+    uint64_t size = 0;
+    readBinary(stream, size);
+    value.resize(size);
+    if constexpr (std::is_trivially_copyable<V>::value) {
+        stream.read(reinterpret_cast<char*>(value.data()), size*sizeof(V));
+        if (!stream) {
+            throw std::runtime_error("Unexpected end of binary stream.");
+        }
+    } else {
+        for (auto& element : value) {
+            readBinary(stream, element);
+        }
+    }
+}
+
+template<typename K, typename V>
+void readBinary(std::istream& stream, std::unordered_map<K, V>& value) {
+    uint64_t size = 0;
+    readBinary(stream, size);
+    value.clear();
+    value.reserve(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        K key;
+        V element;
+        readBinary(stream, key);
+        readBinary(stream, element);
+        value.insert_or_assign(key, std::move(element));
+    }
+}
+
+inline void writeBinaryHeader(std::ostream& stream, const std::string& magic, uint32_t version) {
+    writeBinary(stream, magic);
+    writeBinary(stream, version);
+}
+
+inline void readBinaryHeader(std::istream& stream, const std::string& magic, uint32_t version) {
+    std::string readMagic;
+    uint32_t readVersion = 0;
+    readBinary(stream, readMagic);
+    readBinary(stream, readVersion);
+    if (readMagic != magic) {
+        throw std::runtime_error("Binary file is not of the expected type " + magic + ".");
+    }
+    if (readVersion != version) {
+        throw std::runtime_error("Binary file of type " + magic + " has version " + std::to_string(readVersion) + 
+            ", but version " + std::to_string(version) + " is expected.");
+    }
+}
+
+}   // namespace porting
@@ -4,14 +4,26 @@
 
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
 #include <unordered_map>
 #include <vector>
 
 #include "nlohmann/json.hpp"
 
+#include "binaryPorter.h"
+#include "../simulation/simulators/SimulationPool.h"
+
 namespace arch {
 
 // Forward declared dependencies
@@ -30,6 +42,13 @@ class Simulation;
 
 namespace porting {
 
+/**
+ * @brief Reads a JSON file into memory and parses it
+ * @param[in] jsonFile Location of the json file
+ * @returns json parsed json string
+*/
+inline nlohmann::json parseJSONFile(const std::string& jsonFile);
+
 /**
  * @brief Constructor of the Network from a JSON file
  * @param[in] jsonFile Location of the json file
@@ -53,7 +72,7 @@ void networkFromJSON(std::string jsonFile, std::shared_ptr<arch::Network<T>>& ne
  * @returns Network network
 */
 template<typename T>
-std::shared_ptr<arch::Network<T>> networkFromJSON(nlohmann::json jsonString);
+std::shared_ptr<arch::Network<T>> networkFromJSON(const nlohmann::json& jsonString);
 
 /**
  * @brief Constructor of the Simulation from a JSON file
@@ -71,15 +90,98 @@ std::unique_ptr<sim::Simulation<T>> simulationFromJSON(std::string jsonFile, std
  * @returns unique_ptr<sim::Simulation<T>> simulation
 */
 template<typename T>
-std::unique_ptr<sim::Simulation<T>> simulationFromJSON(nlohmann::json jsonString, std::shared_ptr<arch::Network<T>> network);
+std::unique_ptr<sim::Simulation<T>> simulationFromJSON(const nlohmann::json& jsonString, std::shared_ptr<arch::Network<T>> network);
 
 /**
- * @brief Generates a json string of the simulation results and writes it in the provided location
+ * @brief Constructor of the Simulation of a given fixture from a JSON string. The active fixture of the JSON string
+ * is ignored.
+ * @param[in] json json string
+ * @param[in] network pointer to the network on which the simulation acts
+ * @param[in] fixtureId id of the fixture that is simulated
+ * @returns unique_ptr<sim::Simulation<T>> simulation
+ * @throws invalid_argument if the fixture does not exist
+*/
+template<typename T>
+std::unique_ptr<sim::Simulation<T>> simulationFromJSON(const nlohmann::json& jsonString, std::shared_ptr<arch::Network<T>> network, size_t fixtureId);
+
+/**
+ * @brief Constructor of the Network and the Simulation from a single JSON file. The file is read and parsed only
+ * once and all readers work on the same parsed document.
+ * @param[in] jsonFile Location of the json file
+ * @returns Pair of the network and the simulation that acts on the network
+*/
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> networkAndSimulationFromJSON(std::string jsonFile);
+
+/**
+ * @brief Constructor of the Network and the Simulation from a JSON string
+ * @param[in] jsonString json string
+ * @returns Pair of the network and the simulation that acts on the network
+*/
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> networkAndSimulationFromJSON(const nlohmann::json& jsonString);
+
+/**
+ * @brief Constructor of a Network and a Simulation for each fixture of a single JSON file. The file is read and
+ * parsed only once.
+ * @param[in] jsonFile Location of the json file
+ * @returns Pairs of the network and the simulation of each fixture, in the order of the fixtures
+*/
+template<typename T>
+std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>> fixturesFromJSON(std::string jsonFile);
+
+/**
+ * @brief Constructor of a Network and a Simulation for each fixture of a JSON string. The network definition is read
+ * once and copied for each fixture, because the pumps and the simulation modify the network. The simulations are
+ * therefore independent and can be simulated concurrently, see sim::simulateConcurrently.
+ * @param[in] jsonString json string
+ * @returns Pairs of the network and the simulation of each fixture, in the order of the fixtures
+*/
+template<typename T>
+std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>> fixturesFromJSON(const nlohmann::json& jsonString);
+
+/**
+ * @brief Generates a json string of the results of the simulations of several fixtures and writes it in the provided
+ * location. The results are streamed to the file, see fixturesResultToJSON(std::ostream&, ...).
+ * @param[in] jsonFile location at which the json string should be written
+ * @param[in] fixtures pairs of the network and the simulation of each fixture
+ * @param[in] threads number of threads that dump the states of a fixture, 0 selects the number of hardware threads
+ * @throws runtime_error if the file cannot be opened
+*/
+template<typename T>
+void fixturesResultToJSON(std::string jsonFile, const std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>>& fixtures, size_t threads = 1);
+
+/**
+ * @brief Writes the json string of the results of the simulations of several fixtures to a stream, one fixture after
+ * the other, without constructing the json object of all results. The output is identical to
+ * fixturesResultToJSON(fixtures).dump(4).
+ * @param[in] stream the output stream
+ * @param[in] fixtures pairs of the network and the simulation of each fixture
+ * @param[in] threads number of threads that dump the states of a fixture, 0 selects the number of hardware threads
+*/
+template<typename T>
+void fixturesResultToJSON(std::ostream& stream, const std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>>& fixtures, size_t threads = 1);
+
+/**
+ * @brief Constructor of a json string of the results of the simulations of several fixtures. The results of each
+ * fixture are stored as by resultToJSON, in the order of the fixtures.
+ * @param[in] fixtures pairs of the network and the simulation of each fixture
+ * @returns ordered_json json string
+*/
+template<typename T>
+nlohmann::ordered_json fixturesResultToJSON(const std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>>& fixtures);
+
+/**
+ * @brief Generates a json string of the simulation results and writes it in the provided location. The states are
+ * written in chunks, see resultToJSON(std::ostream&, sim::Simulation<T>*, size_t, size_t).
  * @param[in] jsonFile location at which the json string should be written
  * @param[in] simulation pointer to the simulation of which the results must be stored
+ * @param[in] threads number of threads that dump the states, 0 selects the number of hardware threads. By default, the
+ * states are dumped by the calling thread.
+ * @throws runtime_error if the file cannot be opened
 */
 template<typename T>
-void resultToJSON(std::string jsonFile, sim::Simulation<T>* simulation);
+void resultToJSON(std::string jsonFile, sim::Simulation<T>* simulation, size_t threads = 1);
 
 /**
  * @brief Generates a json string of the simulation results and writes it in the provided location
@@ -89,6 +191,22 @@ void resultToJSON(std::string jsonFile, sim::Simulation<T>* simulation);
 template<typename T>
 inline void resultToJSON(std::string jsonFile, const std::unique_ptr<sim::Simulation<T>>& simulation) { resultToJSON(jsonFile, simulation.get()); }
 
+/**
+ * @brief Writes the json string of the simulation results to a stream, without constructing the json object of all
+ * results. The states are dumped in chunks of consecutive states by a pool of worker threads, while the calling thread
+ * writes the dumped chunks in order. At most two chunks per worker are held in memory. The output is identical to
+ * resultToJSON(simulation).dump(4).
+ * @param[in] stream the output stream
+ * @param[in] simulation pointer to the simulation of which the results must be stored
+ * @param[in] threads number of threads that dump the states, 0 selects the number of hardware threads. By default, the
+ * states are dumped by the calling thread.
+ * @param[in] chunkSize number of states per chunk
+ * @param[in] indent number of spaces by which all lines but the first are indented, to nest the result in an
+ * enclosing json string
+*/
+template<typename T>
+void resultToJSON(std::ostream& stream, sim::Simulation<T>* simulation, size_t threads = 1, size_t chunkSize = 64, size_t indent = 0);
+
 /**
  * @brief Constructor of a json string of the simulation results
  * @param[in] simulation pointer to the simulation of which the results must be stored
@@ -5,16 +5,25 @@ namespace porting {
 using json = nlohmann::json;
 using ordered_json = nlohmann::ordered_json;
 
+inline json parseJSONFile(const std::string& jsonFile) {
+    // Read the whole file at once, parsing from contiguous memory is considerably
+    // faster than parsing from the stream character by character
+    std::ifstream f(jsonFile, std::ios::binary);
+    if (!f) {
+        throw std::runtime_error("Could not open " + jsonFile + ".");
+    }
+    std::string content((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    try {
+        return json::parse(content);
+    } catch (json::parse_error& e) {
+        throw std::runtime_error(std::string(__func__) + " in file " + __FILE__ + ", line " + std::to_string(__LINE__) + ": Could not read provided json file " + jsonFile + ". " + e.what());
+    }
+}
+
 template<typename T>
 std::shared_ptr<arch::Network<T>> networkFromJSON(std::string jsonFile) {
-    json jsonString;
     // Transform given path to jsonFile into json object
-    try {
-        std::ifstream f(jsonFile);
-        jsonString = json::parse(f);
-    } catch (std::exception& e) {
-        throw std::runtime_error(std::string(__func__) + " in file " + __FILE__ + ", line " + std::to_string(__LINE__) + ": Could not read provided json file.");
-    }
+    json jsonString = parseJSONFile(jsonFile);
     // Forward json object to networkFromJSON overload and 
     // return network object
     return networkFromJSON<T>(jsonString);
@@ -22,10 +31,9 @@ std::shared_ptr<arch::Network<T>> networkFromJSON(std::string jsonFile) {
 
 template<typename T>
 void networkFromJSON(std::string jsonFile, std::shared_ptr<arch::Network<T>>& network) {
+    // Transform given path to jsonFile into json object
+    json jsonString = parseJSONFile(jsonFile);
     try {
-        // Transform given path to jsonFile into json object
-        std::ifstream f(jsonFile);
-        json jsonString = json::parse(f);
         // Read network components
         readNodes(jsonString, *network);
         readChannels(jsonString, *network);
@@ -36,7 +44,7 @@ void networkFromJSON(std::string jsonFile, std::shared_ptr<arch::Network<T>>& ne
 }
 
 template<typename T>
-std::shared_ptr<arch::Network<T>> networkFromJSON(json jsonString) {
+std::shared_ptr<arch::Network<T>> networkFromJSON(const json& jsonString) {
 
     auto network = arch::Network<T>::createNetwork();
 
@@ -50,27 +58,29 @@ std::shared_ptr<arch::Network<T>> networkFromJSON(json jsonString) {
 
 template<typename T>
 std::unique_ptr<sim::Simulation<T>> simulationFromJSON(std::string jsonFile, std::shared_ptr<arch::Network<T>> network_) {
-    json jsonString;
     // Transform given path to jsonFile into json object
-    try {
-        std::ifstream f(jsonFile);
-        jsonString = json::parse(f);
-    } catch (std::exception& e) {
-        throw std::runtime_error(std::string(__func__) + " in file " + __FILE__ + ", line " + std::to_string(__LINE__) + ": Could not read provided json file.");
-    }
+    json jsonString = parseJSONFile(jsonFile);
     // Forward json object to simulationFromJSON overload and 
     // return unique_ptr to simulation object
     return simulationFromJSON<T>(jsonString, network_);
 }
 
 template<typename T>
-std::unique_ptr<sim::Simulation<T>> simulationFromJSON(json jsonString, std::shared_ptr<arch::Network<T>> network_) {
+std::unique_ptr<sim::Simulation<T>> simulationFromJSON(const json& jsonString, std::shared_ptr<arch::Network<T>> network_) {
+    return simulationFromJSON<T>(jsonString, network_, readActiveFixture<T>(jsonString));
+}
+
+template<typename T>
+std::unique_ptr<sim::Simulation<T>> simulationFromJSON(const json& jsonString, std::shared_ptr<arch::Network<T>> network_, size_t activeFixture) {
+
+    if (activeFixture >= readFixtureCount<T>(jsonString)) {
+        throw std::invalid_argument("The fixture " + std::to_string(activeFixture) + " does not exist.");
+    }
 
     std::unique_ptr<sim::Simulation<T>> simPtr = nullptr;
 
     sim::Platform platform = readPlatform<T>(jsonString);
     sim::Type simType = readType<T>(jsonString);
-    size_t activeFixture = readActiveFixture<T>(jsonString);
 
     // Read an Abstract simulation definition
     if (simType == sim::Type::Abstract) {
@@ -175,41 +185,246 @@ std::unique_ptr<sim::Simulation<T>> simulationFromJSON(json jsonString, std::sha
 }
 
 template<typename T>
-void resultToJSON(std::string jsonFile, sim::Simulation<T>* simulation) {
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> networkAndSimulationFromJSON(std::string jsonFile) {
+    // Transform given path to jsonFile into json object, which is shared by all readers
+    json jsonString = parseJSONFile(jsonFile);
+    return networkAndSimulationFromJSON<T>(jsonString);
+}
+
+template<typename T>
+std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>> networkAndSimulationFromJSON(const json& jsonString) {
+    std::shared_ptr<arch::Network<T>> network = networkFromJSON<T>(jsonString);
+    std::unique_ptr<sim::Simulation<T>> simulation = simulationFromJSON<T>(jsonString, network);
+    return { std::move(network), std::move(simulation) };
+}
+
+template<typename T>
+std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>> fixturesFromJSON(std::string jsonFile) {
+    // Transform given path to jsonFile into json object, which is shared by all fixtures
+    json jsonString = parseJSONFile(jsonFile);
+    return fixturesFromJSON<T>(jsonString);
+}
+
+template<typename T>
+std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>> fixturesFromJSON(const json& jsonString) {
+    std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>> fixtures;
+    std::shared_ptr<arch::Network<T>> base = networkFromJSON<T>(jsonString);
+    size_t fixtureCount = readFixtureCount<T>(jsonString);
+    fixtures.reserve(fixtureCount);
+    for (size_t fixtureId = 0; fixtureId < fixtureCount; ++fixtureId) {
+        // The last fixture takes the network that was read, all others act on a copy of it
+        std::shared_ptr<arch::Network<T>> network = (fixtureId + 1 < fixtureCount) ? base->clone() : base;
+        std::unique_ptr<sim::Simulation<T>> simulation = simulationFromJSON<T>(jsonString, network, fixtureId);
+        fixtures.emplace_back(std::move(network), std::move(simulation));
+    }
+    return fixtures;
+}
+
+template<typename T>
+void fixturesResultToJSON(std::string jsonFile, const std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>>& fixtures, size_t threads) {
     std::ofstream file(jsonFile);
+    if (!file) {
+        throw std::runtime_error("Could not open " + jsonFile + ".");
+    }
 
-    ordered_json jsonString = resultToJSON<T>(simulation);
+    fixturesResultToJSON<T>(file, fixtures, threads);
 
-    file << jsonString.dump(4) << std::endl;
+    file << std::endl;
 }
 
 template<typename T>
-nlohmann::ordered_json resultToJSON(sim::Simulation<T>* simulation) {
+void fixturesResultToJSON(std::ostream& stream, const std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>>& fixtures, size_t threads) {
+    if (fixtures.empty()) {
+        stream << "{\n    \"fixtures\": []\n}";
+        return;
+    }
+    // The result of each fixture is streamed at its level in the array, i.e., indented by 8 spaces
+    stream << "{\n    \"fixtures\": [\n";
+    for (size_t i = 0; i < fixtures.size(); ++i) {
+        stream << "        ";
+        resultToJSON<T>(stream, fixtures[i].second.get(), threads, 64, 8);
+        stream << ((i + 1 < fixtures.size()) ? ",\n" : "\n");
+    }
+    stream << "    ]\n}";
+}
 
-    auto jsonResult = ordered_json::object();
-    auto jsonStates = ordered_json::array();
+template<typename T>
+nlohmann::ordered_json fixturesResultToJSON(const std::vector<std::pair<std::shared_ptr<arch::Network<T>>, std::unique_ptr<sim::Simulation<T>>>>& fixtures) {
+    auto jsonFixtures = ordered_json::array();
+    for (auto const& [network, simulation] : fixtures) {
+        jsonFixtures.push_back(resultToJSON<T>(simulation.get()));
+    }
+    ordered_json jsonResult;
+    jsonResult["fixtures"] = std::move(jsonFixtures);
+    return jsonResult;
+}
 
-    for (auto const& state : simulation->getResults()->getStates()) {
-        auto jsonState = ordered_json::object();
-        jsonState["time"] = state->getTime();
-        jsonState["nodes"] = writePressures(state.get());
-        jsonState["channels"] = writeChannels(simulation->getNetwork().get(), state.get());
-        if (simulation->getPlatform() == sim::Platform::Continuous && simulation->getType() == sim::Type::Hybrid) {
-            jsonState["modules"] = writeModules(state.get());
+template<typename T>
+void resultToJSON(std::string jsonFile, sim::Simulation<T>* simulation, size_t threads) {
+    std::ofstream file(jsonFile);
+    if (!file) {
+        throw std::runtime_error("Could not open " + jsonFile + ".");
+    }
+
+    resultToJSON<T>(file, simulation, threads);
+
+    file << std::endl;
+}
+
+template<typename T>
+void resultToJSON(std::ostream& stream, sim::Simulation<T>* simulation, size_t threads, size_t chunkSize, size_t indent) {
+    auto const& states = simulation->getResults()->getStates();
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    const std::string outer(indent, ' ');
+    const std::string inner(indent + 8, ' ');
+    auto appendIndented = [](std::string& buffer, const std::string& json, const std::string& padding) {
+        for (char c : json) {
+            buffer += c;
+            if (c == '\n') {
+                buffer += padding;
+            }
+        }
+    };
+
+    // The states are the last member, the other members are written as they are dumped, without the closing brace
+    std::string header = writeResultHeader<T>(simulation).dump(4);
+    header.resize(header.size() - 2);
+    std::string indentedHeader;
+    appendIndented(indentedHeader, header, outer);
+    stream << indentedHeader << ",\n" << outer << "    \"network\": ";
+    if (states.empty()) {
+        stream << "[]\n" << outer << "}";
+        return;
+    }
+    stream << "[\n";
+
+    // Each state is dumped separately and indented to its level in the result, i.e., by 8 spaces. The pressures and
+    // flow rates are reconstructed once per chunk and then walked forward through the states of the chunk
+    auto writeChunk = [&](size_t chunk, std::string& buffer) {
+        size_t begin = chunk * chunkSize;
+        size_t end = std::min(states.size(), begin + chunkSize);
+        auto pressures = states[begin]->getPressures();
+        auto flowRates = states[begin]->getFlowRates();
+        for (size_t i = begin; i < end; ++i) {
+            if (i > begin) {
+                states[i]->applyTo(pressures, flowRates);
+            }
+            buffer += inner;
+            appendIndented(buffer, writeState<T>(states[i].get(), simulation, pressures, flowRates).dump(4), inner);
+            buffer += (i + 1 < states.size()) ? ",\n" : "\n";
+        }
+    };
+
+    size_t chunkCount = (states.size() + chunkSize - 1) / chunkSize;
+    size_t workers = sim::workerCount(threads, chunkCount);
+    if (workers == 1) {
+        std::string buffer;
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            writeChunk(chunk, buffer);
+            stream << buffer;
+            buffer.clear();
         }
-        if (simulation->getPlatform() == sim::Platform::Droplet && simulation->getType() == sim::Type::Abstract) {
-            jsonState["Droplets"] = writeDroplets(state.get(), dynamic_cast<sim::AbstractDroplet<T>*>(simulation));
+        stream << outer << "    ]\n" << outer << "}";
+        return;
+    }
+
+    // The workers dump the chunks into a ring of buffers, at most two chunks per worker ahead of the chunk that is
+    // written, while the calling thread writes the dumped chunks in order. A buffer is reused once it is written.
+    struct Slot {
+        std::string buffer;
+        std::exception_ptr error;
+        bool ready = false;
+    };
+    std::vector<Slot> slots(2 * workers);
+    std::mutex mutex;
+    std::condition_variable dumped;
+    std::condition_variable released;
+    size_t nextChunk = 0;
+    size_t writtenChunks = 0;
+    bool stop = false;
+
+    auto work = [&]() {
+        while (true) {
+            size_t chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                released.wait(lock, [&]() { return stop || nextChunk >= chunkCount || nextChunk < writtenChunks + slots.size(); });
+                if (stop || nextChunk >= chunkCount) {
+                    return;
+                }
+                chunk = nextChunk++;
+            }
+            Slot& slot = slots[chunk % slots.size()];
+            try {
+                writeChunk(chunk, slot.buffer);
+            } catch (...) {
+                slot.error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot.ready = true;
+            }
+            dumped.notify_all();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    std::exception_ptr error;
+    try {
+        pool.reserve(workers);
+        for (size_t w = 0; w < workers; ++w) {
+            pool.emplace_back(work);
+        }
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            Slot& slot = slots[chunk % slots.size()];
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                dumped.wait(lock, [&]() { return slot.ready; });
+            }
+            if (slot.error) {
+                std::rethrow_exception(slot.error);
+            }
+            stream << slot.buffer;
+            slot.buffer.clear();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot.ready = false;
+                ++writtenChunks;
+            }
+            released.notify_all();
         }
-        jsonStates.push_back(jsonState);
+    } catch (...) {
+        error = std::current_exception();
     }
 
-    jsonResult["fixture"] = simulation->getFixtureId();
-    jsonResult["type"] = writeSimType(simulation);
-    jsonResult["platform"] = writeSimPlatform(simulation);
-    jsonResult["fluids"] =  writeFluids(simulation);
-    if (simulation->getPlatform() == sim::Platform::Concentration && simulation->getType() == sim::Type::Abstract) {
-        jsonResult["mixtures"] = writeMixtures(dynamic_cast<sim::AbstractConcentration<T>*>(simulation));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    released.notify_all();
+    for (auto& thread : pool) {
+        thread.join();
     }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    stream << outer << "    ]\n" << outer << "}";
+}
+
+template<typename T>
+nlohmann::ordered_json resultToJSON(sim::Simulation<T>* simulation) {
+
+    auto jsonResult = writeResultHeader<T>(simulation);
+    auto jsonStates = ordered_json::array();
+
+    // The pressures and flow rates are walked forward through the states instead of being reconstructed per state
+    std::unordered_map<int, T> pressures;
+    std::unordered_map<int, T> flowRates;
+    for (auto const& state : simulation->getResults()->getStates()) {
+        state->applyTo(pressures, flowRates);
+        jsonStates.push_back(writeState<T>(state.get(), simulation, pressures, flowRates));
+    }
+
     jsonResult.push_back({"network", jsonStates});
 
     return jsonResult;
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -44,13 +45,42 @@ enum class Type;
 }   // namespace sim
 namespace porting {
 
+/**
+ * @brief Returns the member of a json object without modifying or copying the object
+ * @param[in] jsonObject json object
+ * @param[in] key key of the member
+ * @returns The member, or a null value if the object has no such member
+*/
+inline const json& getMember (const json& jsonObject, const std::string& key);
+
+/**
+ * @brief Returns the definition of a fixture without modifying or copying the json string
+ * @param[in] jsonString json string
+ * @param[in] fixtureId id of the fixture
+ * @returns The fixture, or a null value if the fixture does not exist
+*/
+inline const json& getFixture (const json& jsonString, size_t fixtureId);
+
+/**
+ * @brief Translates the position of an entity in a json array to the id of the corresponding entity of a simulation.
+ * The entities are numbered by global counters, hence their ids only equal their positions in the json string if the
+ * simulation is the first one that is constructed.
+ * @param[in] ids The sorted ids of the entities of the simulation that were read from the json array (see sortedKeys),
+ * which a reader determines once for all entities that it translates
+ * @param[in] index Position of the entity in the json array
+ * @param[in] name Name of the entity, used in the error message
+ * @returns The id of the entity
+ * @throws invalid_argument if the json array has no entity at the given position
+*/
+inline size_t idOfIndex (const std::vector<size_t>& ids, size_t index, const std::string& name);
+
 /**
  * @brief Construct and store the nodes in the network as defined by the json string
  * @param[in] jsonString json string
  * @param[in] network network object
 */
 template<typename T>
-void readNodes (json jsonString, arch::Network<T>& network);
+void readNodes (const json& jsonString, arch::Network<T>& network);
 
 /**
  * @brief Construct and store the channels in the network as defined by the json string
@@ -58,7 +88,7 @@ void readNodes (json jsonString, arch::Network<T>& network);
  * @param[in] network network object
 */
 template<typename T>
-void readChannels (json jsonString, arch::Network<T>& network);
+void readChannels (const json& jsonString, arch::Network<T>& network);
 
 /**
  * @brief Construct and store the modules in the network as defined by the json string
@@ -66,7 +96,7 @@ void readChannels (json jsonString, arch::Network<T>& network);
  * @param[in] network network object
 */
 template<typename T>
-void readModules (json jsonString, arch::Network<T>& network);
+void readModules (const json& jsonString, arch::Network<T>& network);
 
 /**
  * @brief Read the platform of the simulation as defined by the json string
@@ -74,7 +104,7 @@ void readModules (json jsonString, arch::Network<T>& network);
  * @return Platform platform
 */
 template<typename T>
-sim::Platform readPlatform (json jsonString);
+sim::Platform readPlatform (const json& jsonString);
 
 /**
  * @brief Read the simulation type of the simulation as defined by the json string
@@ -82,7 +112,7 @@ sim::Platform readPlatform (json jsonString);
  * @return Type simulation type
 */
 template<typename T>
-sim::Type readType (json jsonString);
+sim::Type readType (const json& jsonString);
 
 /**
  * @brief Construct and store the fluids in the simulation as defined by the json string
@@ -90,7 +120,7 @@ sim::Type readType (json jsonString);
  * @param[in] simulation simulation object
 */
 template<typename T>
-void readFluids (json jsonString, sim::Simulation<T>& simulation);
+void readFluids (const json& jsonString, sim::Simulation<T>& simulation);
 
 /**
  * @brief Construct and store the droplets in the simulation as defined by the json string
@@ -98,19 +128,19 @@ void readFluids (json jsonString, sim::Simulation<T>& simulation);
  * @param[in] simulation simulation object
 */
 template<typename T>
-void readDroplets (json jsonString, sim::AbstractDroplet<T>& simulation);
+void readDroplets (const json& jsonString, sim::AbstractDroplet<T>& simulation);
 
 template<typename T>
-void readSpecies (json jsonString, sim::ConcentrationSemantics<T>& simulation);
+void readSpecies (const json& jsonString, sim::ConcentrationSemantics<T>& simulation);
 
 /** TODO: HybridOocSimulation
  * Uncomment code below for reading tissues
  */
 // template<typename T>
-// void readTissues (json jsonString, sim::Simulation<T>& simulation);
+// void readTissues (const json& jsonString, sim::Simulation<T>& simulation);
 
 template<typename T>
-void readMixtures (json jsonString, sim::ConcentrationSemantics<T>& simulation);
+void readMixtures (const json& jsonString, sim::ConcentrationSemantics<T>& simulation);
 
 /**
  * @brief Construct and store the droplet injections in the simulation as defined by the json string
@@ -119,10 +149,10 @@ void readMixtures (json jsonString, sim::ConcentrationSemantics<T>& simulation);
  * @param[in] activeFixture active fixture
 */
 template<typename T>
-void readDropletInjections (json jsonString, sim::AbstractDroplet<T>& simulation, int activeFixture);
+void readDropletInjections (const json& jsonString, sim::AbstractDroplet<T>& simulation, int activeFixture);
 
 template<typename T>
-void readMixtureInjections (json jsonString, sim::ConcentrationSemantics<T>& simulation, int activeFixture);
+void readMixtureInjections (const json& jsonString, sim::ConcentrationSemantics<T>& simulation, int activeFixture);
 
 /**
  * @brief Set the boundary conditions of the simulation as defined by the json string
@@ -131,7 +161,7 @@ void readMixtureInjections (json jsonString, sim::ConcentrationSemantics<T>& sim
  * @param[in] activeFixture active fixture
 */
 template<typename T>
-void readBoundaryConditions (json jsonString, sim::Simulation<T>& simulation, int activeFixture);
+void readBoundaryConditions (const json& jsonString, sim::Simulation<T>& simulation, int activeFixture);
 
 /**
  * @brief Set the continuous phase of the simulation as defined by the json string
@@ -140,7 +170,7 @@ void readBoundaryConditions (json jsonString, sim::Simulation<T>& simulation, in
  * @param[in] activeFixture active fixture
 */
 template<typename T>
-void readContinuousPhase (json jsonString, sim::Simulation<T>& simulation, int activeFixture);
+void readContinuousPhase (const json& jsonString, sim::Simulation<T>& simulation, int activeFixture);
 
 /**
  * @brief Construct and stores the CFD modules simulators that are included in the network as defined by the json string
@@ -149,7 +179,7 @@ void readContinuousPhase (json jsonString, sim::Simulation<T>& simulation, int a
  * @param[in] network pointer to the network
 */
 template<typename T>
-void readSimulators (json jsonString, sim::HybridContinuous<T>& simulation, arch::Network<T>* network);
+void readSimulators (const json& jsonString, sim::HybridContinuous<T>& simulation, arch::Network<T>* network);
 
 /**
  * @brief Construct and stores the CFD modules simulators that are included in the network as defined by the json string
@@ -158,7 +188,7 @@ void readSimulators (json jsonString, sim::HybridContinuous<T>& simulation, arch
  * @param[in] network pointer to the network
 */
 template<typename T>
-void readSimulators (json jsonString, sim::HybridConcentration<T>& simulation, arch::Network<T>* network);
+void readSimulators (const json& jsonString, sim::HybridConcentration<T>& simulation, arch::Network<T>* network);
 
 /**
  * @brief Construct and stores the update scheme that is used for the Abstract-CFD coupling.
@@ -166,7 +196,7 @@ void readSimulators (json jsonString, sim::HybridConcentration<T>& simulation, a
  * @param[in] simulation simulation object
 */
 template<typename T>
-void readUpdateScheme (json jsonString, sim::HybridContinuous<T>& simulation);
+void readUpdateScheme (const json& jsonString, sim::HybridContinuous<T>& simulation);
 
 /**
  * @brief Sets channels in the network to pressure or flow rate pump, as defined by the json string
@@ -175,7 +205,7 @@ void readUpdateScheme (json jsonString, sim::HybridContinuous<T>& simulation);
  * @param[in] activeFixture active fixture
 */
 template<typename T>
-void readPumps (json jsonString, arch::Network<T>* network);
+void readPumps (const json& jsonString, arch::Network<T>* network);
 
 /**
  * @brief Construct and store the resistance model of the simulation as defined by the json string
@@ -183,19 +213,26 @@ void readPumps (json jsonString, arch::Network<T>* network);
  * @param[in] simulation simulation object
 */
 template<typename T>
-void readResistanceModel (json jsonString, sim::Simulation<T>& simulation);
+void readResistanceModel (const json& jsonString, sim::Simulation<T>& simulation);
 
 template<typename T>
-void readMixingModel (json jsonString, sim::ConcentrationSemantics<T>& simulation);
+void readMixingModel (const json& jsonString, sim::ConcentrationSemantics<T>& simulation);
 
 /**
  * @brief Returns the id of the active fixture as defined in the json string
  * @returns The id of the active fixture
 */
 template<typename T>
-size_t readActiveFixture (json jsonString);
+size_t readActiveFixture (const json& jsonString);
+
+/**
+ * @brief Returns the number of fixtures as defined in the json string
+ * @returns The number of fixtures, or 1 if no fixtures are defined
+*/
+template<typename T>
+size_t readFixtureCount (const json& jsonString);
 
 template<typename T>
-void readBoundaryConditions (json jsonString, sim::CfdContinuous<T>& simulation, arch::Network<T>* network);
+void readBoundaryConditions (const json& jsonString, sim::CfdContinuous<T>& simulation, arch::Network<T>* network);
 
 }   // namespace porting
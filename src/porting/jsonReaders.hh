@@ -2,11 +2,33 @@
 
 namespace porting {
 
+inline const json& getMember(const json& jsonObject, const std::string& key) {
+    static const json null;
+    if (!jsonObject.is_object()) {
+        return null;
+    }
+    auto it = jsonObject.find(key);
+    return (it != jsonObject.end()) ? *it : null;
+}
+
+inline const json& getFixture(const json& jsonString, size_t fixtureId) {
+    static const json null;
+    const json& fixtures = getMember(getMember(jsonString, "simulation"), "fixtures");
+    return (fixtures.is_array() && fixtureId < fixtures.size()) ? fixtures[fixtureId] : null;
+}
+
+inline size_t idOfIndex(const std::vector<size_t>& ids, size_t index, const std::string& name) {
+    if (index >= ids.size()) {
+        throw std::invalid_argument("The " + name + " " + std::to_string(index) + " is not defined.");
+    }
+    return ids[index];
+}
+
 template<typename T>
-void readNodes(json jsonString, arch::Network<T>& network) {
+void readNodes(const json& jsonString, arch::Network<T>& network) {
     size_t nodeId = 0;
     size_t virtualNodes = 0;
-    for (auto& node : jsonString["network"]["nodes"]) {
+    for (auto& node : getMember(getMember(jsonString, "network"), "nodes")) {
         
         if (node.contains("virtual") && node["virtual"]) {
             nodeId++;
@@ -33,9 +55,9 @@ void readNodes(json jsonString, arch::Network<T>& network) {
 }
 
 template<typename T>
-void readChannels(json jsonString, arch::Network<T>& network) {
+void readChannels(const json& jsonString, arch::Network<T>& network) {
     size_t channelId = 0;
-    for (auto& channel : jsonString["network"]["channels"]) {
+    for (auto& channel : getMember(getMember(jsonString, "network"), "channels")) {
         if (channel.contains("virtual") && channel["virtual"]) {
             channelId++;
             continue;
@@ -51,8 +73,8 @@ void readChannels(json jsonString, arch::Network<T>& network) {
 }
 
 template<typename T>
-void readModules(json jsonString, arch::Network<T>& network) {
-    for (auto& module : jsonString["network"]["modules"]) {
+void readModules(const json& jsonString, arch::Network<T>& network) {
+    for (auto& module : getMember(getMember(jsonString, "network"), "modules")) {
         if (!module.contains("position") || !module.contains("size") || !module.contains("stlFile") || !module.contains("Openings")) {
             throw std::invalid_argument("Module is ill-defined. Please define:\nposition\nsize\nstlFile\nOpenings");
         }
@@ -61,9 +83,9 @@ void readModules(json jsonString, arch::Network<T>& network) {
         std::string stlFile = module["stlFile"];
         std::unordered_map<size_t, arch::Opening<T>> Openings;
         for (auto& opening : module["Openings"]) {
-            size_t nodeId = opening["node"];
-            std::vector<T> normal = { opening["normal"]["x"], opening["normal"]["y"] };
-            arch::Opening<T> opening_(network.getNode(nodeId), normal, opening["width"]);
+            size_t nodeId = opening.at("node");
+            std::vector<T> normal = { opening.at("normal").at("x"), opening.at("normal").at("y") };
+            arch::Opening<T> opening_(network.getNode(nodeId), normal, opening.at("width"));
             Openings.try_emplace(nodeId, opening_);
         }
         network.addCfdModule(position, size, stlFile, std::move(Openings));
@@ -71,18 +93,19 @@ void readModules(json jsonString, arch::Network<T>& network) {
 }
 
 template<typename T>
-sim::Platform readPlatform(json jsonString) {
+sim::Platform readPlatform(const json& jsonString) {
     sim::Platform platform = sim::Platform::Continuous;
-    if (!jsonString["simulation"].contains("platform")) {
+    const json& simulation = getMember(jsonString, "simulation");
+    if (!simulation.contains("platform")) {
         throw std::invalid_argument("Please define a platform. The following platforms are possible:\nContinuous\nConcentration\nDroplet\nMembrane");
     }
-    if (jsonString["simulation"]["platform"] == "Continuous") {
+    if (simulation["platform"] == "Continuous") {
         return platform;
-    } else if (jsonString["simulation"]["platform"] == "Droplet") {
+    } else if (simulation["platform"] == "Droplet") {
         platform = sim::Platform::Droplet;
-    } else if (jsonString["simulation"]["platform"] == "Concentration") {
+    } else if (simulation["platform"] == "Concentration") {
         platform = sim::Platform::Concentration;
-    } else if (jsonString["simulation"]["platform"] == "Membrane") {
+    } else if (simulation["platform"] == "Membrane") {
         platform = sim::Platform::Membrane;
     } else {
         throw std::invalid_argument("Platform is invalid. The following platforms are possible:\nContinuous\nConcentration\nDroplet\nMembrane");
@@ -91,16 +114,17 @@ sim::Platform readPlatform(json jsonString) {
 } 
 
 template<typename T>
-sim::Type readType(json jsonString) {
+sim::Type readType(const json& jsonString) {
     sim::Type simType = sim::Type::Abstract;
-    if (!jsonString["simulation"].contains("type")) {
+    const json& simulation = getMember(jsonString, "simulation");
+    if (!simulation.contains("type")) {
         throw std::invalid_argument("Please define a simulation type. The following types are possible:\nAbstract\nHybrid\nCFD");
     }
-    if (jsonString["simulation"]["type"] == "Abstract") {
+    if (simulation["type"] == "Abstract") {
         return simType;
-    } else if (jsonString["simulation"]["type"] == "Hybrid") {
+    } else if (simulation["type"] == "Hybrid") {
         simType = sim::Type::Hybrid;
-    } else if (jsonString["simulation"]["type"] == "CFD") {
+    } else if (simulation["type"] == "CFD") {
         simType = sim::Type::CFD;
     } else {
         throw std::invalid_argument("Simulation type is invalid. The following types are possible:\nAbstract\nHybrid\nCFD");
@@ -109,11 +133,12 @@ sim::Type readType(json jsonString) {
 }
 
 template<typename T>
-void readFluids(json jsonString, sim::Simulation<T>& simulation) {
-    if (!jsonString["simulation"].contains("fluids") || jsonString["simulation"]["fluids"].empty()) {
+void readFluids(const json& jsonString, sim::Simulation<T>& simulation) {
+    const json& fluids = getMember(getMember(jsonString, "simulation"), "fluids");
+    if (fluids.empty()) {
         throw std::invalid_argument("No fluids are defined. Please define at least 1 fluid.");
     }
-    for (auto& fluid : jsonString["simulation"]["fluids"]) {
+    for (auto& fluid : fluids) {
         if (fluid.contains("density") && fluid.contains("viscosity") && fluid.contains("name")) {
             T density = fluid["density"];
             T viscosity = fluid["viscosity"];
@@ -127,10 +152,11 @@ void readFluids(json jsonString, sim::Simulation<T>& simulation) {
 }
 
 template<typename T>
-void readDroplets(json jsonString, sim::AbstractDroplet<T>& simulation) {
-    for (auto& droplet : jsonString["simulation"]["droplets"]) {
+void readDroplets(const json& jsonString, sim::AbstractDroplet<T>& simulation) {
+    const std::vector<size_t> fluidIds = sortedKeys(simulation.getFluids());
+    for (auto& droplet : getMember(getMember(jsonString, "simulation"), "droplets")) {
         if (droplet.contains("fluid") && droplet.contains("volume")) {
-            int fluid = droplet["fluid"];
+            int fluid = idOfIndex(fluidIds, droplet["fluid"], "fluid");
             T volume = droplet["volume"];
             auto newDroplet = simulation.addDroplet(fluid, volume);
         } else {
@@ -140,8 +166,8 @@ void readDroplets(json jsonString, sim::AbstractDroplet<T>& simulation) {
 }
 
 template<typename T>
-void readSpecies(json jsonString, sim::ConcentrationSemantics<T>& simulation) {
-    for (auto& specie : jsonString["simulation"]["species"]) {
+void readSpecies(const json& jsonString, sim::ConcentrationSemantics<T>& simulation) {
+    for (auto& specie : getMember(getMember(jsonString, "simulation"), "species")) {
         if (specie.contains("diffusivity") && specie.contains("saturationConcentration")) {
             T diffusivity = specie["diffusivity"];
             T satConc = specie["saturationConcentration"];
@@ -156,7 +182,7 @@ void readSpecies(json jsonString, sim::ConcentrationSemantics<T>& simulation) {
  * Enable hybrid OoC simulation and uncomment code below
  */
 // template<typename T>
-// void readTissues(json jsonString, sim::Simulation<T>& simulation) {
+// void readTissues(const json& jsonString, sim::Simulation<T>& simulation) {
 //     for (auto& tissue : jsonString["simulation"]["tissues"]) {
 //         if (tissue.contains("species") && tissue.contains("Vmax") && tissue.contains("kM")) {
 //             if (tissue["species"].size() == tissue["Vmax"].size() && tissue["species"].size() == tissue["kM"].size()) {
@@ -182,14 +208,15 @@ void readSpecies(json jsonString, sim::ConcentrationSemantics<T>& simulation) {
 // }
 
 template<typename T>
-void readMixtures(json jsonString, sim::ConcentrationSemantics<T>& simulation) {
-    for (auto& mixture : jsonString["simulation"]["mixtures"]) {
+void readMixtures(const json& jsonString, sim::ConcentrationSemantics<T>& simulation) {
+    const std::vector<size_t> specieIds = sortedKeys(simulation.getSpecies());
+    for (auto& mixture : getMember(getMember(jsonString, "simulation"), "mixtures")) {
         if (mixture.contains("species") && mixture.contains("concentrations")) {
             if (mixture["species"].size() == mixture["concentrations"].size()) {
                 std::vector<std::shared_ptr<sim::Specie<T>>> species;
                 std::vector<T> concentrations;
                 for (auto& specie : mixture["species"]) {
-                    auto specie_ptr = simulation.getSpecie(specie);
+                    auto specie_ptr = simulation.getSpecie(idOfIndex(specieIds, specie, "specie"));
                     species.push_back(specie_ptr);
                 }
                 for (auto& conc : mixture["concentrations"]) {
@@ -206,15 +233,17 @@ void readMixtures(json jsonString, sim::ConcentrationSemantics<T>& simulation) {
 }
 
 template<typename T>
-void readDropletInjections(json jsonString, sim::AbstractDroplet<T>& simulation, int activeFixture) {
-    if (jsonString["simulation"]["fixtures"][activeFixture].contains("dropletInjections")) {
-        for (auto& injection : jsonString["simulation"]["fixtures"][activeFixture]["dropletInjections"]) {
-            int fluid = injection["fluid"];
-            T volume = injection["volume"];
+void readDropletInjections(const json& jsonString, sim::AbstractDroplet<T>& simulation, int activeFixture) {
+    const json& fixture = getFixture(jsonString, activeFixture);
+    if (fixture.contains("dropletInjections")) {
+        const std::vector<size_t> fluidIds = sortedKeys(simulation.getFluids());
+        for (auto& injection : fixture["dropletInjections"]) {
+            int fluid = idOfIndex(fluidIds, injection.at("fluid"), "fluid");
+            T volume = injection.at("volume");
             auto newDroplet = simulation.addDroplet(fluid, volume);
-            int channelId = injection["channel"];
-            T injectionTime = injection["t0"];
-            T injectionPosition = injection["pos"];
+            int channelId = injection.at("channel");
+            T injectionTime = injection.at("t0");
+            T injectionPosition = injection.at("pos");
             simulation.addDropletInjection(newDroplet->getId(), injectionTime, channelId, injectionPosition);
         }
     } else {
@@ -223,12 +252,14 @@ void readDropletInjections(json jsonString, sim::AbstractDroplet<T>& simulation,
 }
 
 template<typename T>
-void readMixtureInjections(json jsonString, sim::ConcentrationSemantics<T>& simulation, int activeFixture) {
-    if (jsonString["simulation"]["fixtures"][activeFixture].contains("mixtureInjections")) {
-        for (auto& injection : jsonString["simulation"]["fixtures"][activeFixture]["mixtureInjections"]) {
-            int mixtureId = injection["mixture"];
-            int channelId = injection["channel"];
-            T injectionTime = injection["t0"];
+void readMixtureInjections(const json& jsonString, sim::ConcentrationSemantics<T>& simulation, int activeFixture) {
+    const json& fixture = getFixture(jsonString, activeFixture);
+    if (fixture.contains("mixtureInjections")) {
+        const std::vector<size_t> mixtureIds = sortedKeys(simulation.getMixtures());
+        for (auto& injection : fixture["mixtureInjections"]) {
+            int mixtureId = idOfIndex(mixtureIds, injection.at("mixture"), "mixture");
+            int channelId = injection.at("channel");
+            T injectionTime = injection.at("t0");
             simulation.addMixtureInjection(mixtureId, channelId, injectionTime);
         }
     } else {
@@ -237,33 +268,34 @@ void readMixtureInjections(json jsonString, sim::ConcentrationSemantics<T>& simu
 }
 
 template<typename T>
-void readSimulators(json jsonString, sim::HybridContinuous<T>& simulation, arch::Network<T>* network) {
+void readSimulators(const json& jsonString, sim::HybridContinuous<T>& simulation, arch::Network<T>* network) {
         std::string vtkFolder;
-        if (!jsonString["simulation"]["settings"].contains("simulators") || jsonString["simulation"]["settings"]["simulators"].empty()) {
+        const json& settings = getMember(getMember(jsonString, "simulation"), "settings");
+        if (getMember(settings, "simulators").empty()) {
             throw std::invalid_argument("Hybrid simulation type was set, but no CFD simulators were defined.");
         }
-        if (jsonString["simulation"]["settings"].contains("vtkFolder")) {
-            vtkFolder = jsonString["simulation"]["settings"]["vtkFolder"];
+        if (settings.contains("vtkFolder")) {
+            vtkFolder = settings["vtkFolder"];
         } else {
             vtkFolder = "./tmp/";
         }
-        for (auto& simulator : jsonString["simulation"]["settings"]["simulators"]) {
-            std::string name = simulator["name"];
-            T charPhysLength = simulator["charPhysLength"];
-            T charPhysVelocity = simulator["charPhysVelocity"];
-            size_t resolution = simulator["resolution"];
-            T epsilon = simulator["epsilon"];
-            T tau = simulator["tau"];
-            int moduleId = simulator["moduleId"];
+        for (auto& simulator : settings["simulators"]) {
+            std::string name = simulator.at("name");
+            T charPhysLength = simulator.at("charPhysLength");
+            T charPhysVelocity = simulator.at("charPhysVelocity");
+            size_t resolution = simulator.at("resolution");
+            T epsilon = simulator.at("epsilon");
+            T tau = simulator.at("tau");
+            int moduleId = simulator.at("moduleId");
 
-            if(simulator["Type"] == "LBM")
+            if(getMember(simulator, "Type") == "LBM")
             {
                 assert(network->getCfdModule(moduleId)->getModuleType() == arch::ModuleType::LBM);
                 auto simulator = simulation.addLbmSimulator(network->getCfdModule(moduleId), resolution,
                                                                 epsilon, tau, charPhysLength, charPhysVelocity, name);
                 simulator->setVtkFolder(vtkFolder);
             }
-            else if(simulator["Type"] == "ESS_LBM")
+            else if(getMember(simulator, "Type") == "ESS_LBM")
             {
                 #ifdef USE_ESSLBM
                 auto simulator = simulation.addEssLbmSimulator(name, stlFile, network->getCfdModule(moduleId), Openings, charPhysLength, 
@@ -277,27 +309,28 @@ void readSimulators(json jsonString, sim::HybridContinuous<T>& simulation, arch:
 }
 
 template<typename T>
-void readSimulators(json jsonString, sim::HybridConcentration<T>& simulation, arch::Network<T>* network) {
+void readSimulators(const json& jsonString, sim::HybridConcentration<T>& simulation, arch::Network<T>* network) {
         std::string vtkFolder;
-        if (!jsonString["simulation"]["settings"].contains("simulators") || jsonString["simulation"]["settings"]["simulators"].empty()) {
+        const json& settings = getMember(getMember(jsonString, "simulation"), "settings");
+        if (getMember(settings, "simulators").empty()) {
             throw std::invalid_argument("Hybrid simulation type was set, but no CFD simulators were defined.");
         }
-        if (jsonString["simulation"]["settings"].contains("vtkFolder")) {
-            vtkFolder = jsonString["simulation"]["settings"]["vtkFolder"];
+        if (settings.contains("vtkFolder")) {
+            vtkFolder = settings["vtkFolder"];
         } else {
             vtkFolder = "./tmp/";
         }
-        for (auto& simulator : jsonString["simulation"]["settings"]["simulators"]) {
-            std::string name = simulator["name"];
-            T charPhysLength = simulator["charPhysLength"];
-            T charPhysVelocity = simulator["charPhysVelocity"];
-            size_t resolution = simulator["resolution"];
-            T epsilon = simulator["epsilon"];
-            T tau = simulator["tau"];
-            T adTau = simulator["adTau"];
-            int moduleId = simulator["moduleId"];
+        for (auto& simulator : settings["simulators"]) {
+            std::string name = simulator.at("name");
+            T charPhysLength = simulator.at("charPhysLength");
+            T charPhysVelocity = simulator.at("charPhysVelocity");
+            size_t resolution = simulator.at("resolution");
+            T epsilon = simulator.at("epsilon");
+            T tau = simulator.at("tau");
+            T adTau = simulator.at("adTau");
+            int moduleId = simulator.at("moduleId");
 
-            if (simulator["Type"] == "Concentration")
+            if (getMember(simulator, "Type") == "Concentration")
             {
                 assert(network->getCfdModule(moduleId)->getModuleType() == arch::ModuleType::LBM);
                 auto simulator = simulation.addLbmSimulator(network->getCfdModule(moduleId), resolution,
@@ -323,47 +356,49 @@ void readSimulators(json jsonString, sim::HybridConcentration<T>& simulation, ar
 }
 
 template<typename T>
-void readUpdateScheme(json jsonString, sim::HybridContinuous<T>& simulation) {
+void readUpdateScheme(const json& jsonString, sim::HybridContinuous<T>& simulation) {
 
     /** TODO: UpdateSchemes
      * Include UpdateScheme definitions and update this function.
      */
     /*  Legacy definition of update scheme for hybrid simulation
         Will be deprecated in next release. */
-    if (!jsonString["simulation"].contains("updateScheme")) {
-        T alpha = jsonString["simulation"]["settings"]["simulators"][0]["alpha"];
+    const json& updateScheme = getMember(getMember(jsonString, "simulation"), "updateScheme");
+    const json& simulators = getMember(getMember(getMember(jsonString, "simulation"), "settings"), "simulators");
+    if (updateScheme.is_null()) {
+        T alpha = simulators.at(0).at("alpha");
         simulation.setNaiveHybridScheme(alpha, 5*alpha, 10);
     } 
     else {
-        if (jsonString["simulation"]["updateScheme"]["scheme"] == "Naive") {
-            if (jsonString["simulation"]["updateScheme"]["scheme"].contains("alpha") && 
-                jsonString["simulation"]["updateScheme"]["scheme"].contains("beta") &&
-                jsonString["simulation"]["updateScheme"]["scheme"].contains("theta")) 
+        if (getMember(updateScheme, "scheme") == "Naive") {
+            if (getMember(updateScheme, "scheme").contains("alpha") && 
+                getMember(updateScheme, "scheme").contains("beta") &&
+                getMember(updateScheme, "scheme").contains("theta")) 
             {
-                T alpha = jsonString["simulation"]["updateScheme"]["scheme"]["alpha"];
-                T beta = jsonString["simulation"]["updateScheme"]["scheme"]["beta"];
-                int theta = jsonString["simulation"]["updateScheme"]["scheme"]["theta"];
+                T alpha = getMember(updateScheme, "scheme")["alpha"];
+                T beta = getMember(updateScheme, "scheme")["beta"];
+                int theta = getMember(updateScheme, "scheme")["theta"];
                 simulation.setNaiveHybridScheme(alpha, beta, theta);
                 return;
             } 
             else {
-                for (auto& simulator : jsonString["simulation"]["settings"]["simulators"]) {
+                for (auto& simulator : simulators) {
                     if (simulator.contains("alpha") && simulator.contains("beta") && simulator.contains("theta")) {
                         int moduleCounter = 0;
                         auto lbmSimulator = simulation.getLbmSimulator(moduleCounter);
                         if (simulator["alpha"].is_number() && simulator["beta"].is_number()) {
                             T alpha = simulator["alpha"];
                             T beta = simulator["beta"];
-                            int theta = simulator["theta"];
+                            int theta = simulator.at("theta");
                             simulation.setNaiveHybridScheme(lbmSimulator, alpha, beta, theta);
                         } else if (simulator["alpha"].is_array() && simulator["beta"].is_array()) {
                             int nodeCounter = 0;
                             std::unordered_map<int, T> alpha;
                             std::unordered_map<int, T> beta;
-                            int theta = simulator["theta"];
-                            for (auto& opening : simulator["Openings"]) {
-                                alpha.try_emplace(opening["node"], simulator["alpha"][nodeCounter]);
-                                beta.try_emplace(opening["node"], simulator["beta"][nodeCounter]);
+                            int theta = simulator.at("theta");
+                            for (auto& opening : getMember(simulator, "Openings")) {
+                                alpha.try_emplace(opening.at("node"), simulator["alpha"].at(nodeCounter));
+                                beta.try_emplace(opening.at("node"), simulator["beta"].at(nodeCounter));
                                 nodeCounter++;
                             }
                             simulation.setNaiveHybridScheme(lbmSimulator, alpha, beta, theta);
@@ -375,31 +410,48 @@ void readUpdateScheme(json jsonString, sim::HybridContinuous<T>& simulation) {
                 }
             }
         }
+        else if (getMember(updateScheme, "scheme") == "Adaptive") {
+            if (updateScheme.contains("alpha") && 
+                updateScheme.contains("beta") &&
+                updateScheme.contains("thetaMin") &&
+                updateScheme.contains("thetaMax")) 
+            {
+                T alpha = updateScheme["alpha"];
+                T beta = updateScheme["beta"];
+                int thetaMin = updateScheme["thetaMin"];
+                int thetaMax = updateScheme["thetaMax"];
+                simulation.setAdaptiveHybridScheme(alpha, beta, thetaMin, thetaMax);
+            } else {
+                throw std::invalid_argument("alpha, beta, thetaMin or thetaMax values are either not or ill-defined for Adaptive update scheme.");
+            }
+        }
     }
 }
 
 template<typename T>
-void readBoundaryConditions(json jsonString, sim::Simulation<T>& simulation, int activeFixture) {
-    if (jsonString["simulation"]["fixtures"][activeFixture].contains("boundaryConditions")) {
+void readBoundaryConditions(const json& jsonString, sim::Simulation<T>& simulation, int activeFixture) {
+    if (getFixture(jsonString, activeFixture).contains("boundaryConditions")) {
         throw std::invalid_argument("Setting boundary condition values in fixture is not yet supported.");
     }
 }
 
 template<typename T>
-void readContinuousPhase(json jsonString, sim::Simulation<T>& simulation, int activeFixture) {
-    if (jsonString["simulation"]["fixtures"][activeFixture].contains("phase")) {
-        simulation.setContinuousPhase(jsonString["simulation"]["fixtures"][activeFixture]["phase"]);
+void readContinuousPhase(const json& jsonString, sim::Simulation<T>& simulation, int activeFixture) {
+    const json& fixture = getFixture(jsonString, activeFixture);
+    if (fixture.contains("phase")) {
+        simulation.setContinuousPhase(idOfIndex(sortedKeys(simulation.getFluids()), fixture["phase"], "fluid"));
     } else {
         throw std::invalid_argument("Please set the continuous phase in the active fixture.");
     }
 }
 
 template<typename T>
-void readPumps(json jsonString, arch::Network<T>* network) {
-    if (!jsonString["simulation"].contains("pumps") || jsonString["simulation"]["pumps"].empty()) {
+void readPumps(const json& jsonString, arch::Network<T>* network) {
+    const json& pumps = getMember(getMember(jsonString, "simulation"), "pumps");
+    if (pumps.empty()) {
         throw std::invalid_argument("No pumps are defined. Please define at least 1 pump.");
     }
-    for (auto& pump : jsonString["simulation"]["pumps"]) {
+    for (auto& pump : pumps) {
         if (pump.contains("channel") && pump.contains("type")) {
             int channelId = pump["channel"];
             if (pump["type"] == "PumpPressure") {
@@ -426,11 +478,12 @@ void readPumps(json jsonString, arch::Network<T>* network) {
 }
 
 template<typename T>
-void readResistanceModel(json jsonString, sim::Simulation<T>& simulation) {
-    if (jsonString["simulation"].contains("resistanceModel")) {
-        if (jsonString["simulation"]["resistanceModel"] == "Rectangular") {
+void readResistanceModel(const json& jsonString, sim::Simulation<T>& simulation) {
+    const json& resistanceModel = getMember(getMember(jsonString, "simulation"), "resistanceModel");
+    if (!resistanceModel.is_null()) {
+        if (resistanceModel == "Rectangular") {
             simulation.set1DResistanceModel();
-        } else if (jsonString["simulation"]["resistanceModel"] == "Poiseuille") {
+        } else if (resistanceModel == "Poiseuille") {
             simulation.setPoiseuilleResistanceModel();
         } else {
             throw std::invalid_argument("Invalid resistance model. Options are:\nRectangular\nPoiseuille");
@@ -441,11 +494,12 @@ void readResistanceModel(json jsonString, sim::Simulation<T>& simulation) {
 }
 
 template<typename T>
-void readMixingModel(json jsonString, sim::ConcentrationSemantics<T>& simulation) {
-    if (jsonString["simulation"].contains("mixingModel")) {
-        if (jsonString["simulation"]["mixingModel"] == "Instantaneous") {
+void readMixingModel(const json& jsonString, sim::ConcentrationSemantics<T>& simulation) {
+    const json& mixingModel = getMember(getMember(jsonString, "simulation"), "mixingModel");
+    if (!mixingModel.is_null()) {
+        if (mixingModel == "Instantaneous") {
             simulation.setInstantaneousMixingModel();
-        } else if (jsonString["simulation"]["mixingModel"] == "Diffusion") {
+        } else if (mixingModel == "Diffusion") {
             simulation.setDiffusiveMixingModel();
         } else {
             throw std::invalid_argument("Invalid mixing model. Options are:\nInstantaneous\nDiffusion");
@@ -456,11 +510,12 @@ void readMixingModel(json jsonString, sim::ConcentrationSemantics<T>& simulation
 }
 
 template<typename T>
-size_t readActiveFixture(json jsonString) {
+size_t readActiveFixture(const json& jsonString) {
     size_t activeFixture = 0;
-    if (jsonString["simulation"].contains("activeFixture")) {
-        activeFixture = jsonString["simulation"]["activeFixture"];
-        if (!jsonString["simulation"].contains("fixtures") || jsonString["simulation"]["fixtures"].size()-1 < activeFixture) {
+    const json& simulation = getMember(jsonString, "simulation");
+    if (simulation.contains("activeFixture")) {
+        activeFixture = simulation["activeFixture"];
+        if (!simulation.contains("fixtures") || simulation["fixtures"].size()-1 < activeFixture) {
             throw std::invalid_argument("The active fixture does not exist.");
         }
     } else {
@@ -470,16 +525,23 @@ size_t readActiveFixture(json jsonString) {
 }
 
 template<typename T>
-void readBoundaryConditions(json jsonString, sim::CfdContinuous<T>& simulation, arch::Network<T>* network) {
-    if (jsonString["simulation"]["fixtures"][simulation.getFixtureId()].contains("boundaryConditions")) {
-        for (auto& bc : jsonString["simulation"]["fixtures"][simulation.getFixtureId()]["boundaryConditions"]) {
-            int nodeId = bc["node"];
-            std::string type = bc["type"];
+size_t readFixtureCount(const json& jsonString) {
+    const json& fixtures = getMember(getMember(jsonString, "simulation"), "fixtures");
+    return (fixtures.is_array() && !fixtures.empty()) ? fixtures.size() : 1;
+}
+
+template<typename T>
+void readBoundaryConditions(const json& jsonString, sim::CfdContinuous<T>& simulation, arch::Network<T>* network) {
+    const json& fixture = getFixture(jsonString, simulation.getFixtureId());
+    if (fixture.contains("boundaryConditions")) {
+        for (auto& bc : fixture["boundaryConditions"]) {
+            int nodeId = bc.at("node");
+            std::string type = bc.at("type");
             if (type == "FlowRate") {
-                T Q = bc["Q"];
+                T Q = bc.at("Q");
                 simulation.addFlowRateBC(network->getNode(nodeId), Q);
             } else if (type == "Pressure") {
-                T p = bc["p"];
+                T p = bc.at("p");
                 simulation.addPressureBC(network->getNode(nodeId), p);
             } else {
                 throw std::invalid_argument("Invalid boundary condition type. Please choose one of the following:\nVelocity\nPressure");
@@ -41,19 +41,20 @@ namespace porting {
 
 /**
  * @brief Write the pressures at the nodes in a network at a state (timestamp) of the simulation
- * @param[in] state the state (timestamp) of the simulation that should be written
+ * @param[in] pressures all pressures of the state, i.e., reconstructed if the state is a delta
  * @return The json string containing the result
 */
 template<typename T>
-auto writePressures (const result::State<T>* state);
+auto writePressures (const std::unordered_map<int, T>& pressures);
 
 /**
  * @brief Write the flow rates in the channels of a network at a state (timestamp) of the simulation
  * @param[in] state the state (timestamp) of the simulation that should be written
+ * @param[in] flowRates all flow rates of the state, i.e., reconstructed if the state is a delta
  * @return The json string containing the result
 */
 template<typename T>
-auto writeChannels (const arch::Network<T>* network, const result::State<T>* state);
+auto writeChannels (const arch::Network<T>* network, const result::State<T>* state, const std::unordered_map<int, T>& flowRates);
 
 /**
  * @brief Write the location of the vtk results of a module at a state (timestamp) of the simulation
@@ -63,6 +64,14 @@ auto writeChannels (const arch::Network<T>* network, const result::State<T>* sta
 template<typename T>
 auto writeModules (const result::State<T>* state);
 
+/**
+ * @brief Write the theta schedules of the adaptive update schemes of a hybrid simulation
+ * @param[in] simulation pointer to the simulation of which the results are written
+ * @return The json string containing the result
+*/
+template<typename T>
+auto writeThetaSchedules (const sim::Simulation<T>* simulation);
+
 /**
  * @brief Write the droplet positions at a state (timestamp) of the simulation
  * @param[in] state the state (timestamp) of the simulation that should be written
@@ -86,6 +95,28 @@ auto writeMixtures (const sim::AbstractConcentration<T>* simulation);
 template<typename T>
 auto writeMixtures (json& jsonString, const result::State<T>* state, const sim::AbstractConcentration<T>* simulation);
 
+/**
+ * @brief Write a state (timestamp) of the simulation, i.e., its time, pressures, flow rates and, depending on the
+ * simulation, its modules or droplets. The pressures and flow rates are passed in, such that consecutive states can be
+ * written while walking forward through them with result::State::applyTo, instead of reconstructing each delta state
+ * @param[in] state the state (timestamp) of the simulation that should be written
+ * @param[in] simulation pointer to the simulation of which the results are written
+ * @param[in] pressures all pressures of the state
+ * @param[in] flowRates all flow rates of the state
+ * @return The json string containing the result
+*/
+template<typename T>
+auto writeState (const result::State<T>* state, const sim::Simulation<T>* simulation, const std::unordered_map<int, T>& pressures, const std::unordered_map<int, T>& flowRates);
+
+/**
+ * @brief Write all members of the results of a simulation except for the states, i.e., the fixture, type, platform,
+ * fluids and, depending on the simulation, the mixtures and theta schedules
+ * @param[in] simulation pointer to the simulation of which the results are written
+ * @return The json string containing the result
+*/
+template<typename T>
+auto writeResultHeader (const sim::Simulation<T>* simulation);
+
 /**
  * @brief Return the simulation type of the simulation
  * @param[in] simulation pointer to the simulation of which the results are written
@@ -3,9 +3,8 @@
 namespace porting {
 
 template<typename T>
-auto writePressures(const result::State<T>* state) {
+auto writePressures(const std::unordered_map<int, T>& pressures) {
     auto nodes = ordered_json::array();
-    auto const& pressures = state->getPressures();
     for (auto& [key, pressure] : pressures) {
         nodes.push_back({{"pressure", pressure}});
     }
@@ -13,10 +12,9 @@ auto writePressures(const result::State<T>* state) {
 }
 
 template<typename T>
-auto writeChannels(const arch::Network<T>* network, const result::State<T>* state) {
+auto writeChannels(const arch::Network<T>* network, const result::State<T>* state, const std::unordered_map<int, T>& flowRates) {
     auto channels_json = ordered_json::array();
 
-    auto const& flowRates = state->getFlowRates();
     auto const& mixturePositions = state->getMixturePositions();
 
     auto const& channels = network->getChannels();
@@ -61,6 +59,18 @@ auto writeModules(const result::State<T>* state) {
     return modules;
 }
 
+template<typename T>
+auto writeThetaSchedules(const sim::Simulation<T>* simulation) {
+    auto schedules = ordered_json::array();
+    for (auto& [key, schedule] : simulation->getResults()->getThetaSchedules()) {
+        auto jsonSchedule = ordered_json::object();
+        jsonSchedule["simulator"] = key;
+        jsonSchedule["theta"] = schedule;
+        schedules.push_back(jsonSchedule);
+    }
+    return schedules;
+}
+
 template<typename T>
 auto writeDroplets(const result::State<T>* state, const sim::AbstractDroplet<T>* simulation) {      
     auto Droplets = ordered_json::array();
@@ -69,9 +79,10 @@ auto writeDroplets(const result::State<T>* state, const sim::AbstractDroplet<T>*
         auto Droplet = ordered_json::object();
 
         //state
+        auto droplet = simulation->getDroplet(key);
         Droplet["id"] = key;
-        Droplet["fluid"] = simulation->getDroplet(key)->readFluid()->getId();
-        Droplet["volume"] = simulation->getDroplet(key)->getVolume();
+        Droplet["fluid"] = droplet->readFluid()->getId();
+        Droplet["volume"] = droplet->getVolume();
 
         //boundaries
         Droplet["boundaries"] = ordered_json::array();
@@ -99,9 +110,9 @@ template<typename T>
 auto writeFluids(const sim::Simulation<T>* simulation) {      
     auto Fluids = ordered_json::array();
     auto const& simFluids = simulation->readFluids();
-    for (size_t i=0; i<simFluids.size(); ++i) {
+    for (auto const& fluidId : sortedKeys(simFluids)) {
         auto Fluid = ordered_json::object();
-        auto& simFluid = simFluids.at(i);
+        auto& simFluid = simFluids.at(fluidId);
         Fluid["id"] = simFluid->getId();
         Fluid["name"] = simFluid->getName();
         Fluid["density"] = simFluid->getDensity();
@@ -115,9 +126,9 @@ template<typename T>
 auto writeMixtures (const sim::AbstractConcentration<T>* simulation) {
     auto Mixtures = ordered_json::array();
     auto const& simMixtures = simulation->readMixtures();
-    for (size_t i=0; i<simMixtures.size(); ++i) {
+    for (auto const& mixtureId : sortedKeys(simMixtures)) {
         auto Mixture = ordered_json::object();
-        auto& simMixture = simMixtures.at(i);
+        auto& simMixture = simMixtures.at(mixtureId);
         for(auto& [key, specie] : simMixture->getSpecies()) {
             Mixture["species"].push_back(specie->getId());
             Mixture["concentrations"].push_back(simMixture->getConcentrationOfSpecie(specie));
@@ -127,6 +138,37 @@ auto writeMixtures (const sim::AbstractConcentration<T>* simulation) {
     return Mixtures;
 }
 
+template<typename T>
+auto writeState(const result::State<T>* state, const sim::Simulation<T>* simulation, const std::unordered_map<int, T>& pressures, const std::unordered_map<int, T>& flowRates) {
+    auto jsonState = ordered_json::object();
+    jsonState["time"] = state->getTime();
+    jsonState["nodes"] = writePressures(pressures);
+    jsonState["channels"] = writeChannels(simulation->getNetwork().get(), state, flowRates);
+    if (simulation->getPlatform() == sim::Platform::Continuous && simulation->getType() == sim::Type::Hybrid) {
+        jsonState["modules"] = writeModules(state);
+    }
+    if (simulation->getPlatform() == sim::Platform::Droplet && simulation->getType() == sim::Type::Abstract) {
+        jsonState["Droplets"] = writeDroplets(state, dynamic_cast<const sim::AbstractDroplet<T>*>(simulation));
+    }
+    return jsonState;
+}
+
+template<typename T>
+auto writeResultHeader(const sim::Simulation<T>* simulation) {
+    auto jsonResult = ordered_json::object();
+    jsonResult["fixture"] = simulation->getFixtureId();
+    jsonResult["type"] = writeSimType(simulation);
+    jsonResult["platform"] = writeSimPlatform(simulation);
+    jsonResult["fluids"] =  writeFluids(simulation);
+    if (simulation->getPlatform() == sim::Platform::Concentration && simulation->getType() == sim::Type::Abstract) {
+        jsonResult["mixtures"] = writeMixtures(dynamic_cast<const sim::AbstractConcentration<T>*>(simulation));
+    }
+    if (!simulation->getResults()->getThetaSchedules().empty()) {
+        jsonResult["thetaSchedules"] = writeThetaSchedules(simulation);
+    }
+    return jsonResult;
+}
+
 template<typename T>
 std::string writeSimType(const sim::Simulation<T>* simulation) {      
     if(simulation->getType() == sim::Type::Hybrid) {
@@ -0,0 +1,193 @@
+/**
+ * @file Profiler.h
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace result {
+
+/**
+ * @brief Phases of a simulation whose run time is measured by the profiler.
+ */
+enum class Phase {
+    NodalAnalysis,      ///< Assembly and solution of the nodal analysis.
+    NodalSolve,         ///< Solution of the linear system of the nodal analysis.
+    ComputeEvents,      ///< Computation of the next droplet events.
+    PerformEvent,       ///< Execution of an event.
+    UpdateMixtures,     ///< Propagation of the mixtures by the mixing model.
+    MembraneExchange,   ///< Exchange of species over the membranes.
+    LbmSolve,           ///< Solution of a CFD simulator for one coupling round.
+    WriteVTK,           ///< Output of the VTK files of a CFD simulator.
+    SaveState,          ///< Storage of a state in the simulation result.
+    Count
+};
+
+/**
+ * @brief Counters of a simulation that are recorded by the profiler.
+ */
+enum class Counter {
+    NodalUnknowns,      ///< Sum of the number of unknowns over all nodal analyses.
+    ComputedEvents,     ///< Number of events that were computed as candidates for the next event.
+    LbmSteps,           ///< Number of time steps of the CFD simulators.
+    Count
+};
+
+constexpr size_t phaseCount = static_cast<size_t>(Phase::Count);
+constexpr size_t counterCount = static_cast<size_t>(Counter::Count);
+constexpr size_t histogramBuckets = 40;     ///< Bucket b counts the calls that took [2^b, 2^(b+1)) ns.
+
+/**
+ * @brief Returns the name of a phase.
+ * @param[in] phase The phase.
+ * @returns Name of the phase.
+ */
+inline std::string phaseName(Phase phase);
+
+/**
+ * @brief Returns the name of a counter.
+ * @param[in] counter The counter.
+ * @returns Name of the counter.
+ */
+inline std::string counterName(Counter counter);
+
+/**
+ * @brief Accumulated run time of one phase. Times are inclusive, i.e., a phase that is nested in another phase, e.g.,
+ * the nodal analysis in an event, also counts towards the outer phase.
+ */
+struct PhaseStatistics {
+    size_t calls = 0;                                       ///< Number of calls.
+    double totalTime = 0.0;                                 ///< Total run time in s.
+    double minTime = 0.0;                                   ///< Shortest call in s.
+    double maxTime = 0.0;                                   ///< Longest call in s.
+    std::array<size_t, histogramBuckets> histogram {};      ///< Number of calls per log2 bucket of the run time in ns.
+};
+
+/**
+ * @brief Run times and counters that were recorded during one simulation.
+ */
+class Profile {
+private:
+    std::array<PhaseStatistics, phaseCount> phases {};      ///< Statistics of each phase.
+    std::array<size_t, counterCount> counters {};           ///< Value of each counter.
+
+public:
+    /**
+     * @brief Records one call of a phase.
+     * @param[in] phase The phase.
+     * @param[in] duration Run time of the call.
+     */
+    inline void record(Phase phase, std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Increments a counter.
+     * @param[in] counter The counter.
+     * @param[in] increment Value that is added to the counter.
+     */
+    inline void count(Counter counter, size_t increment) { counters[static_cast<size_t>(counter)] += increment; }
+
+    /**
+     * @brief Returns the statistics of a phase.
+     * @param[in] phase The phase.
+     * @returns The statistics of the phase.
+     */
+    [[nodiscard]] inline const PhaseStatistics& getPhase(Phase phase) const { return phases[static_cast<size_t>(phase)]; }
+
+    /**
+     * @brief Returns the value of a counter.
+     * @param[in] counter The counter.
+     * @returns Value of the counter.
+     */
+    [[nodiscard]] inline size_t getCounter(Counter counter) const { return counters[static_cast<size_t>(counter)]; }
+
+    /**
+     * @brief Print the total time, the number of calls and the mean time of each phase that was called, and all counters.
+     */
+    inline void print() const;
+};
+
+/**
+ * @brief Access to the profile that is currently recorded on this thread. When no profile is active, i.e., profiling
+ * is disabled, timers and counters only check a thread-local pointer.
+ */
+class Profiler {
+private:
+    static inline Profile*& active();
+
+public:
+    /**
+     * @brief Returns the profile that is currently recorded on this thread.
+     * @returns Pointer to the active profile, or nullptr if profiling is disabled.
+     */
+    [[nodiscard]] static inline Profile* getActive() { return active(); }
+
+    /**
+     * @brief Increments a counter of the active profile, if any.
+     * @param[in] counter The counter.
+     * @param[in] increment Value that is added to the counter.
+     */
+    static inline void count(Counter counter, size_t increment = 1) {
+        if (Profile* profile = active()) {
+            profile->count(counter, increment);
+        }
+    }
+
+    friend class ProfileScope;
+};
+
+/**
+ * @brief Activates a profile on this thread for the lifetime of the scope and restores the previous profile afterwards.
+ */
+class ProfileScope {
+private:
+    Profile* previous;
+
+public:
+    /**
+     * @brief Activates a profile.
+     * @param[in] profile The profile that records the following phases, or nullptr to disable profiling.
+     */
+    explicit ProfileScope(Profile* profile) : previous(Profiler::active()) { Profiler::active() = profile; }
+
+    ~ProfileScope() { Profiler::active() = previous; }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+/**
+ * @brief Measures the run time of a phase from its construction until the end of the scope and records it in the
+ * active profile, if any.
+ */
+class ScopedTimer {
+private:
+    Profile* profile;
+    Phase phase;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    /**
+     * @brief Starts the timer of a phase.
+     * @param[in] phase The phase that is measured.
+     */
+    explicit ScopedTimer(Phase phase_) : profile(Profiler::getActive()), phase(phase_) {
+        if (profile != nullptr) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer() {
+        if (profile != nullptr) {
+            profile->record(phase, std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+}   // namespace result
@@ -0,0 +1,72 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+namespace result {
+
+inline std::string phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::NodalAnalysis: return "nodalAnalysis";
+        case Phase::NodalSolve: return "nodalSolve";
+        case Phase::ComputeEvents: return "computeEvents";
+        case Phase::PerformEvent: return "performEvent";
+        case Phase::UpdateMixtures: return "updateMixtures";
+        case Phase::MembraneExchange: return "membraneExchange";
+        case Phase::LbmSolve: return "lbmSolve";
+        case Phase::WriteVTK: return "writeVTK";
+        case Phase::SaveState: return "saveState";
+        case Phase::Count: break;
+    }
+    throw std::invalid_argument("Unknown profiler phase.");
+}
+
+inline std::string counterName(Counter counter) {
+    switch (counter) {
+        case Counter::NodalUnknowns: return "nodalUnknowns";
+        case Counter::ComputedEvents: return "computedEvents";
+        case Counter::LbmSteps: return "lbmSteps";
+        case Counter::Count: break;
+    }
+    throw std::invalid_argument("Unknown profiler counter.");
+}
+
+inline void Profile::record(Phase phase, std::chrono::nanoseconds duration) {
+    PhaseStatistics& statistics = phases[static_cast<size_t>(phase)];
+    double seconds = std::chrono::duration<double>(duration).count();
+    statistics.minTime = (statistics.calls == 0) ? seconds : std::min(statistics.minTime, seconds);
+    statistics.maxTime = std::max(statistics.maxTime, seconds);
+    statistics.totalTime += seconds;
+    statistics.calls++;
+
+    size_t bucket = 0;
+    for (auto ns = static_cast<unsigned long long>(std::max<std::chrono::nanoseconds::rep>(duration.count(), 1)); ns > 1; ns >>= 1) {
+        bucket++;
+    }
+    statistics.histogram[std::min(bucket, histogramBuckets - 1)]++;
+}
+
+inline void Profile::print() const {
+    std::cout << std::left << std::setw(20) << "phase" << std::right << std::setw(12) << "calls"
+              << std::setw(16) << "total [s]" << std::setw(16) << "mean [s]" << std::endl;
+    for (size_t i = 0; i < phaseCount; ++i) {
+        const PhaseStatistics& statistics = phases[i];
+        if (statistics.calls == 0) {
+            continue;
+        }
+        std::cout << std::left << std::setw(20) << phaseName(Phase(i)) << std::right << std::setw(12) << statistics.calls
+                  << std::setw(16) << statistics.totalTime << std::setw(16) << statistics.totalTime / statistics.calls << std::endl;
+    }
+    for (size_t i = 0; i < counterCount; ++i) {
+        std::cout << std::left << std::setw(20) << counterName(Counter(i)) << std::right << std::setw(12) << counters[i] << std::endl;
+    }
+}
+
+inline Profile*& Profiler::active() {
+    static thread_local Profile* profile = nullptr;
+    return profile;
+}
+
+}   // namespace result
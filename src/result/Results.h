@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <fstream>
 #include <string>
 #include <unordered_map>
@@ -53,11 +54,17 @@ class HybridConcentration;
 
 namespace result {
 
+// Forward declared dependencies
+class Profile;
+
 template<typename T>
 class SimulationResult;
 
 /**
  * @brief Struct to contain a state specified by time, an unordered map of pressures, an unordered map of flow rates, a vector of clogged channel ids, an unordered map of droplet positions.
+ * A state can be stored as a delta, i.e., it only contains the pressures and flow rates that changed since the previous state.
+ * The full pressures or flow rates of a delta state are reconstructed from the preceding keyframe on each access, they are not cached.
+ * Consecutive states are best read by walking forward from a keyframe with applyTo.
  */
 template<typename T>
 class State {
@@ -70,6 +77,7 @@ private:
     std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions;  ///< Only contains the position of mixtures that are currently inside the network (key is the channel id).
     std::unordered_map<int, int> filledEdges;                           ///< Contains the mixture ids that fill the edges of the network <EdgeID, MixtureID>
     std::unordered_map<int, std::string> vtkFiles;                      ///< Contains the vtk filenames that were generated during the step.
+    std::shared_ptr<const State<T>> base = nullptr;                     ///< Previous state if this state is a delta, nullptr for a keyframe.
 
     /**
      * @brief Constructs a state, which represent a time step during a simulation.
@@ -137,18 +145,40 @@ private:
      */
     State(int id, T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions, std::unordered_map<int, int> filledEdges, std::unordered_map<int, std::string> vtkFiles);
 
+    /**
+     * @brief Reconstructs either the full pressures or the full flow rates of this state, by applying the deltas since
+     * the last keyframe in order.
+     * @param[in] values The member that is reconstructed, i.e., &State::pressures or &State::flowRates.
+     * @return All values of this state.
+     */
+    [[nodiscard]] std::unordered_map<int, T> reconstruct(std::unordered_map<int, T> State<T>::* values) const;
+
 public:
     /**
      * @brief Function to get pressure at a specific node.
-     * @return Pressures of this state in Pa.
+     * @return Pressures of this state in Pa. Reconstructed from the last keyframe for a delta state.
      */
-    [[nodiscard]] inline const std::unordered_map<int, T>& getPressures() const { return pressures; }
+    [[nodiscard]] std::unordered_map<int, T> getPressures() const;
 
     /**
      * @brief Function to get flow rate at a specific channel.
-     * @return Flowrates of this state in m^3/s.
+     * @return Flowrates of this state in m^3/s. Reconstructed from the last keyframe for a delta state.
      */
-    [[nodiscard]] inline const std::unordered_map<int, T>& getFlowRates() const { return flowRates; }
+    [[nodiscard]] std::unordered_map<int, T> getFlowRates() const;
+
+    /**
+     * @brief Applies the values of this state to the full pressures and flow rates of the previous state. Allows to walk
+     * through the states in order, reusing the same maps, without reconstructing each delta state from its keyframe.
+     * @param[in,out] fullPressures All pressures of the previous state, replaced by those of this state.
+     * @param[in,out] fullFlowRates All flow rates of the previous state, replaced by those of this state.
+     */
+    void applyTo(std::unordered_map<int, T>& fullPressures, std::unordered_map<int, T>& fullFlowRates) const;
+
+    /**
+     * @brief Whether the state is stored as a delta to the previous state.
+     * @return True for a delta, false for a keyframe.
+     */
+    [[nodiscard]] inline bool isDelta() const { return base != nullptr; }
 
     /**
      * TODO:
@@ -189,6 +219,19 @@ public:
     friend class SimulationResult<T>;
 };
 
+/**
+ * @brief Dense, row-major tables of the pressures and flow rates of all states of a simulation result.
+ * Values that are missing in a state are NaN.
+ */
+template<typename T>
+struct StateTable {
+    std::vector<T> times;           ///< Simulation time of each state.
+    std::vector<int> nodeIds;       ///< Node id of each pressure column, in ascending order.
+    std::vector<int> edgeIds;       ///< Edge id of each flow rate column, in ascending order.
+    std::vector<T> pressures;       ///< Pressures of all states, nStates x nNodes.
+    std::vector<T> flowRates;       ///< Flow rates of all states, nStates x nEdges.
+};
+
 /**
  * @brief Struct to contain the simulation result specified by a chip, an unordered map of fluids, an unordered map of droplets, an unordered map of injections, a vector of states, a continuous fluid id, the maximal adaptive time step and the id of a resistance model.
  */
@@ -203,6 +246,14 @@ private:
     std::unordered_map<int, sim::Specie<T>>* species;
     std::unordered_map<int, int> filledEdges;
     std::vector<std::shared_ptr<const State<T>>> states;            /// Contains all states ordered according to their simulation time (beginning at the start of the simulation).    
+    std::unordered_map<int, std::vector<int>> thetaSchedules;      /// Contains the theta used in each coupling round for the CFD simulators with an adaptive update scheme <simulatorId, schedule>.
+    mutable std::shared_ptr<const StateTable<T>> stateTable;        /// Dense tables of the states, built on request and rebuilt when states were added.
+    mutable std::mutex stateTableMutex;                             /// Guards the construction of the state table.
+    std::shared_ptr<const Profile> profile;                         /// Run times and counters of the simulation, if profiling was enabled.
+    std::shared_ptr<const State<T>> deltaBase = nullptr;            /// Last state to which the next delta state refers, nullptr if the next state must be a keyframe.
+    size_t keyframeInterval = 64;                                   /// Every keyframeInterval-th state of a chain is stored as a keyframe.
+    size_t deltaCount = 0;                                          /// Number of delta states since the last keyframe.
+    size_t savedRevision = 0;                                       /// Network revision at which the last state of the chain was stored.
 
     int continuousPhaseId;              /// Fluid id which served as the continuous phase.
     T maximalAdaptiveTimeStep;     /// Value for the maximal adaptive time step that was used.
@@ -244,14 +295,35 @@ private:
     /**
      * @brief Adds a state to the simulation results.
      * @param[in] state
+     * @param[in] keyframe Whether the pressures and flow rates are complete. Otherwise, they only contain the values that changed since the previous state.
     */
-    void addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, sim::DropletPosition<T>> dropletPositions);
+    void addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, sim::DropletPosition<T>> dropletPositions, bool keyframe = true);
 
     /**
      * @brief Adds a state to the simulation results.
      * @param[in] state
+     * @param[in] keyframe Whether the pressures and flow rates are complete. Otherwise, they only contain the values that changed since the previous state.
     */
-    void addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions);
+    void addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions, bool keyframe = true);
+
+    /**
+     * @brief Whether the next state must be stored as a keyframe, i.e., with all pressures and flow rates.
+     * @return True if there is no previous state to refer to, or if the keyframe interval is reached.
+     */
+    [[nodiscard]] inline bool isKeyframeDue() const { return deltaBase == nullptr || deltaCount + 1 >= keyframeInterval; }
+
+    /**
+     * @brief Get the network revision at which the last state was stored. Values with a larger revision changed since.
+     * @return The revision.
+     */
+    [[nodiscard]] inline size_t getSavedRevision() const { return savedRevision; }
+
+    /**
+     * @brief Links a new state to the previous state, if it is a delta, and records it as the base of the next delta.
+     * @param[in] state The new state.
+     * @param[in] keyframe Whether the new state is a keyframe.
+     */
+    void chainState(const std::shared_ptr<State<T>>& state, bool keyframe);
 
     /**
      * @brief Adds a state to the simulation results.
@@ -264,6 +336,13 @@ private:
      */
     void setMixtures(std::unordered_map<size_t, std::shared_ptr<sim::Mixture<T>>> mixtures);
 
+    /**
+     * @brief Stores the theta schedule of the adaptive update scheme of a CFD simulator.
+     * @param[in] simulatorId The id of the CFD simulator.
+     * @param[in] schedule The theta that was used in each coupling round.
+     */
+    void setThetaSchedule(int simulatorId, std::vector<int> schedule);
+
 public:
     /**
      * @brief Get the simulated states that were stored during simulation.
@@ -303,6 +382,25 @@ public:
 
     void writeMixture(int mixtureId);
 
+    /**
+     * @brief Get the theta schedules of the CFD simulators with an adaptive update scheme.
+     * @return Map of theta schedules <simulatorId, schedule>
+     */
+    [[nodiscard]] inline const std::unordered_map<int, std::vector<int>>& getThetaSchedules() const { return thetaSchedules; }
+
+    /**
+     * @brief Get the pressures and flow rates of all states as dense tables. The table is a snapshot, a new table
+     * is built when states were added since the previous call.
+     * @return Shared pointer to the state table.
+     */
+    [[nodiscard]] std::shared_ptr<const StateTable<T>> getStateTable() const;
+
+    /**
+     * @brief Get the run times and counters that were recorded during the simulation.
+     * @return Shared pointer to the profile, or nullptr if profiling was disabled.
+     */
+    [[nodiscard]] inline std::shared_ptr<const Profile> getProfile() const { return profile; }
+
     // Friend class definition
     friend class sim::Simulation<T>;
     friend class sim::AbstractContinuous<T>;
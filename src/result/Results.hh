@@ -1,4 +1,7 @@
 #include "Results.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 namespace result {
 
@@ -29,19 +32,69 @@ template<typename T>
 State<T>::State(int id_, T time_, std::unordered_map<int, T> pressures_, std::unordered_map<int, T> flowRates_, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions_, std::unordered_map<int, int> filledEdges_, std::unordered_map<int, std::string> vtkFiles_) 
     : id(id_), time(time_), pressures(pressures_), flowRates(flowRates_), mixturePositions(mixturePositions_), filledEdges(filledEdges_), vtkFiles(vtkFiles_) { }
 
+template<typename T>
+std::unordered_map<int, T> State<T>::reconstruct(std::unordered_map<int, T> State<T>::* values) const {
+    // collect the deltas back to the last keyframe
+    std::vector<const State<T>*> chain { this };
+    while (chain.back()->base != nullptr) {
+        chain.push_back(chain.back()->base.get());
+    }
+    // apply them from the keyframe to this state
+    std::unordered_map<int, T> fullValues = chain.back()->*values;
+    for (auto state = std::next(chain.rbegin()); state != chain.rend(); ++state) {
+        for (auto& [id, value] : (*state)->*values) {
+            fullValues.insert_or_assign(id, value);
+        }
+    }
+    return fullValues;
+}
+
+template<typename T>
+std::unordered_map<int, T> State<T>::getPressures() const {
+    if (base == nullptr) {
+        return pressures;
+    }
+    return reconstruct(&State<T>::pressures);
+}
+
+template<typename T>
+std::unordered_map<int, T> State<T>::getFlowRates() const {
+    if (base == nullptr) {
+        return flowRates;
+    }
+    return reconstruct(&State<T>::flowRates);
+}
+
+template<typename T>
+void State<T>::applyTo(std::unordered_map<int, T>& fullPressures, std::unordered_map<int, T>& fullFlowRates) const {
+    if (base == nullptr) {
+        fullPressures = pressures;
+        fullFlowRates = flowRates;
+        return;
+    }
+    for (auto& [nodeId, pressure] : pressures) {
+        fullPressures.insert_or_assign(nodeId, pressure);
+    }
+    for (auto& [edgeId, flowRate] : flowRates) {
+        fullFlowRates.insert_or_assign(edgeId, flowRate);
+    }
+}
+
 template<typename T>
 void State<T>::printState() const {
     std::cout << "\n";
     // print the current timestep
     std::cout << "[Result] Timestep: " << time << std::endl;
     std::cout << "\n";
+    auto fullPressures = getPressures();
+    auto fullFlowRates = getFlowRates();
     // print the pressures in all nodes
-    for (auto& [key, pressure] : pressures) {
+    for (auto& [key, pressure] : fullPressures) {
         std::cout << "\t[Result] Node " << key << " has a pressure of " << pressure << " Pa.\n";
     }
     std::cout << "\n";
     // print the flow rates in all channels
-    for (auto& [key, flowRate] : flowRates) {
+    for (auto& [key, flowRate] : fullFlowRates) {
         std::cout << "\t[Result] Channel " << key << " has a flow rate of " << flowRate << " m^3/s.\n";
     }
     std::cout << "\n";
@@ -96,6 +149,7 @@ template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates) {
     int id = states.size();
     std::shared_ptr<State<T>> newState = std::shared_ptr<State<T>>(new State<T>(id, time, pressures, flowRates));
+    deltaBase = nullptr;
     states.push_back(std::move(newState));
 }
 
@@ -103,6 +157,7 @@ template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, std::string> vtkFiles) {
     int id = states.size();
     std::shared_ptr<State<T>> newState = std::shared_ptr<State<T>>(new State<T>(id, time, vtkFiles));
+    deltaBase = nullptr;
     states.push_back(std::move(newState));
 }
 
@@ -110,18 +165,20 @@ template<typename T>
 void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::string> vtkFiles) {
     int id = states.size();
     std::shared_ptr<State<T>> newState = std::shared_ptr<State<T>>(new State<T>(id, time, pressures, flowRates, vtkFiles));
+    deltaBase = nullptr;
     states.push_back(std::move(newState));
 }
 
 template<typename T>
-void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, sim::DropletPosition<T>> dropletPositions) {
+void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, sim::DropletPosition<T>> dropletPositions, bool keyframe) {
     int id = states.size();
     std::shared_ptr<State<T>> newState = std::shared_ptr<State<T>>(new State<T>(id, time, pressures, flowRates, dropletPositions));
+    chainState(newState, keyframe);
     states.push_back(std::move(newState));
 }
 
 template<typename T>
-void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions) {
+void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures, std::unordered_map<int, T> flowRates, std::unordered_map<int, std::deque<sim::MixturePosition<T>>> mixturePositions, bool keyframe) {
     int id = states.size();
     for ( auto& [channelId, deque] : mixturePositions ) {
         if (filledEdges.count(channelId)) {
@@ -131,6 +188,7 @@ void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures,
         }
     }
     std::shared_ptr<State<T>> newState = std::shared_ptr<State<T>>(new State<T>(id, time, pressures, flowRates, mixturePositions, filledEdges));
+    chainState(newState, keyframe);
     states.push_back(std::move(newState));
 }
 
@@ -145,9 +203,24 @@ void SimulationResult<T>::addState(T time, std::unordered_map<int, T> pressures,
         }
     }
     std::shared_ptr<State<T>> newState = std::shared_ptr<State<T>>(new State<T>(id, time, pressures, flowRates, mixturePositions, filledEdges, vtkFiles));
+    deltaBase = nullptr;
     states.push_back(std::move(newState));
 }
 
+template<typename T>
+void SimulationResult<T>::chainState(const std::shared_ptr<State<T>>& state, bool keyframe) {
+    if (keyframe) {
+        deltaCount = 0;
+    } else {
+        if (deltaBase == nullptr) {
+            throw std::logic_error("Cannot add a delta state without a previous state.");
+        }
+        state->base = deltaBase;
+        ++deltaCount;
+    }
+    deltaBase = state;
+    savedRevision = arch::currentRevision();
+}
 
 template<typename T>
 void SimulationResult<T>::printStates() const {
@@ -163,6 +236,60 @@ void SimulationResult<T>::setMixtures(std::unordered_map<size_t, std::shared_ptr
     }
 }
 
+template<typename T>
+void SimulationResult<T>::setThetaSchedule(int simulatorId, std::vector<int> schedule) {
+    thetaSchedules.insert_or_assign(simulatorId, std::move(schedule));
+}
+
+template<typename T>
+std::shared_ptr<const StateTable<T>> SimulationResult<T>::getStateTable() const {
+    std::lock_guard<std::mutex> lock(stateTableMutex);
+    if (stateTable != nullptr && stateTable->times.size() == states.size()) {
+        return stateTable;
+    }
+
+    // The delta states only add ids to their predecessor, hence, the ids of the stored values suffice
+    auto table = std::make_shared<StateTable<T>>();
+    for (auto& state : states) {
+        for (auto& [nodeId, pressure] : state->pressures) {
+            table->nodeIds.push_back(nodeId);
+        }
+        for (auto& [edgeId, flowRate] : state->flowRates) {
+            table->edgeIds.push_back(edgeId);
+        }
+    }
+    auto sortUnique = [](std::vector<int>& ids) {
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    };
+    sortUnique(table->nodeIds);
+    sortUnique(table->edgeIds);
+
+    // Fill the tables row by row, ids that are missing in a state remain NaN
+    auto fillRow = [](const std::unordered_map<int, T>& values, const std::vector<int>& ids, T* row) {
+        for (auto& [id, value] : values) {
+            auto it = std::lower_bound(ids.begin(), ids.end(), id);
+            row[it - ids.begin()] = value;
+        }
+    };
+    const size_t nNodes = table->nodeIds.size();
+    const size_t nEdges = table->edgeIds.size();
+    table->times.reserve(states.size());
+    table->pressures.assign(states.size() * nNodes, std::numeric_limits<T>::quiet_NaN());
+    table->flowRates.assign(states.size() * nEdges, std::numeric_limits<T>::quiet_NaN());
+    std::unordered_map<int, T> fullPressures;
+    std::unordered_map<int, T> fullFlowRates;
+    for (size_t i = 0; i < states.size(); ++i) {
+        table->times.push_back(states[i]->getTime());
+        states[i]->applyTo(fullPressures, fullFlowRates);
+        fillRow(fullPressures, table->nodeIds, table->pressures.data() + i * nNodes);
+        fillRow(fullFlowRates, table->edgeIds, table->flowRates.data() + i * nEdges);
+    }
+
+    stateTable = table;
+    return stateTable;
+}
+
 template<typename T>
 void SimulationResult<T>::printMixtures() {
 
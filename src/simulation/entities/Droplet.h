@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -319,7 +320,7 @@ class Droplet {
 template<typename T>
 class DropletImplementation : public Droplet<T> {
   private:
-    inline static int dropletCounter = 0;                           ///< Global counter for amount of created droplet objects.
+    inline static std::atomic<int> dropletCounter { 0 };                           ///< Global counter for amount of created droplet objects.
     T const slipFactor = 1.28;                                      ///< Slip factor of droplets.
     DropletState dropletState = DropletState::INJECTION;            ///< Current state of the droplet
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -36,7 +37,7 @@ class DiffusiveMixture;
 template<typename T>
 class Fluid {
   private:
-    inline static int fluidCounter = 0;                     ///< Global counter for amount of created fluid objects.
+    inline static std::atomic<int> fluidCounter { 0 };                     ///< Global counter for amount of created fluid objects.
     size_t const id;                                        ///< Unique identifier of the fluid.
     size_t simHash = 0;                                     ///< Hash of the simulation that created this fluid object.
     std::string name = "";                                  ///< Name of the fluid.
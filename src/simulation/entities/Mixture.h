@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <algorithm>
 #include <cassert>
 #include <functional>
@@ -76,7 +77,7 @@ struct MixturePosition {
 template<typename T>
 class Mixture {
 private:
-    inline static size_t mixtureCounter = 0;                        ///< Global counter for amount of created mixture objects.
+    inline static std::atomic<size_t> mixtureCounter { 0 };                        ///< Global counter for amount of created mixture objects.
     size_t simHash = 0;                                             ///< Hash of the simulation that created this mixture object.
     const size_t id;                                                ///< Unique identifier of the mixture.   
     std::string name = "";                                          ///< Name of the mixture.   
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -32,7 +33,7 @@ class Mixture;
 template<typename T>
 class Specie {
   private:
-    inline static size_t specieCounter = 0; ///< Global counter for amount of created specie objects.
+    inline static std::atomic<size_t> specieCounter { 0 }; ///< Global counter for amount of created specie objects.
     size_t simHash;                         ///< Hash of the simulation that created this specie object.
     const size_t id;                        ///< Unique identifier of the specie.
     std::string name = "";                  ///< Name of the specie.
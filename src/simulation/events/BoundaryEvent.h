@@ -52,6 +52,11 @@ class BoundaryHeadEvent : public Event<T> {
      */
     void performEvent() override;
 
+    /**
+     * @brief Returns the droplet of the boundary and the node that the boundary reaches.
+     */
+    std::optional<EventFootprint> getFootprint() const override;
+
     /**
      * @brief Print the boundary head event.
      */
@@ -83,6 +88,11 @@ class BoundaryTailEvent : public Event<T> {
      */
     void performEvent() override;
 
+    /**
+     * @brief Returns the droplet of the boundary and the node that the boundary leaves.
+     */
+    std::optional<EventFootprint> getFootprint() const override;
+
     /**
      * @brief print the boundary tail event.
      */
@@ -70,6 +70,13 @@ void BoundaryHeadEvent<T>::performEvent() {
     boundary.setState(BoundaryState::NORMAL);
 }
 
+template<typename T>
+std::optional<EventFootprint> BoundaryHeadEvent<T>::getFootprint() const {
+    auto boundaryChannel = boundary.getChannelPosition().getChannel();
+    size_t node = boundary.isVolumeTowardsNodeA() ? boundaryChannel->getNodeBId() : boundaryChannel->getNodeAId();
+    return EventFootprint { droplet.getId(), { node } };
+}
+
 template<typename T>
 void BoundaryHeadEvent<T>::print() {
     std::cout << "\n Boundary Head Event at t=" << this->time << " with priority " << this->priority << "\n" << std::endl;
@@ -115,6 +122,11 @@ void BoundaryTailEvent<T>::performEvent() {
     }
 }
 
+template<typename T>
+std::optional<EventFootprint> BoundaryTailEvent<T>::getFootprint() const {
+    return EventFootprint { droplet.getId(), { boundary.getReferenceNode() } };
+}
+
 template<typename T>
 void BoundaryTailEvent<T>::print() {
     std::cout << "\n Boundary Tail Event at t=" << this->time << " with priority " << this->priority << "\n" << std::endl;
@@ -3,8 +3,19 @@
  */
 #pragma once
 
+#include <optional>
+#include <vector>
+
 namespace sim {
 
+/**
+ * @brief The droplet and nodes that are changed or inspected when an event is performed.
+ */
+struct EventFootprint {
+    size_t dropletId;               ///< Id of the droplet that is changed by the event.
+    std::vector<size_t> nodeIds;    ///< Ids of the nodes at which the event takes place.
+};
+
 /**
  * @brief
  * Interface for all events.
@@ -45,6 +56,13 @@ class Event {
      */
     virtual void performEvent() = 0;
 
+    /**
+     * @brief Returns the droplet and nodes that are affected by the event. Events that take place at the same time and
+     * have disjoint footprints can be performed together, without solving the network in between.
+     * @return The footprint, or std::nullopt if the event must be performed on its own.
+     */
+    virtual std::optional<EventFootprint> getFootprint() const { return std::nullopt; }
+
     /**
      * @brief Function that prints the contents of this Event.
     */
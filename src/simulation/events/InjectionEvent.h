@@ -40,6 +40,11 @@ class DropletInjectionEvent : public Event<T> {
      */
     void performEvent() override;
 
+    /**
+     * @brief Returns the injected droplet and the nodes of the injection channel.
+     */
+    std::optional<EventFootprint> getFootprint() const override;
+
     /**
      * @brief Print the injection event.
      */
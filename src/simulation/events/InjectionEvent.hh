@@ -33,6 +33,12 @@ void DropletInjectionEvent<T>::performEvent() {
     droplet->setDropletState(DropletState::NETWORK);
 }
 
+template<typename T>
+std::optional<EventFootprint> DropletInjectionEvent<T>::getFootprint() const {
+    auto channel = injection.getInjectionChannel();
+    return EventFootprint { injection.getDroplet()->getId(), { channel->getNodeAId(), channel->getNodeBId() } };
+}
+
 template<typename T>
 void DropletInjectionEvent<T>::print() {
     std::cout << "\n Droplet Injection Event at t=" << this->time << " with priority " << this->priority << "\n" << std::endl;
@@ -10,11 +10,17 @@
 #include <deque>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <queue>
 #include <set>
 #include <unordered_map>
 #include <vector>
 
+#include "Eigen/Sparse"
+
+#include "../../architecture/definitions/DenseIndex.h"
+
 namespace arch { 
 
 // Forward declared dependencies
@@ -38,6 +44,9 @@ class AbstractConcentration;
 template<typename T>
 class AbstractMembrane;
 
+template<typename T>
+class ConcentrationSemantics;
+
 template<typename T>
 class HybridConcentration;
 
@@ -97,6 +106,14 @@ protected:
     std::unordered_map<size_t, size_t> filledEdges;                                 ///< Which edges are currently filled with a single mixture <EdgeID, MixtureID>
     std::unordered_multimap<size_t, size_t> permanentMixtureInjections;             ///< Permanent mixture injections which are currently active, <ChannelID, MixtureIDs>
 
+    /**
+     * @brief Order the nodes of the network topologically along the flow direction of the channels.
+     * @param[in] network Pointer to the network.
+     * @param[out] cyclicNodes The nodes that lie on, or downstream of, a recirculation and could not be ordered.
+     * @returns The ids of the ordered nodes, upstream nodes first.
+     */
+    std::vector<size_t> topologicalNodeOrder(arch::Network<T>* network, std::vector<size_t>& cyclicNodes) const;
+
 public:
 
     /**
@@ -111,6 +128,14 @@ public:
      */
     virtual void propagateSpecies(arch::Network<T>* network, HybridConcentration<T>* sim) = 0;
 
+    /**
+     * @brief Propagate all the species through a network without CFD modules for a steady-state simulation,
+     * directly from the flow rates of the nodal analysis. The resulting mixtures are added to the simulation.
+     * @param[in] network Pointer to the network.
+     * @param[in] sim Pointer to the simulation.
+     */
+    virtual void propagateSpecies(arch::Network<T>* network, AbstractConcentration<T>* sim) = 0;
+
     /**
      * @brief Returns the current minimal timestep.
      * @return The minimal timestep in s.
@@ -214,9 +239,37 @@ private:
     std::unordered_map<size_t, size_t> mixtureOutflowAtNode;                            ///< Unordered map to track mixtures flowing out of nodes <nodeId, mixtureId>.
     std::unordered_map<int, T> totalInflowVolumeAtNode;                                 ///< Unordered map to track the total volumetric flow entering a node.
     std::unordered_map<int, bool> createMixture;                                        ///< Unordered map to track whether a new mixture is created at a node.
+    std::unordered_map<size_t, size_t> injectedChannels;                                ///< Unordered map to track channels filled by an injection in a steady-state simulation <channelId, mixtureId>.
+
+    using MixtureLookup = std::function<const std::unordered_map<size_t, T>&(size_t)>;      ///< Returns the specie concentrations of a mixture.
+    using MixtureFactory = std::function<size_t(const std::unordered_map<size_t, T>&)>;    ///< Creates a mixture from specie concentrations and returns its id.
 
     int generateInflows(size_t nodeId, T timeStep, arch::Network<T>* network);
 
+    /**
+     * @brief Compute the total volumetric flow rate entering each node, stored in totalInflowVolumeAtNode.
+     * @param[in] network Pointer to the network.
+     */
+    void updateTotalInflowVolume(arch::Network<T>* network);
+
+    /**
+     * @brief Propagate the node outflows and injections through the network for a steady-state simulation.
+     * @param[in] network Pointer to the network.
+     * @param[in] lookup Returns the specie concentrations of a mixture.
+     * @param[in] factory Creates new mixtures.
+     */
+    void propagateSteadyState(arch::Network<T>* network, const MixtureLookup& lookup, const MixtureFactory& factory);
+
+    /**
+     * @brief Mixture lookup for the temporary mixtures of a hybrid simulation.
+     */
+    MixtureLookup tmpMixtureLookup(const std::vector<Mixture<T>>& tmpMixtures);
+
+    /**
+     * @brief Mixture factory for the temporary mixtures of a hybrid simulation.
+     */
+    MixtureFactory tmpMixtureFactory(HybridConcentration<T>* sim, std::vector<Mixture<T>>& tmpMixtures);
+
 public:
 
     /**
@@ -279,10 +332,18 @@ public:
     void clean(arch::Network<T>* network);
 
     /**
-     * @brief Propagate all the species through a network for a steady-state simulation
+     * @brief Propagate all the species through a network for a steady-state simulation. The nodes are visited
+     * once, in topological order of the flow field. Nodes on or downstream of a recirculation are resolved
+     * by solving the linear mixing balance.
      */
     void propagateSpecies(arch::Network<T>* network, HybridConcentration<T>* sim) override;
 
+    /**
+     * @brief Propagate all the species through a network without CFD modules for a steady-state simulation.
+     * Mixture injections fill their injection channel, regardless of their injection time.
+     */
+    void propagateSpecies(arch::Network<T>* network, AbstractConcentration<T>* sim) override;
+
     /**
      * @brief From the mixtureInjections and CFD simulators, generate temporary mxtures that 
      * flow into the network at correspondingnode entry points.
@@ -295,11 +356,37 @@ public:
      */
     void channelPropagation(arch::Network<T>* network);
 
+    /**
+     * @brief Propagate the outflow mixture of a single node through its outflowing channels, without considering time steps
+     * @param[in] nodeId Id of the node.
+     * @param[in] network Pointer to the network.
+     */
+    void channelPropagation(size_t nodeId, arch::Network<T>* network);
+
     /**
      * @brief From the node's inflows, generate the node outflow
      */
     bool updateNodeOutflow(HybridConcentration<T>* sim, std::vector<Mixture<T>>& tmpMixtures);
 
+    /**
+     * @brief From the inflows of a single node, generate the node outflow
+     * @param[in] nodeId Id of the node.
+     * @param[in] lookup Returns the specie concentrations of a mixture.
+     * @param[in] factory Creates new mixtures.
+     * @returns Whether the outflow of the node changed.
+     */
+    bool updateNodeOutflow(size_t nodeId, const MixtureLookup& lookup, const MixtureFactory& factory);
+
+    /**
+     * @brief Solve the steady-state mixing balance for nodes that lie on, or downstream of, a recirculation in the
+     * flow field, and propagate the resulting mixtures into their outflowing channels.
+     * @param[in] nodes Ids of the nodes that could not be ordered topologically.
+     * @param[in] network Pointer to the network.
+     * @param[in] lookup Returns the specie concentrations of a mixture.
+     * @param[in] factory Creates new mixtures.
+     */
+    void solveCyclicMixing(const std::vector<size_t>& nodes, arch::Network<T>* network, const MixtureLookup& lookup, const MixtureFactory& factory);
+
     void storeConcentrations(HybridConcentration<T>* sim, const std::vector<Mixture<T>>& tmpMixtures);
 
     /**
@@ -355,9 +442,9 @@ public:
     void generateInflows(T timeStep, arch::Network<T>* network, AbstractConcentration<T>* sim, std::unordered_map<size_t, std::shared_ptr<Mixture<T>>>& mixtures);
 
     /**
-     * @brief Generate a new inflow in case a mixture has reached channel end for hybrid simulation. Invoked by propagateSpecies.
+     * @brief Generate a new inflow in case a mixture has reached channel end for a steady-state simulation. Invoked by propagateSpecies.
     */
-    void generateInflows(arch::Network<T>* network, HybridConcentration<T>* sim);
+    void generateInflows(arch::Network<T>* network, ConcentrationSemantics<T>* sim);
 
     void topologyAnalysis(arch::Network<T>* network, size_t nodeId);
 
@@ -368,6 +455,15 @@ public:
      */
     void propagateSpecies(arch::Network<T>* network, HybridConcentration<T>* sim) override;
 
+    /**
+     * @brief Propagate all the species through a network without CFD modules for a steady-state simulation.
+     * Mixture injections fill their injection channel, regardless of their injection time.
+     * @param[in] network Pointer to the network.
+     * @param[in] sim Pointer to the abstract mixing simulation.
+     * @throws std::runtime_error if the flow field recirculates.
+     */
+    void propagateSpecies(arch::Network<T>* network, AbstractConcentration<T>* sim) override;
+
     /**
      * @brief Initialize the node outflow from mixture injections and CFD simulators by updating 
      * the mixturesInEdge container for introduced mixtures in a hybrid mixing simulation.
@@ -56,6 +56,54 @@ void MixingModel<T>::fixedMinimalTimeStep(arch::Network<T>* network) {
     }
 }
 
+template<typename T>
+std::vector<size_t> MixingModel<T>::topologicalNodeOrder(arch::Network<T>* network, std::vector<size_t>& cyclicNodes) const {
+    // Kahn's algorithm on the directed graph of channels with non-zero flow
+    std::unordered_map<size_t, int> inflowChannels;
+    std::queue<size_t> readyNodes;
+    for (auto& [nodeId, node] : network->getNodes()) {
+        int count = 0;
+        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+            if ((channel->getFlowRate() > 0.0 && channel->getNodeBId() == nodeId) || (channel->getFlowRate() < 0.0 && channel->getNodeAId() == nodeId)) {
+                count++;
+            }
+        }
+        inflowChannels.try_emplace(nodeId, count);
+        if (count == 0) {
+            readyNodes.push(nodeId);
+        }
+    }
+
+    std::vector<size_t> order;
+    order.reserve(inflowChannels.size());
+    while (!readyNodes.empty()) {
+        size_t nodeId = readyNodes.front();
+        readyNodes.pop();
+        order.push_back(nodeId);
+        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+            size_t oppositeNode;
+            if (channel->getFlowRate() > 0.0 && channel->getNodeAId() == nodeId) {
+                oppositeNode = channel->getNodeBId();
+            } else if (channel->getFlowRate() < 0.0 && channel->getNodeBId() == nodeId) {
+                oppositeNode = channel->getNodeAId();
+            } else {
+                continue;
+            }
+            if (--inflowChannels.at(oppositeNode) == 0) {
+                readyNodes.push(oppositeNode);
+            }
+        }
+    }
+
+    cyclicNodes.clear();
+    for (auto& [nodeId, count] : inflowChannels) {
+        if (count > 0) {
+            cyclicNodes.push_back(nodeId);
+        }
+    }
+    return order;
+}
+
 template<typename T>
 void MixingModel<T>::limitMinimalTimeStep(T minMinimalTimeStep, T maxMinimalTimeStep) {
     this->minimalTimeStep = std::clamp(this->minimalTimeStep, minMinimalTimeStep, maxMinimalTimeStep);
@@ -96,6 +144,49 @@ void InstantaneousMixingModel<T>::propagateSpecies(arch::Network<T>* network, Hy
     std::vector<Mixture<T>> tmpMixtures;
 
     // Define total inflow volume at nodes
+    updateTotalInflowVolume(network);
+
+    // Initial node outflow from mixtureInjections and CFD simulators, stored in mixtureOutflowAtNode
+    initNodeOutflow(sim, tmpMixtures);
+
+    // Propagate the mixtures through the network in a single pass
+    propagateSteadyState(network, tmpMixtureLookup(tmpMixtures), tmpMixtureFactory(sim, tmpMixtures));
+
+    // Store the concentrations of the final state in the concentration buffer of olbMixingSolver.
+    storeConcentrations(sim, tmpMixtures);
+
+    clean(network);
+
+}
+
+template<typename T>
+void InstantaneousMixingModel<T>::propagateSpecies(arch::Network<T>* network, AbstractConcentration<T>* sim) {
+
+    // Define total inflow volume at nodes
+    updateTotalInflowVolume(network);
+
+    // Mixture injections fill their injection channel, regardless of the injection time
+    for (auto& [key, mixtureInjection] : sim->getMixtureInjections()) {
+        injectedChannels.insert_or_assign(mixtureInjection->getInjectionChannel()->getId(), mixtureInjection->getMixtureId());
+    }
+    for (auto& [key, mixtureInjection] : sim->getPermanentMixtureInjections()) {
+        injectedChannels.insert_or_assign(mixtureInjection->getInjectionChannel()->getId(), mixtureInjection->getMixtureId());
+    }
+
+    // Propagate the mixtures through the network in a single pass, new mixtures are added to the simulation
+    MixtureLookup lookup = [sim](size_t mixtureId) -> const std::unordered_map<size_t, T>& {
+        return sim->getMixtures().at(mixtureId)->getSpecieConcentrations();
+    };
+    MixtureFactory factory = [sim](const std::unordered_map<size_t, T>& concentrations) {
+        return sim->createMixture(concentrations)->getId();
+    };
+    propagateSteadyState(network, lookup, factory);
+
+    clean(network);
+}
+
+template<typename T>
+void InstantaneousMixingModel<T>::updateTotalInflowVolume(arch::Network<T>* network) {
     for (auto& [nodeId, node] : network->getNodes()) {
         for (auto& channel : network->getChannelsAtNode(nodeId) ) {
             // Check if the channel flows into the node
@@ -108,26 +199,67 @@ void InstantaneousMixingModel<T>::propagateSpecies(arch::Network<T>* network, Hy
             }
         }
     }
+}
 
-    // Initial node outflow from mixtureInjections and CFD simulators, stored in mixtureOutflowAtNode
-    initNodeOutflow(sim, tmpMixtures);
-
-    // Propagate the mixtures through the entire channel, without considering time steps
-    channelPropagation(network);
+template<typename T>
+void InstantaneousMixingModel<T>::propagateSteadyState(arch::Network<T>* network, const MixtureLookup& lookup, const MixtureFactory& factory) {
+    // Injected mixtures fill their channel and flow into the node at its end
+    for (auto& [channelId, mixtureId] : injectedChannels) {
+        auto channel = network->getChannel(channelId);
+        if (channel->getFlowRate() == 0.0) {
+            continue;
+        }
+        size_t nodeId = (channel->getFlowRate() > 0.0) ? channel->getNodeBId() : channel->getNodeAId();
+        mixtureInflowAtNode[nodeId].push_back({mixtureId, std::abs(channel->getFlowRate())});
+        this->filledEdges.insert_or_assign(channelId, mixtureId);
+    }
 
-    bool inflowUpdated = true;
-    while (inflowUpdated) {
+    // Visit the nodes in topological order of the flow field, so that all inflows of a node
+    // are known before its outflow is generated and propagated downstream.
+    std::vector<size_t> cyclicNodes;
+    for (size_t nodeId : this->topologicalNodeOrder(network, cyclicNodes)) {
         // From node inflow, generate the node's outflow
-        inflowUpdated = updateNodeOutflow(sim, tmpMixtures);
-        // Propagate the mixtures through the entire channel
-        channelPropagation(network);
+        if (mixtureInflowAtNode.count(nodeId)) {
+            updateNodeOutflow(nodeId, lookup, factory);
+        }
+        // Propagate the mixtures through the entire channel, without considering time steps
+        if (mixtureOutflowAtNode.count(nodeId)) {
+            channelPropagation(nodeId, network);
+        }
     }
 
-    // Store the concentrations of the final state in the concentration buffer of olbMixingSolver.
-    storeConcentrations(sim, tmpMixtures);
+    // Nodes that were not reached lie on, or downstream of, a recirculation in the flow field
+    if (!cyclicNodes.empty()) {
+        solveCyclicMixing(cyclicNodes, network, lookup, factory);
+    }
+}
 
-    clean(network);
+template<typename T>
+typename InstantaneousMixingModel<T>::MixtureLookup InstantaneousMixingModel<T>::tmpMixtureLookup(const std::vector<Mixture<T>>& tmpMixtures) {
+    return [&tmpMixtures](size_t mixtureId) -> const std::unordered_map<size_t, T>& {
+        // Find the mixture with mixtureId in tmpMixtures
+        auto mixtureIt = std::find_if(tmpMixtures.begin(), tmpMixtures.end(), [&](const Mixture<T>& m) {
+            return m.getId() == mixtureId;
+        });
+        if (mixtureIt == tmpMixtures.end()) {
+            throw std::runtime_error("Error: Mixture with ID " + std::to_string(mixtureId) + " not found in temporary mixtures.");
+        }
+        return mixtureIt->getSpecieConcentrations();
+    };
+}
 
+template<typename T>
+typename InstantaneousMixingModel<T>::MixtureFactory InstantaneousMixingModel<T>::tmpMixtureFactory(HybridConcentration<T>* sim, std::vector<Mixture<T>>& tmpMixtures) {
+    return [sim, &tmpMixtures](const std::unordered_map<size_t, T>& concentrations) {
+        std::unordered_map<size_t, std::shared_ptr<Specie<T>>> speciePtrs;
+        for (auto& [specieId, concentration] : concentrations) {
+            speciePtrs.try_emplace(specieId, sim->getSpecie(specieId));
+        }
+        // Constructor for placeholder object. Does not increase mixtureCount.
+        size_t mixtureId = tmpMixtures.size();
+        tmpMixtures.push_back(Mixture<T>(mixtureId, speciePtrs, concentrations, sim->getContinuousPhase().get()));
+        return mixtureId;
+    };
 }
 
 template<typename T>
@@ -170,27 +302,37 @@ void InstantaneousMixingModel<T>::initNodeOutflow(HybridConcentration<T>* sim, s
 template<typename T>
 void InstantaneousMixingModel<T>::channelPropagation(arch::Network<T>* network) {
     for (auto& [nodeId, mixtureId] : mixtureOutflowAtNode) {
-        for (auto& channel : network->getChannelsAtNode(nodeId)) {
-            // Find the nodeId that is across the channel
-            size_t oppositeNode;
-            if (channel->getFlowRate() > 0.0 && channel->getNodeAId() == nodeId) {
-                oppositeNode = channel->getNodeBId();
-            } else if (channel->getFlowRate() < 0.0 && channel->getNodeBId() == nodeId) {
-                oppositeNode = channel->getNodeAId();
-            } else {
-                continue;
-            }
-            // Update the mixture inflow at the node across the channel
-            MixtureInFlow<T> mixtureInflow = {mixtureId, std::abs(channel->getFlowRate())};
-            auto [iterator, inserted] = mixtureInflowAtNode.try_emplace(oppositeNode, std::vector<MixtureInFlow<T>>(1, mixtureInflow));
-            if (!inserted) {
-                mixtureInflowAtNode.at(oppositeNode).push_back(mixtureInflow);
-            }
-            // Add or update filledEdges
-            auto [iteratorEdge, insertedEdge] = this->filledEdges.try_emplace(channel->getId(), mixtureId);
-            if (!insertedEdge) {
-                iteratorEdge->second = mixtureId;
-            }
+        channelPropagation(nodeId, network);
+    }
+}
+
+template<typename T>
+void InstantaneousMixingModel<T>::channelPropagation(size_t nodeId, arch::Network<T>* network) {
+    size_t mixtureId = mixtureOutflowAtNode.at(nodeId);
+    for (auto& channel : network->getChannelsAtNode(nodeId)) {
+        // Injection channels already carry their injected mixture
+        if (injectedChannels.count(channel->getId())) {
+            continue;
+        }
+        // Find the nodeId that is across the channel
+        size_t oppositeNode;
+        if (channel->getFlowRate() > 0.0 && channel->getNodeAId() == nodeId) {
+            oppositeNode = channel->getNodeBId();
+        } else if (channel->getFlowRate() < 0.0 && channel->getNodeBId() == nodeId) {
+            oppositeNode = channel->getNodeAId();
+        } else {
+            continue;
+        }
+        // Update the mixture inflow at the node across the channel
+        MixtureInFlow<T> mixtureInflow = {mixtureId, std::abs(channel->getFlowRate())};
+        auto [iterator, inserted] = mixtureInflowAtNode.try_emplace(oppositeNode, std::vector<MixtureInFlow<T>>(1, mixtureInflow));
+        if (!inserted) {
+            mixtureInflowAtNode.at(oppositeNode).push_back(mixtureInflow);
+        }
+        // Add or update filledEdges
+        auto [iteratorEdge, insertedEdge] = this->filledEdges.try_emplace(channel->getId(), mixtureId);
+        if (!insertedEdge) {
+            iteratorEdge->second = mixtureId;
         }
     }
 }
@@ -198,80 +340,145 @@ void InstantaneousMixingModel<T>::channelPropagation(arch::Network<T>* network)
 template<typename T>
 bool InstantaneousMixingModel<T>::updateNodeOutflow(HybridConcentration<T>* sim, std::vector<Mixture<T>>& tmpMixtures) {
     bool updated = false;
+    MixtureLookup lookup = tmpMixtureLookup(tmpMixtures);
+    MixtureFactory factory = tmpMixtureFactory(sim, tmpMixtures);
     // Construct the node outflow based on the node inflow, for each node
     for (auto& [nodeId, mixtureInflowList] : mixtureInflowAtNode) {
-        bool createMixture = false;
-        std::unordered_map<size_t, std::shared_ptr<Specie<T>>> speciePtrs;
-        std::unordered_map<size_t, T> newConcentrations;
-        // Store all the incoming species and their new concentrations, where relevant
-        // into speciePrs and newConcentrations
-        for (auto& mixtureInflow : mixtureInflowList) {
-            // Find the mixture with mixtureId in tmpMixtures
-            auto mixtureIt = std::find_if(tmpMixtures.begin(), tmpMixtures.end(), [&](const Mixture<T>& m) {
-                return m.getId() == mixtureInflow.mixtureId;
-            });
-            if (mixtureIt == tmpMixtures.end()) {
-                throw std::runtime_error("Error: Mixture with ID " + std::to_string(mixtureInflow.mixtureId) + " not found in temporary mixtures.");
-            }
-            // For each inflow mixture store the species and their new corresponding concentrations
-            for (auto& [specieId, oldConcentration] : mixtureIt->getSpecieConcentrations()) {
-                speciePtrs.try_emplace(specieId, sim->getSpecie(specieId));
-                T newConcentration = oldConcentration * mixtureInflow.inflowVolume / totalInflowVolumeAtNode.at(nodeId);
-                auto [iterator, inserted] = newConcentrations.try_emplace(specieId, newConcentration);
-                if (!inserted) {
-                    iterator->second = iterator->second + newConcentration;
-                }
-            }
-            // Check if a new mixture needs to be created, i.e., if the mixture ID is not the first and only inflow mixture
-            if (mixtureInflow.mixtureId != mixtureInflowList[0].mixtureId) {
-                createMixture = true;
+        if (updateNodeOutflow(nodeId, lookup, factory)) {
+            updated = true;
+        }
+    }
+    return updated;
+}
+
+template<typename T>
+bool InstantaneousMixingModel<T>::updateNodeOutflow(size_t nodeId, const MixtureLookup& lookup, const MixtureFactory& factory) {
+    const std::vector<MixtureInFlow<T>>& mixtureInflowList = mixtureInflowAtNode.at(nodeId);
+    bool createMixture = false;
+    T mixtureInflowVolume = 0.0;
+    std::unordered_map<size_t, T> newConcentrations;
+    // Store all the incoming species and their new concentrations, where relevant into newConcentrations
+    for (auto& mixtureInflow : mixtureInflowList) {
+        // For each inflow mixture store the species and their new corresponding concentrations
+        for (auto& [specieId, oldConcentration] : lookup(mixtureInflow.mixtureId)) {
+            T newConcentration = oldConcentration * mixtureInflow.inflowVolume / totalInflowVolumeAtNode.at(nodeId);
+            auto [iterator, inserted] = newConcentrations.try_emplace(specieId, newConcentration);
+            if (!inserted) {
+                iterator->second = iterator->second + newConcentration;
             }
         }
-        // The id for the outflow mixture
-        size_t outflowMixtureId;
-        // Constructor for placeholder dummy object. Does not increase mixtureCount.
-        Mixture<T> newMixture (tmpMixtures.size(), speciePtrs, newConcentrations, sim->getContinuousPhase().get());
-        if (createMixture) {
-            // Multiple inflow mixtures result in a new outflow mixture
-            outflowMixtureId = tmpMixtures.size();
-        } else {
-            // Single inflow mixture results in the same outflow mixture
-            outflowMixtureId = mixtureInflowList[0].mixtureId;
+        // Check if a new mixture needs to be created, i.e., if the mixture ID is not the first and only inflow mixture
+        if (mixtureInflow.mixtureId != mixtureInflowList[0].mixtureId) {
+            createMixture = true;
+        }
+        mixtureInflowVolume += mixtureInflow.inflowVolume;
+    }
+    // Inflow of pure continuous phase dilutes the mixture, which then also results in a new mixture
+    if (mixtureInflowVolume < (1.0 - 1e-12) * totalInflowVolumeAtNode.at(nodeId)) {
+        createMixture = true;
+    }
+
+    if (!createMixture) {
+        // Single inflow mixture results in the same outflow mixture
+        size_t outflowMixtureId = mixtureInflowList[0].mixtureId;
+        auto [iterator, inserted] = mixtureOutflowAtNode.try_emplace(nodeId, outflowMixtureId);
+        if (!inserted && iterator->second == outflowMixtureId) {
+            // It's the same mixture
+            return false;
         }
-        if (!mixtureOutflowAtNode.count(nodeId)) {
-            // If no outflow mixture exists for the node, add the new mixture as node outflow
-            if (createMixture) {
-                tmpMixtures.push_back(newMixture);
+        iterator->second = outflowMixtureId;
+        return true;
+    }
+    // Multiple inflow mixtures result in a new outflow mixture
+    mixtureOutflowAtNode.insert_or_assign(nodeId, factory(newConcentrations));
+    return true;
+}
+
+template<typename T>
+void InstantaneousMixingModel<T>::solveCyclicMixing(const std::vector<size_t>& nodes, arch::Network<T>* network, const MixtureLookup& lookup, const MixtureFactory& factory) {
+    // Each unknown node gets a dense row of the balance
+    arch::DenseIndex unknownIndex(nodes);
+
+    // Assemble the mixing balance c_n * Q_n - sum(Q_in * c_in) = 0 for each node n. Inflows from nodes with
+    // a known outflow mixture, and from injection channels, go into the right-hand side. Nodes that are seeded
+    // with an injection or a CFD outflow keep their mixture.
+    std::vector<Eigen::Triplet<T>> triplets;
+    std::vector<std::unordered_map<size_t, T>> rhsEntries(nodes.size());
+    std::map<size_t, int> specieIndex;
+    auto addRhs = [&](int row, size_t mixtureId, T factor) {
+        for (auto& [specieId, concentration] : lookup(mixtureId)) {
+            specieIndex.try_emplace(specieId, 0);
+            rhsEntries[row][specieId] += factor * concentration;
+        }
+    };
+    for (int row = 0; row < static_cast<int>(unknownIndex.size()); ++row) {
+        size_t nodeId = unknownIndex.id(row);
+        if (mixtureOutflowAtNode.count(nodeId)) {
+            triplets.emplace_back(row, row, 1.0);
+            addRhs(row, mixtureOutflowAtNode.at(nodeId), 1.0);
+            continue;
+        }
+        triplets.emplace_back(row, row, totalInflowVolumeAtNode.at(nodeId));
+        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+            size_t oppositeNode;
+            if (channel->getFlowRate() > 0.0 && channel->getNodeBId() == nodeId) {
+                oppositeNode = channel->getNodeAId();
+            } else if (channel->getFlowRate() < 0.0 && channel->getNodeAId() == nodeId) {
+                oppositeNode = channel->getNodeBId();
+            } else {
+                continue;
             }
-            auto result = mixtureOutflowAtNode.try_emplace(nodeId, outflowMixtureId);
-            if (!result.second) {
-                throw std::runtime_error("Error: Outflow mixture for node " + std::to_string(nodeId) + " already exists.");
+            T inflowVolume = std::abs(channel->getFlowRate());
+            if (injectedChannels.count(channel->getId())) {
+                addRhs(row, injectedChannels.at(channel->getId()), inflowVolume);
+            } else if (unknownIndex.contains(oppositeNode)) {
+                triplets.emplace_back(row, static_cast<int>(unknownIndex.index(oppositeNode)), -inflowVolume);
+            } else if (mixtureOutflowAtNode.count(oppositeNode)) {
+                addRhs(row, mixtureOutflowAtNode.at(oppositeNode), inflowVolume);
             }
-            updated = true;
+        }
+    }
+    int col = 0;
+    for (auto& [specieId, index] : specieIndex) {
+        index = col++;
+    }
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> rhs = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>::Zero(nodes.size(), specieIndex.size());
+    for (size_t row = 0; row < nodes.size(); ++row) {
+        for (auto& [specieId, value] : rhsEntries[row]) {
+            rhs(row, specieIndex.at(specieId)) = value;
+        }
+    }
 
-        } else {
-            auto mixtureIt1 = std::find_if(tmpMixtures.begin(), tmpMixtures.end(), [&](const Mixture<T>& m) {
-                return m.getId() == outflowMixtureId;
-            });
-            auto mixtureIt2 = std::find_if(tmpMixtures.begin(), tmpMixtures.end(), [&](const Mixture<T>& m) {
-                return m.getId() == mixtureOutflowAtNode.at(nodeId);
-            });
-            // There already was an outflow mixture for this node
-            // Check if the outflow gets updated or not
-            if (mixtureIt1 == mixtureIt2) {
-                // It's the same mixture -> continues
-                continue;
-            } else {
-                // It's not the same mixture, set the new mixture as node outflow
-                if (createMixture) {
-                    tmpMixtures.push_back(newMixture);
-                }
-                mixtureOutflowAtNode.at(nodeId) = outflowMixtureId;
-                updated = true;
+    Eigen::SparseMatrix<T> A(nodes.size(), nodes.size());
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::SparseLU<Eigen::SparseMatrix<T>, Eigen::COLAMDOrdering<int>> solver;
+    solver.compute(A);
+    if (solver.info() != Eigen::Success) {
+        throw std::runtime_error("The mixing balance of the recirculating flow field could not be solved. Check for closed flow loops without inflow.");
+    }
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> concentrations = solver.solve(rhs);
+
+    // Each solved node gets its own outflow mixture
+    for (int row = 0; row < static_cast<int>(unknownIndex.size()); ++row) {
+        size_t nodeId = unknownIndex.id(row);
+        if (mixtureOutflowAtNode.count(nodeId)) {
+            continue;
+        }
+        std::unordered_map<size_t, T> newConcentrations;
+        for (auto& [specieId, index] : specieIndex) {
+            if (concentrations(row, index) > 0.0) {
+                newConcentrations.try_emplace(specieId, concentrations(row, index));
             }
         }
+        if (!newConcentrations.empty()) {
+            mixtureOutflowAtNode.try_emplace(nodeId, factory(newConcentrations));
+        }
+    }
+    for (size_t nodeId : nodes) {
+        if (mixtureOutflowAtNode.count(nodeId)) {
+            channelPropagation(nodeId, network);
+        }
     }
-    return updated;
 }
 
 template<typename T>
@@ -294,6 +501,7 @@ void InstantaneousMixingModel<T>::storeConcentrations(HybridConcentration<T>* si
 
 template<typename T>
 void InstantaneousMixingModel<T>::updateMixtures(T timeStep, arch::Network<T>* network, AbstractConcentration<T>* sim, std::unordered_map<size_t, std::shared_ptr<Mixture<T>>>& mixtures) {
+    result::ScopedTimer timer(result::Phase::UpdateMixtures);
     generateNodeOutflow(sim, mixtures);
     updateChannelInflow(timeStep, sim, network, mixtures);
 
@@ -515,6 +723,7 @@ void InstantaneousMixingModel<T>::updateChannelInflow(T timeStep, AbstractConcen
 
 template<typename T>
 void InstantaneousMixingModel<T>::calculateMembraneExchange(T timeStep, AbstractMembrane<T>* sim, arch::Network<T>* network, const std::unordered_map<size_t, std::shared_ptr<Mixture<T>>>& mixtures) {
+    result::ScopedTimer timer(result::Phase::MembraneExchange);
     for (auto& [nodeId, node] : network->getNodes()) {
         for (auto membrane : network->getMembranesAtNode(nodeId)) {
             auto tank = membrane->getTank();
@@ -633,6 +842,7 @@ void InstantaneousMixingModel<T>::clean(arch::Network<T>* network) {
     mixtureInflowAtNode.clear();
     mixtureOutflowAtNode.clear();
     totalInflowVolumeAtNode.clear();
+    injectedChannels.clear();
 }
 
 template<typename T>
@@ -654,6 +864,7 @@ DiffusionMixingModel<T>::DiffusionMixingModel() : MixingModel<T>() { }
 
 template<typename T>
 void DiffusionMixingModel<T>::updateMixtures(T timeStep, arch::Network<T>* network, AbstractConcentration<T>* sim, std::unordered_map<size_t, std::shared_ptr<Mixture<T>>>& mixtures) {
+    result::ScopedTimer timer(result::Phase::UpdateMixtures);
     updateNodeInflow(timeStep, network);
     generateInflows(timeStep, network, sim, mixtures);
     clean(network);
@@ -971,6 +1182,52 @@ void DiffusionMixingModel<T>::propagateSpecies(arch::Network<T>* network, Hybrid
     clean(network);
 }
 
+template<typename T>
+void DiffusionMixingModel<T>::propagateSpecies(arch::Network<T>* network, AbstractConcentration<T>* sim) {
+
+    // Remove the mixtures of a previous propagation, which all fill their channel
+    clean(network);
+    updatedChannels.clear();
+    cfdMixtureNodes.clear();
+
+    // Mixture injections fill their injection channel, regardless of the injection time
+    for (auto& [key, mixtureInjection] : sim->getMixtureInjections()) {
+        this->injectMixtureInEdge(mixtureInjection->getMixtureId(), mixtureInjection->getInjectionChannel()->getId(), 0.0);
+    }
+    for (auto& [key, permanentMixtureInjection] : sim->getPermanentMixtureInjections()) {
+        this->injectMixtureInEdge(permanentMixtureInjection->getMixtureId(), permanentMixtureInjection->getInjectionChannel()->getId(), 0.0);
+    }
+
+    // The analytical solution is only available for mixtures that flow downstream
+    std::vector<size_t> cyclicNodes;
+    std::vector<size_t> order = this->topologicalNodeOrder(network, cyclicNodes);
+    if (!cyclicNodes.empty()) {
+        throw std::runtime_error("The steady-state diffusive mixing model does not support recirculating flow fields.");
+    }
+
+    // Visit the nodes in topological order, so that all inflows of a node are known before its outflow is generated
+    for (size_t nodeId : order) {
+        mixingNodes.clear();
+        for (auto& channel : network->getChannelsAtNode(nodeId)) {
+            // If the channel flows into this node
+            if ((channel->getFlowRate() > 0.0 && channel->getNodeBId() == nodeId) || (channel->getFlowRate() < 0.0 && channel->getNodeAId() == nodeId)) {
+                if (this->mixturesInEdge.count(channel->getId())) {
+                    // The mixtures fill the entire channel
+                    for (auto& [mixtureId, endPos] : this->mixturesInEdge.at(channel->getId())) {
+                        endPos = 1.0;
+                        this->filledEdges.insert_or_assign(channel->getId(), mixtureId);
+                    }
+                    mixingNodes.emplace(nodeId);
+                }
+            }
+        }
+        if (!mixingNodes.empty()) {
+            generateInflows(network, sim);
+        }
+    }
+    mixingNodes.clear();
+}
+
 template<typename T>
 void DiffusionMixingModel<T>::introduceMixtures(HybridConcentration<T>* sim, arch::Network<T>* network) {
     // Add mixture injections
@@ -1043,7 +1300,7 @@ void DiffusionMixingModel<T>::updateNodeInflow(arch::Network<T>* network) {
 }
 
 template<typename T>
-void DiffusionMixingModel<T>::generateInflows(arch::Network<T>* network, HybridConcentration<T>* sim) {
+void DiffusionMixingModel<T>::generateInflows(arch::Network<T>* network, ConcentrationSemantics<T>* sim) {
     auto mixtures = sim->getMixtures();
     // Due to the nature of the diffusive mixing model, per definition a new mixture is created.
     // It is unlikely that this exact mixture, with same species and functions already exists
@@ -1353,12 +1610,9 @@ void DiffusionMixingModel<T>::clean(arch::Network<T>* network) {
     for (auto& [nodeId, node] : network->getNodes()) {
         for (auto& channel : network->getChannelsAtNode(nodeId)) {
             if (this->mixturesInEdge.count(channel->getId())){
-                for (auto& [mixtureId, endPos] : this->mixturesInEdge.at(channel->getId())) {
-                    if (endPos == 1.0) {
-                        this->mixturesInEdge.at(channel->getId()).pop_front();
-                    } else {
-                        break;
-                    }
+                auto& mixtures = this->mixturesInEdge.at(channel->getId());
+                while (!mixtures.empty() && mixtures.front().second == 1.0) {
+                    mixtures.pop_front();
                 }
             }
         }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -40,7 +41,7 @@ class Droplet;
 template<typename T>
 class DropletInjection final {
   private:
-    inline static size_t injectionCounter = 0;        ///< Global counter for amount of created dropletInjection objects.
+    inline static std::atomic<size_t> injectionCounter { 0 };        ///< Global counter for amount of created dropletInjection objects.
     const size_t id;                                  ///< Unique identifier of an injection.
     DropletImplementation<T>* const droplet;          ///< Pointer to droplet to be injected.
     std::string name = "";                            ///< Name of the injection.
@@ -80,6 +81,12 @@ class DropletInjection final {
 
   public:
 
+    /**
+     * @brief Retrieve unique identifier of the droplet that should be injected.
+     * @return Unique identifier of the droplet.
+     */
+    [[nodiscard]] inline size_t getDropletId() const { return droplet->getId(); }
+
     /**
      * @brief Retrieve unique identifier of injection.
      * @return Unique identifier of injection.
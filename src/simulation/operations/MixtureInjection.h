@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -53,7 +54,7 @@ class PermanentMixtureInjectionEvent;
 template<typename T>
 class MixtureInjection final {
   private:
-    inline static size_t injectionCounter = 0;                ///< Global counter for amount of created mixtureInjection objects.
+    inline static std::atomic<size_t> injectionCounter { 0 };                ///< Global counter for amount of created mixtureInjection objects.
     const size_t simHash;                                     ///< Hash of the simulation that created this mixture injection object.
     const size_t id;                                          ///< Unique identifier of an injection.
     Mixture<T>* const mixture;                                ///< Pointer to mixture to be injected.
@@ -54,6 +54,26 @@ class Specie;
 template<typename T>
 class AbstractConcentration : public Simulation<T>, public ConcentrationSemantics<T> {
 
+private:
+
+    bool steadyState = false;       ///< Whether only the steady-state concentrations are computed, skipping the transient.
+    T timestep = 0.0;               ///< Time step of the last iteration in s.
+    size_t sample = 0;              ///< Index of the next sample, if the states are sampled.
+    bool sampleDue = true;          ///< Whether the current time is a sample time.
+    bool mixturesUpdated = false;   ///< Whether the mixtures of the last time step were already updated when the simulation was resumed.
+    std::unordered_map<size_t, T> solvedPumpValues;     ///< Pressures of the pressure pumps and flow rates of the flow rate pumps at the last nodal analysis.
+
+    /**
+     * @brief Store the pressures of the pressure pumps and the flow rates of the flow rate pumps, for which the network was solved.
+     */
+    void storePumpValues();
+
+    /**
+     * @brief Whether pumps were added, removed or changed since the network was last solved.
+     * @returns Whether the network must be solved again.
+     */
+    [[nodiscard]] bool pumpsModified() const;
+
 protected:
 
     void assertInitialized() const override;
@@ -84,6 +104,18 @@ protected:
      */
     void calculateNewMixtures(double timeStep);
 
+    void startSimulation() override;
+
+    /**
+     * @brief Solves the network again if the pumps changed since the last step. The mixtures of the last time step
+     * are updated with the previous flow rates before.
+     */
+    void resumeSimulation() override;
+
+    bool iterate(T endTime) override;
+
+    void finishSimulation() override;
+
 public:
 
     /**
@@ -96,6 +128,7 @@ public:
 
     /**
      * @brief Abstract mixing simulation for flow with species concentrations.
+     * In steady-state mode, the node-mixing balance is computed directly from the flow rates.
      * Simulation loop:
      * - Update pressure and flowrates
      * - Calculate next mixture event
@@ -105,6 +138,20 @@ public:
      */
     void simulate() override;
 
+    /**
+     * @brief Set whether the simulation computes the steady-state concentrations directly from the flow rates of
+     * the nodal analysis, instead of propagating the mixtures event by event. A steady-state simulation stores a
+     * single result state, in which all mixture injections have filled their injection channel.
+     * @param[in] steadyState Whether only the steady state is computed.
+     */
+    void setSteadyState(bool steadyState);
+
+    /**
+     * @brief Returns whether the simulation only computes the steady state.
+     * @returns Whether only the steady state is computed.
+     */
+    [[nodiscard]] bool isSteadyState() const;
+
 };
 
 }   // namespace sim
@@ -52,98 +52,214 @@ void AbstractConcentration<T>::calculateNewMixtures(double timestep_) {
 
 template<typename T>
 void AbstractConcentration<T>::simulate() {
+    result::ProfileScope profileScope(this->startProfile());
+    startSimulation();
+    while (iterate(std::numeric_limits<T>::infinity())) { }
+    finishSimulation();
+}
+
+template<typename T>
+void AbstractConcentration<T>::startSimulation() {
     Simulation<T>::simulate();
     this->assertInitialized();      // perform initialization checks
     this->initialize();             // initialize the simulation
     this->conductNodalAnalysis();   // compute nodal analysis
+    storePumpValues();
+    timestep = 0.0;
+    sample = 0;
+    sampleDue = true;
+    mixturesUpdated = false;
+}
 
-    T timestep = 0.0;
-    while(true) {
-        if (this->getIterations() >= this->getMaxIterations()) {
-            throw std::runtime_error("Max iterations exceeded.");
+template<typename T>
+void AbstractConcentration<T>::resumeSimulation() {
+    if (steadyState || !pumpsModified()) {
+        return;
+    }
+    // the mixtures of the last time step still flow with the previous flow rates
+    if (this->hasInstantaneousMixingModel() && !mixturesUpdated) {
+        calculateNewMixtures(timestep);
+        mixturesUpdated = true;
+    }
+    this->conductNodalAnalysis();
+    storePumpValues();
+}
+
+template<typename T>
+void AbstractConcentration<T>::storePumpValues() {
+    solvedPumpValues.clear();
+    for (auto& [pumpId, pump] : this->getNetwork()->getPressurePumps()) {
+        solvedPumpValues.try_emplace(pumpId, pump->getPressure());
+    }
+    for (auto& [pumpId, pump] : this->getNetwork()->getFlowRatePumps()) {
+        solvedPumpValues.try_emplace(pumpId, pump->getFlowRate());
+    }
+}
+
+template<typename T>
+bool AbstractConcentration<T>::pumpsModified() const {
+    const auto& pressurePumps = this->getNetwork()->getPressurePumps();
+    const auto& flowRatePumps = this->getNetwork()->getFlowRatePumps();
+    if (pressurePumps.size() + flowRatePumps.size() != solvedPumpValues.size()) {
+        return true;
+    }
+    auto modified = [&](size_t pumpId, T value) {
+        auto solved = solvedPumpValues.find(pumpId);
+        return solved == solvedPumpValues.end() || solved->second != value;
+    };
+    for (auto& [pumpId, pump] : pressurePumps) {
+        if (modified(pumpId, pump->getPressure())) {
+            return true;
+        }
+    }
+    for (auto& [pumpId, pump] : flowRatePumps) {
+        if (modified(pumpId, pump->getFlowRate())) {
+            return true;
         }
+    }
+    return false;
+}
+
+template<typename T>
+bool AbstractConcentration<T>::iterate(T endTime) {
+    if (steadyState) {
+        // Compute the node-mixing balance directly from the flow rates, skipping the transient
+        this->getMixingModel()->propagateSpecies(this->getNetwork().get(), this);
+        saveState();
+        return false;
+    }
+
+    if (this->getIterations() >= this->getMaxIterations()) {
+        throw std::runtime_error("Max iterations exceeded.");
+    }
 
-        // Update and propagate the mixtures 
-        if (this->hasInstantaneousMixingModel()) {
+    // Update and propagate the mixtures 
+    if (this->hasInstantaneousMixingModel()) {
+        if (!mixturesUpdated) {
             calculateNewMixtures(timestep);
-            this->getMixingModel()->updateMinimalTimeStep(this->getNetwork().get());
-        } else if (this->hasDiffusiveMixingModel()) {
-            this->getMixingModel()->updateMinimalTimeStep(this->getNetwork().get());
         }
-        
-        // store simulation results of current state
+        mixturesUpdated = false;
+        this->getMixingModel()->updateMinimalTimeStep(this->getNetwork().get());
+    } else if (this->hasDiffusiveMixingModel()) {
+        this->getMixingModel()->updateMinimalTimeStep(this->getNetwork().get());
+    }
+    
+    // store simulation results of current state
+    bool saved = false;
+    if (!this->isSampling() || sampleDue) {
         saveState();
-        
-        // compute events
-        auto events = computeMixingEvents();
-        
-        // sort events
-        // closest events in time with the highest priority come first
-        std::sort(events.begin(), events.end(), [](auto& a, auto& b) {
-            if (a->getTime() == b->getTime()) {
-                return a->getPriority() < b->getPriority();  // ascending order (the lower the priority value, the higher the priority)
-            }
-            return a->getTime() < b->getTime();  // ascending order
-        });
+        saved = true;
+        sampleDue = false;
+        sample++;
+    }
+    
+    // compute events
+    auto events = computeMixingEvents();
+    
+    // sort events
+    // closest events in time with the highest priority come first
+    std::sort(events.begin(), events.end(), [](auto& a, auto& b) {
+        if (a->getTime() == b->getTime()) {
+            return a->getPriority() < b->getPriority();  // ascending order (the lower the priority value, the higher the priority)
+        }
+        return a->getTime() < b->getTime();  // ascending order
+    });
 
-        #ifdef DEBUG  
-        for (auto& event : events) {
-            event->print();
+    #ifdef DEBUG  
+    for (auto& event : events) {
+        event->print();
+    }
+    #endif
+
+    // the next event lies beyond the end time of the step, hence, the simulation is only stepped to the end time
+    bool reachesEnd = false;
+    if (!events.empty() && events[0]->getTime() > endTime - this->getTime()) {
+        events.insert(events.begin(), std::make_unique<TimeStepEvent<T>>(endTime - this->getTime()));
+        reachesEnd = true;
+    }
+    
+    // the mixtures are not moved linearly, hence, the simulation is stepped to the next sample time
+    // a sample at the exact time of an event is taken after the event was performed
+    if (this->isSampling() && !events.empty()) {
+        T sampleTime = sample * this->getWriteInterval();
+        if (sampleTime > this->getTMax()) {
+            return false;
         }
-        #endif
-        
-        Event<T>* nextEvent = nullptr;
-        if (events.size() != 0) {
-            nextEvent = events[0].get();
-        } else {
-            break;
+        if (events[0]->getTime() >= sampleTime - this->getTime()) {
+            if (events[0]->getTime() > sampleTime - this->getTime()) {
+                events.insert(events.begin(), std::make_unique<TimeStepEvent<T>>(sampleTime - this->getTime()));
+                reachesEnd = false;
+            }
+            sampleDue = true;
         }
+    }
 
-        timestep = nextEvent->getTime();
-        this->getTime() += nextEvent->getTime();
-        
-        // Depending on the mixing model, the process looks different
-        if (this->hasInstantaneousMixingModel()) {
-            // Instantaneous mixing model
-            auto* instantMixingModel = dynamic_cast<InstantaneousMixingModel<T>*>(this->getMixingModel());
-            assert(instantMixingModel);
-            instantMixingModel->moveMixtures(timestep, this->getNetwork().get());
-            instantMixingModel->updateNodeInflow(timestep, this->getNetwork().get());
-        } else if (this->hasDiffusiveMixingModel()) {
-            // Diffusive mixing model
-            this->getMixingModel()->updateMixtures(timestep, this->getNetwork().get(), this, this->getMixtures());
+    Event<T>* nextEvent = nullptr;
+    if (events.size() != 0) {
+        nextEvent = events[0].get();
+    } else {
+        // store the final state, unless it was just sampled
+        if (!saved) {
+            saveState();
         }
-        
+        return false;
+    }
+
+    timestep = nextEvent->getTime();
+    this->getTime() += nextEvent->getTime();
+    if (sampleDue) {
+        // avoid the accumulation of rounding errors in the sample times
+        this->getTime() = sample * this->getWriteInterval();
+    } else if (reachesEnd) {
+        this->getTime() = endTime;
+    }
+    
+    // Depending on the mixing model, the process looks different
+    if (this->hasInstantaneousMixingModel()) {
+        // Instantaneous mixing model
+        auto* instantMixingModel = dynamic_cast<InstantaneousMixingModel<T>*>(this->getMixingModel());
+        assert(instantMixingModel);
+        instantMixingModel->moveMixtures(timestep, this->getNetwork().get());
+        instantMixingModel->updateNodeInflow(timestep, this->getNetwork().get());
+    } else if (this->hasDiffusiveMixingModel()) {
+        // Diffusive mixing model
+        this->getMixingModel()->updateMixtures(timestep, this->getNetwork().get(), this, this->getMixtures());
+    }
+    
+    {
+        result::ScopedTimer timer(result::Phase::PerformEvent);
         nextEvent->performEvent();
-        ++this->getIterations();
     }
+    ++this->getIterations();
+    return true;
+}
 
+template<typename T>
+void AbstractConcentration<T>::finishSimulation() {
     // Store the mixtures that were in the simulation
     saveMixtures();
 }
 
 
+template<typename T>
+void AbstractConcentration<T>::setSteadyState(bool steadyState_) {
+    steadyState = steadyState_;
+}
+
+template<typename T>
+bool AbstractConcentration<T>::isSteadyState() const {
+    return steadyState;
+}
+
 template<typename T>
 void AbstractConcentration<T>::saveState() {
+    result::ScopedTimer timer(result::Phase::SaveState);
     std::unordered_map<int, T> savePressures;
     std::unordered_map<int, T> saveFlowRates;
     std::unordered_map<int, std::deque<MixturePosition<T>>> saveMixturePositions;
 
-    // pressures
-    for (auto& [id, node] : this->getNetwork()->getNodes()) {
-        savePressures.try_emplace(node->getId(), node->getPressure());
-    }
-
-    // flow rates
-    for (auto& [id, channel] : this->getNetwork()->getChannels()) {
-        saveFlowRates.try_emplace(channel->getId(), channel->getFlowRate());
-    }
-    for (auto& [id, pump] : this->getNetwork()->getFlowRatePumps()) {
-        saveFlowRates.try_emplace(pump->getId(), pump->getFlowRate());
-    }
-    for (auto& [id, pump] : this->getNetwork()->getPressurePumps()) {
-        saveFlowRates.try_emplace(pump->getId(), pump->getFlowRate());
-    }
+    // pressures and flow rates, or only those that changed since the previous state
+    bool keyframe = this->collectHydraulicState(savePressures, saveFlowRates);
 
     // Add a mixture position for all filled edges
     for (auto& [channelId, mixingId] : this->getMixingModel()->getFilledEdges()) {
@@ -169,7 +285,7 @@ void AbstractConcentration<T>::saveState() {
     }
 
     // state
-    this->getSimulationResults()->addState(this->getTime(), savePressures, saveFlowRates, saveMixturePositions);
+    this->getSimulationResults()->addState(this->getTime(), savePressures, saveFlowRates, saveMixturePositions, keyframe);
 }
 
 template<typename T>
@@ -7,6 +7,7 @@ namespace sim {
 
     template<typename T>
     void AbstractContinuous<T>::simulate() {
+        result::ProfileScope profileScope(this->startProfile());
         Simulation<T>::simulate();
         this->assertInitialized();      // perform initialization checks
         this->initialize();             // initialize the simulation
@@ -16,6 +17,7 @@ namespace sim {
 
     template<typename T>
     void AbstractContinuous<T>::saveState() {
+        result::ScopedTimer timer(result::Phase::SaveState);
         std::unordered_map<int, T> savePressures;
         std::unordered_map<int, T> saveFlowRates;
 
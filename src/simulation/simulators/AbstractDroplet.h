@@ -7,6 +7,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace arch {
@@ -40,9 +41,24 @@ private:
     std::unordered_map<int, std::shared_ptr<DropletInjection<T>>> dropletInjections;    ///< Injections of droplets that should take place during a droplet simulation.
     std::unordered_map<int, std::set<int>> injectionMap;                                ///< Mapping of injections to droplets stored as <dropletId, <injectionId1, injectionId2, ...>>.
     bool dropletsAtBifurcation = false;                                                 ///< If one or more droplets are currently at a bifurcation. Triggers the usage of the maximal adaptive time step.
+    bool coalescing = false;                                                            ///< If all compatible events that take place at the same time are performed in a single iteration.
+    size_t sample = 0;                                                                  ///< Index of the next sample, if the states are sampled.
+    logging::RateLimiter iterationLog;                                                  ///< Limits the iteration progress messages.
 
     void saveState() override;
 
+    void startSimulation() override;
+
+    bool iterate(T endTime) override;
+
+    /**
+     * @brief Store the state at a time after the current time in simulationResult. Since pressures and flow rates are
+     * constant between two events, the droplet boundaries are moved linearly to the sample time, without changing the
+     * droplets of the simulation.
+     * @param[in] timeOffset Time between the current time and the sample time in s. Must not exceed the time of the next event.
+     */
+    void saveState(T timeOffset);
+
     /**
      * @brief Update the droplet resistances of the channels based on the current positions of the droplets.
      */
@@ -66,6 +82,15 @@ private:
      */
     std::vector<std::unique_ptr<Event<T>>> computeEvents();
 
+    /**
+     * @brief Selects the events that are performed in the next iteration. This is the first event and, if coalescing is
+     * enabled, the directly following events that take place at the same time and have a footprint that is disjoint
+     * from the footprints of all previously selected events.
+     * @param[in] events The events sorted by time and priority. Must not be empty.
+     * @return Pointers to the events that are performed, in the order in which they are performed.
+     */
+    std::vector<Event<T>*> selectEvents(const std::vector<std::unique_ptr<Event<T>>>& events) const;
+
     /**
      * @brief Set the droplets of this simulation to a pre-defined map that is passed.
      * @param[in] droplets an unordered map with unique identifiers and shared_ptr to Droplet<T> objects.
@@ -151,6 +176,12 @@ public:
      */
     [[nodiscard]] inline std::shared_ptr<Droplet<T>> getDroplet(int dropletId) const { return droplets.at(dropletId); }
 
+    /**
+     * @brief Get the droplets of the simulation.
+     * @return Map of the droplet ids and read-only pointers to the droplets.
+     */
+    [[nodiscard]] const std::unordered_map<int, const Droplet<T>*> readDroplets() const;
+
     /**
      * @brief Checks whether a droplet is present at the corresponding node (i.e., the droplet spans over this node).
      * If a droplet is found it returns a tuple of a bool (true) and a pointer to the droplet. Otherwise <0, nullptr>
@@ -204,6 +235,12 @@ public:
      */
     [[nodiscard]] inline std::shared_ptr<DropletInjection<T>> getDropletInjection(int injectionId) const { return dropletInjections.at(injectionId); }
 
+    /**
+     * @brief Get the droplet injections of the simulation.
+     * @return Map of the injection ids and the injections.
+     */
+    [[nodiscard]] inline const std::unordered_map<int, std::shared_ptr<DropletInjection<T>>>& getDropletInjections() const { return dropletInjections; }
+
     /**
      * @brief Removes the droplet injection from the simulation.
      * @param[in] dropletInjection Pointer to the droplet injection that is to be removed.
@@ -219,6 +256,20 @@ public:
     */
     void removeFluid(const std::shared_ptr<Fluid<T>>& fluid) override;
 
+    /**
+     * @brief Enable or disable the coalescing of simultaneous events. When enabled, the next event and all further events
+     * that take place at the same time, in the order of their priority, are performed in a single iteration, as long as
+     * they affect different droplets and nodes (see Event::getFootprint). The network is then solved once for all of
+     * them, instead of once per event.
+     * @param[in] coalescing Whether simultaneous events are coalesced.
+     */
+    inline void setCoalescing(bool coalescing) { this->coalescing = coalescing; }
+
+    /**
+     * @brief Returns whether simultaneous events are coalesced.
+     */
+    [[nodiscard]] inline bool isCoalescing() const { return coalescing; }
+
     /**
      * @brief Abstract droplet simulation for droplets that 'fill' a channel's cross-section. (i.e., no 'free, floating' droplets, but 'squeezed' droplets)
      * Simulation loop:
@@ -228,7 +279,7 @@ public:
      * - compute events
      * - search for next event (break if no event is left)
      * - move droplets
-     * - perform event
+     * - perform event (or all compatible simultaneous events, if coalescing is enabled)
      */
     void simulate() override;
 
@@ -20,6 +20,15 @@ namespace sim {
         return addDroplet(fluid->getId(), volume);
     }
 
+    template<typename T>
+    const std::unordered_map<int, const Droplet<T>*> AbstractDroplet<T>::readDroplets() const {
+        std::unordered_map<int, const Droplet<T>*> dropletPtrs;
+        for (auto& [id, droplet] : droplets) {
+            dropletPtrs.try_emplace(id, droplet.get());
+        }
+        return dropletPtrs;
+    }
+
     template<typename T>
     std::shared_ptr<DropletImplementation<T>> AbstractDroplet<T>::addMergedDropletImplementation(const DropletImplementation<T>& droplet0, const DropletImplementation<T>& droplet1) {
         // compute volumes
@@ -230,6 +239,7 @@ namespace sim {
 
     template<typename T>
     std::vector<std::unique_ptr<Event<T>>> AbstractDroplet<T>::computeEvents() {
+        result::ScopedTimer timer(result::Phase::ComputeEvents);
         // events
         std::vector<std::unique_ptr<Event<T>>> events;
 
@@ -364,102 +374,169 @@ namespace sim {
             events.push_back(std::make_unique<TimeStepEvent<T>>(this->getMaximalAdaptiveTimeStep()));
         }
 
+        result::Profiler::count(result::Counter::ComputedEvents, events.size());
         return events;
     }
 
+    template<typename T>
+    std::vector<Event<T>*> AbstractDroplet<T>::selectEvents(const std::vector<std::unique_ptr<Event<T>>>& events) const {
+        std::vector<Event<T>*> nextEvents { events[0].get() };
+        auto footprint = events[0]->getFootprint();
+        if (!coalescing || !footprint) {
+            return nextEvents;
+        }
+
+        std::unordered_set<size_t> dropletIds { footprint->dropletId };
+        std::unordered_set<size_t> nodeIds(footprint->nodeIds.begin(), footprint->nodeIds.end());
+        for (size_t i = 1; i < events.size() && events[i]->getTime() == events[0]->getTime(); ++i) {
+            // stop at the first event that cannot be performed together with the previous ones, so that the events
+            // are still performed in the order of their priority
+            auto nextFootprint = events[i]->getFootprint();
+            if (!nextFootprint || dropletIds.count(nextFootprint->dropletId) != 0) {
+                break;
+            }
+            bool disjoint = std::none_of(nextFootprint->nodeIds.begin(), nextFootprint->nodeIds.end(), [&nodeIds](size_t nodeId) {
+                return nodeIds.count(nodeId) != 0;
+            });
+            if (!disjoint) {
+                break;
+            }
+            dropletIds.insert(nextFootprint->dropletId);
+            nodeIds.insert(nextFootprint->nodeIds.begin(), nextFootprint->nodeIds.end());
+            nextEvents.push_back(events[i].get());
+        }
+        return nextEvents;
+    }
+
     template<typename T>
     void AbstractDroplet<T>::simulate() {
+        result::ProfileScope profileScope(this->startProfile());
+        startSimulation();
+        while (iterate(std::numeric_limits<T>::infinity())) { }
+    }
+
+    template<typename T>
+    void AbstractDroplet<T>::startSimulation() {
         Simulation<T>::simulate();
         this->assertInitialized();              // perform initialization checks
         this->initialize();                     // initialize the simulation
-        while (true) {
-            if (this->getIterations() >= this->getMaxIterations()) {
-                throw std::runtime_error("Max iterations exceeded.");
-            }
+        iterationLog = logging::RateLimiter();
+        sample = 0;
+    }
 
-            #ifdef VERBOSE     
-                std::cout << "Iteration " << this->getIterations() << std::endl;
-            #endif
-            // update droplet resistances (in the first iteration no  droplets are inside the network)
-            updateDropletResistances();
-            // compute nodal analysis
-            this->conductNodalAnalysis();
-            // update droplets, i.e., their boundary flow rates
-            // loop over all droplets
-            dropletsAtBifurcation = false;
-            for (auto& [key, droplet] : droplets) {
-                // only consider droplets inside the network
-                if (droplet->getDropletState() != DropletState::NETWORK) {
-                    continue;
-                }
+    template<typename T>
+    bool AbstractDroplet<T>::iterate(T endTime) {
+        if (this->getIterations() >= this->getMaxIterations()) {
+            throw std::runtime_error("Max iterations exceeded.");
+        }
 
-                // set to true if droplet is at bifurcation
-                if (droplet->isAtBifurcation()) {
-                    dropletsAtBifurcation = true;
-                }
+        MMFT_LOG_RATE_LIMITED(iterationLog, logging::LogLevel::Debug, "Iteration " << this->getIterations() << " (" << this->getTime() << "s)");
+        // update droplet resistances (in the first iteration no  droplets are inside the network)
+        updateDropletResistances();
+        // compute nodal analysis
+        this->conductNodalAnalysis();
+        // update droplets, i.e., their boundary flow rates
+        // loop over all droplets
+        dropletsAtBifurcation = false;
+        for (auto& [key, droplet] : droplets) {
+            // only consider droplets inside the network
+            if (droplet->getDropletState() != DropletState::NETWORK) {
+                continue;
+            }
 
-                // compute the average flow rates of all boundaries, since the inflow does not necessarily have to match the outflow (qInput != qOutput)
-                // in order to avoid an unwanted increase/decrease of the droplet volume an average flow rate is computed
-                // the actual flow rate of a boundary is then determined accordingly to the ratios of the different flowRates inside the channels
-                droplet->updateBoundaries(*this->getNetwork());
+            // set to true if droplet is at bifurcation
+            if (droplet->isAtBifurcation()) {
+                dropletsAtBifurcation = true;
             }
-            // store simulation results of current state
+
+            // compute the average flow rates of all boundaries, since the inflow does not necessarily have to match the outflow (qInput != qOutput)
+            // in order to avoid an unwanted increase/decrease of the droplet volume an average flow rate is computed
+            // the actual flow rate of a boundary is then determined accordingly to the ratios of the different flowRates inside the channels
+            droplet->updateBoundaries(*this->getNetwork());
+        }
+        // store simulation results of current state
+        if (!this->isSampling()) {
             saveState();
-            // compute events
-            auto events = computeEvents();
-            // sort events
-            // closest events in time with the highest priority come first
-            std::sort(events.begin(), events.end(), [](auto& a, auto& b) {
-                if (a->getTime() == b->getTime()) {
-                    return a->getPriority() < b->getPriority();  // ascending order (the lower the priority value, the higher the priority)
-                }
-                return a->getTime() < b->getTime();  // ascending order
-            });
+        }
+        // compute events
+        auto events = computeEvents();
+        // sort events
+        // closest events in time with the highest priority come first
+        std::sort(events.begin(), events.end(), [](auto& a, auto& b) {
+            if (a->getTime() == b->getTime()) {
+                return a->getPriority() < b->getPriority();  // ascending order (the lower the priority value, the higher the priority)
+            }
+            return a->getTime() < b->getTime();  // ascending order
+        });
 
-            #ifdef DEBUG     
-                for (auto& event : events) {
-                    event->print();
-                }
-            #endif
+        #ifdef DEBUG     
+            for (auto& event : events) {
+                event->print();
+            }
+        #endif
 
-            // get next event or break loop, if no events remain
-            Event<T>* nextEvent = nullptr;
-            if (events.size() != 0) {
-                nextEvent = events[0].get();
-            } else {
-                break;
+        // get next event or end the simulation, if no events remain
+        Event<T>* nextEvent = nullptr;
+        if (events.size() != 0) {
+            nextEvent = events[0].get();
+        } else {
+            // store the final state, unless it was just sampled
+            if (this->isSampling() && (sample == 0 || this->getTime() > (sample - 1) * this->getWriteInterval())) {
+                saveState();
+            }
+            return false;
+        }
+
+        // store the samples until the next event, reconstructed from the linear movement of the droplets
+        // a sample at the exact time of the event is taken in the next iteration, i.e., after the event was performed
+        T eventTime = this->getTime() + nextEvent->getTime();
+        if (this->isSampling()) {
+            T sampleTime = sample * this->getWriteInterval();
+            while (sampleTime < eventTime && sampleTime <= this->getTMax() && sampleTime <= endTime) {
+                saveState(sampleTime - this->getTime());
+                sampleTime = ++sample * this->getWriteInterval();
             }
-            // move droplets until event is reached
-            this->getTime() += nextEvent->getTime();
-            moveDroplets(nextEvent->getTime());
+            if (eventTime > this->getTMax() && endTime >= this->getTMax()) {
+                return false;
+            }
+        }
+
+        // the next event lies beyond the end time of the step, hence, only move the droplets to the end time
+        // the events are computed again from the moved droplets in the next iteration
+        if (eventTime > endTime) {
+            moveDroplets(endTime - this->getTime());
+            this->getTime() = endTime;
+            return true;
+        }
 
-            nextEvent->performEvent();
+        // move droplets until event is reached
+        this->getTime() += nextEvent->getTime();
+        moveDroplets(nextEvent->getTime());
 
-            ++this->getIterations();
+        // perform the event, or all simultaneous events that do not affect each other
+        for (Event<T>* event : selectEvents(events)) {
+            result::ScopedTimer timer(result::Phase::PerformEvent);
+            event->performEvent();
         }
+
+        ++this->getIterations();
+        return true;
     }
 
     template<typename T>
     void AbstractDroplet<T>::saveState() {
+        saveState(0.0);
+    }
+
+    template<typename T>
+    void AbstractDroplet<T>::saveState(T timeOffset) {
+        result::ScopedTimer timer(result::Phase::SaveState);
         std::unordered_map<int, T> savePressures;
         std::unordered_map<int, T> saveFlowRates;
         std::unordered_map<int, DropletPosition<T>> saveDropletPositions;
 
-        // pressures
-        for (auto& [id, node] : this->getNetwork()->getNodes()) {
-            savePressures.try_emplace(node->getId(), node->getPressure());
-        }
-
-        // flow rates
-        for (auto& [id, channel] : this->getNetwork()->getChannels()) {
-            saveFlowRates.try_emplace(channel->getId(), channel->getFlowRate());
-        }
-        for (auto& [id, pump] : this->getNetwork()->getFlowRatePumps()) {
-            saveFlowRates.try_emplace(pump->getId(), pump->getFlowRate());
-        }
-        for (auto& [id, pump] : this->getNetwork()->getPressurePumps()) {
-            saveFlowRates.try_emplace(pump->getId(), pump->getFlowRate());
-        }
+        // pressures and flow rates, or only those that changed since the previous state
+        bool keyframe = this->collectHydraulicState(savePressures, saveFlowRates);
 
         // droplet positions
         for (auto& [id, droplet] : droplets) {
@@ -468,8 +545,11 @@ namespace sim {
 
             // add boundaries
             for (auto& boundary : droplet->getBoundaries()) {
-                // get channel position
+                // get channel position, moved to the sample time in the same way as moveDroplets does
                 auto channelPosition = boundary->getChannelPosition();
+                if (timeOffset > 0 && droplet->getDropletState() == DropletState::NETWORK) {
+                    channelPosition.addToPosition((boundary->isVolumeTowardsNodeA() ? 1 : -1) * boundary->getFlowRate() * timeOffset);
+                }
                 // add boundary
                 newDropletPosition.boundaries.emplace_back(DropletBoundary<T>{channelPosition.getChannel(), channelPosition.getPosition(), boundary->isVolumeTowardsNodeA(), static_cast<BoundaryState>(static_cast<int>(boundary->getState()))});
             }
@@ -484,7 +564,7 @@ namespace sim {
         }
 
         // state
-        this->getSimulationResults()->addState(this->getTime(), savePressures, saveFlowRates, saveDropletPositions);
+        this->getSimulationResults()->addState(this->getTime() + timeOffset, savePressures, saveFlowRates, saveDropletPositions, keyframe);
     }
 
 }   /// namespace sim
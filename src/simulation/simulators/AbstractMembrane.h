@@ -34,9 +34,18 @@ template<typename T>
 class AbstractMembrane final : public AbstractConcentration<T> {
 private:
     std::unique_ptr<MembraneModel<T>> membraneModel = nullptr;                                          ///< The membrane model used for an OoC simulation.
+    InstantaneousMixingModel<T>* instantMixingModel = nullptr;                                          ///< The mixing model of the running simulation.
+    T simulationResultTimeCounter = 0.0;                                                                ///< Time in s until the next state is stored.
+    logging::RateLimiter iterationLog;                                                                  ///< Limits the iteration progress messages.
 
     void assertInitialized() const override;
 
+    void startSimulation() override;
+
+    bool iterate(T endTime) override;
+
+    void finishSimulation() override;
+
 public:
 
     /**
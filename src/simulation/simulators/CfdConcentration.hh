@@ -136,6 +136,7 @@ void CfdConcentration<T>::writeConcentrationPpm(const std::shared_ptr<Specie<T>>
 
 template<typename T>
 void CfdConcentration<T>::simulate() {
+    result::ProfileScope profileScope(this->startProfile());
     assertInitialized();
     this->initialize();
 
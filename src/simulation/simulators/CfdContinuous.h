@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <filesystem>
@@ -38,6 +39,13 @@ class RectangularChannel;
 
 }
 
+namespace test::definitions {
+// Forward declared dependencies
+template<typename T>
+class CfdContinuousTest;
+
+}
+
 namespace sim {
 
 // Forward declared dependencies
@@ -47,6 +55,9 @@ class CFDSimulator;
 template<typename T>
 class lbmSimulator;
 
+template<typename T>
+class NetworkIndicator2D;
+
 /**
  * @brief Class that conducts a CFD continuous simulation
  */
@@ -72,6 +83,10 @@ private:
     std::shared_ptr<arch::CfdModule<T>> cfdModule = nullptr;        ///< A pointer to the module, upon which this simulator acts.
     std::shared_ptr<lbmSimulator<T>> simulator = nullptr;           ///< The set of CFD simulator, that conducts the CFD simulations on <arch::Network>.
     bool writePpm = false;                                          ///< Whether to write ppm files for pressure and velocity fields.
+    size_t checkpointInterval = 0;                                  ///< Number of iterations between automatic checkpoints. 0 disables automatic checkpoints.
+    std::string restartCheckpoint = "";                             ///< Checkpoint from which the CFD simulator is restored.
+    std::string warmStartCheckpoint = "";                           ///< Checkpoint from which the CFD simulator loads its initial field.
+    bool writeStl = true;                                           ///< Whether the generated geometry is handed over through the STL file in fName instead of in memory.
 
 protected:
 
@@ -96,6 +111,13 @@ protected:
      */
     void updateSTL();
 
+    /**
+     * @brief Creates the in-memory geometry of the network, which replaces the STL file for the lbmSimulator.
+     * @returns The geometry of the network.
+     * @throws logic_error if the network contains cylindrical channels.
+     */
+    [[nodiscard]] std::shared_ptr<NetworkIndicator2D<T>> getNetworkIndicator() const;
+
     /**
      * @brief Updates the idle nodes from the dangling nodes
      */
@@ -357,6 +379,47 @@ public:
      */
     [[nodiscard]] inline bool isWritePpm() const { return writePpm; }
 
+    /**
+     * @brief Sets the number of iterations between automatic checkpoints of the CFD simulator.
+     * @param[in] interval The number of iterations between checkpoints. 0 disables automatic checkpoints.
+     */
+    inline void setCheckpointInterval(size_t interval) { this->checkpointInterval = interval; }
+
+    /**
+     * @brief Sets the checkpoint from which the CFD simulator is restored when the simulation is initialized.
+     * @param[in] name The name of the checkpoint. An empty name disables the restart.
+     * @note The boundary conditions of this simulation take precedence over the interface values stored in the checkpoint.
+     */
+    inline void setRestartCheckpoint(const std::string& name) { this->restartCheckpoint = name; }
+
+    /**
+     * @brief Sets the checkpoint from which the CFD simulator loads its initial field when the simulation is initialized.
+     * Only the lattice populations are loaded, e.g., to start a nearby design from the solution of a previous run.
+     * @param[in] name The name of the checkpoint. An empty name disables the warm start.
+     */
+    inline void setWarmStartCheckpoint(const std::string& name) { this->warmStartCheckpoint = name; }
+
+    /**
+     * @brief Sets whether the geometry, which is generated from the network, is written to an STL file and read back
+     * by the CFD simulator, instead of being handed over in memory. The STL file is the default. In memory, the
+     * channels are described by rectangles and the junctions by discs, which avoids the file round-trip but can
+     * differ from the generated mesh by a few cells at the junctions.
+     * @param[in] writeStl Whether to use the STL file.
+     */
+    inline void setWriteStl(bool writeStl) { this->writeStl = writeStl; }
+
+    /**
+     * @brief Returns whether the generated geometry is handed over through an STL file.
+     * @returns Whether the STL file is used.
+     */
+    [[nodiscard]] inline bool isWriteStl() const { return writeStl; }
+
+    /**
+     * @brief Write a checkpoint of the CFD simulator state.
+     * @param[in] name The name of the checkpoint.
+     */
+    inline void writeCheckpoint(const std::string& name) { simulator->writeCheckpoint(name); }
+
     /**
      * @brief Returns the current global characteristic length for the simulation.
      * @returns The global characteristic length
@@ -392,6 +455,8 @@ public:
     void writeVelocityPpm(std::pair<T,T> bounds, int resolution=600);
 
     void simulate() override;
+
+    friend class test::definitions::CfdContinuousTest<T>;
 };
 
 }   // namespace sim
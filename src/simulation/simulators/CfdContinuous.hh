@@ -13,15 +13,9 @@ CfdContinuous<T>::CfdContinuous(Platform platform, std::shared_ptr<arch::Network
     // Initial definition for network_stl and stlNetwork, fill dangling nodes
     updateNetworkSTL();
     generateSTL();
-    // Create a local tmp folder if it doesn't exist yet
-    std::filesystem::path tmp = "./tmp";
-    if (!std::filesystem::exists(tmp)) {
-        std::filesystem::create_directories(tmp);
-    }
-    // Create a temporary file for the STL
+    // Location of the STL file, which is only written if requested (see setWriteStl)
     fName = "./tmp/networkSTL-" + std::to_string(this->getHash());
     std::string stlLocation = fName + ".stl";
-    updateSTL();
     // Define the cfdModule
     cfdModule = std::shared_ptr<arch::CfdModule<T>>(new arch::CfdModule<T>(0, getPosition(), getSize(), stlLocation, getOpenings()));
     // Fill idle nodes
@@ -98,7 +92,6 @@ void CfdContinuous<T>::setNetwork(std::shared_ptr<arch::Network<T>> network) {
     // Update the STL definitions for the new network
     updateNetworkSTL();
     generateSTL();
-    updateSTL();
 }
 
 template<typename T>
@@ -254,15 +247,33 @@ void CfdContinuous<T>::initialize() {
     simulator->lbmInit(this->getContinuousPhase()->getViscosity(), this->getContinuousPhase()->getDensity());
     // Set boundary conditions
     setBoundaryConditions();
+    // Set checkpointing
+    simulator->setCheckpointInterval(checkpointInterval);
+    simulator->setRestartCheckpoint(restartCheckpoint);
+    simulator->setWarmStartCheckpoint(warmStartCheckpoint);
+    // Hand the generated geometry over to the simulator, either in memory or through the STL file
+    if (network_stl != nullptr) {
+        if (writeStl) {
+            updateSTL();
+            simulator->setNetworkIndicator(nullptr);
+        } else {
+            simulator->setNetworkIndicator(getNetworkIndicator());
+        }
+    }
     // Prepare geometry and lattice
     simulator->prepareGeometry();
     simulator->prepareLattice();
+    // The boundary conditions take precedence over those stored in a restart checkpoint
+    if (!restartCheckpoint.empty()) {
+        setBoundaryConditions();
+    }
     // Check that the simulator is initialized
     simulator->checkInitialized();
 }
 
 template<typename T>
 void CfdContinuous<T>::simulate() {
+    result::ProfileScope profileScope(this->startProfile());
     this->assertInitialized();
     this->initialize();
 
@@ -279,6 +290,7 @@ void CfdContinuous<T>::simulate() {
 
 template<typename T>
 void CfdContinuous<T>::saveState() {
+    result::ScopedTimer timer(result::Phase::SaveState);
     std::unordered_map<int, std::string> vtkFiles;
 
     // vtk File
@@ -324,8 +336,48 @@ void CfdContinuous<T>::updateNetworkSTL() {
 
 template<typename T>
 void CfdContinuous<T>::updateSTL() {
+    // Create the folder of the STL file if it doesn't exist yet
+    std::filesystem::path folder = std::filesystem::path(fName).parent_path();
+    if (!folder.empty() && !std::filesystem::exists(folder)) {
+        std::filesystem::create_directories(folder);
+    }
     stlNetwork->writeSTL(fName);
 }
+
+template<typename T>
+std::shared_ptr<NetworkIndicator2D<T>> CfdContinuous<T>::getNetworkIndicator() const {
+    std::vector<typename NetworkIndicator2D<T>::Channel> channels;
+    std::unordered_map<size_t, T> junctionRadii;
+    for (auto& [key, channel] : this->getNetwork()->getChannels()) {
+        if (!channel->isRectangular()) {
+            throw std::logic_error("STL generation is not supported for cylindrical channels.");
+        }
+        auto nodeA = this->getNetwork()->getNodes().at(channel->getNodeAId());
+        auto nodeB = this->getNetwork()->getNodes().at(channel->getNodeBId());
+        T halfWidth = 0.5 * dynamic_cast<arch::RectangularChannel<T>*>(channel.get())->getWidth();
+        channels.push_back({nodeA->getPosition()[0], nodeA->getPosition()[1], nodeB->getPosition()[0], nodeB->getPosition()[1], halfWidth});
+        for (auto& node : {nodeA, nodeB}) {
+            auto [it, inserted] = junctionRadii.try_emplace(node->getId(), halfWidth);
+            it->second = std::max(it->second, halfWidth);
+        }
+    }
+
+    // Junctions at the inner nodes, in a fixed order for the geometry cache
+    std::vector<size_t> innerNodeIds;
+    for (auto& [nodeId, radius] : junctionRadii) {
+        if (danglingNodes.find(this->getNetwork()->getNodes().at(nodeId)) == danglingNodes.end()) {
+            innerNodeIds.push_back(nodeId);
+        }
+    }
+    std::sort(innerNodeIds.begin(), innerNodeIds.end());
+    std::vector<typename NetworkIndicator2D<T>::Junction> junctions;
+    for (size_t nodeId : innerNodeIds) {
+        auto& node = this->getNetwork()->getNodes().at(nodeId);
+        junctions.push_back({node->getPosition()[0], node->getPosition()[1], junctionRadii.at(nodeId)});
+    }
+
+    return std::make_shared<NetworkIndicator2D<T>>(std::move(channels), std::move(junctions));
+}
     
 template<typename T>
 void CfdContinuous<T>::updateIdleNodes() {
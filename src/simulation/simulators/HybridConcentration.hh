@@ -131,6 +131,7 @@ void HybridConcentration<T>::writeConcentrationPpm(size_t adKey, std::pair<T,T>
 
 template<typename T>
 void HybridConcentration<T>::simulate() {
+    result::ProfileScope profileScope(this->startProfile());
     Simulation<T>::simulate();
     this->assertInitialized();              // perform initialization checks
     this->initialize();                     // initialize the simulation
@@ -156,10 +157,10 @@ void HybridConcentration<T>::simulate() {
         pressureConverged = HybridContinuous<T>::conductNodalAnalysis().value();
     }
 
-    #ifdef VERBOSE     
+    if (logging::Logger::isEnabled(logging::LogLevel::Debug)) {
         this->printResults();
-        std::cout << "[Simulation] All pressures have converged." << std::endl; 
-    #endif
+    }
+    MMFT_LOG_INFO("[Simulation] All pressures have converged.");
 
     if (this->getWritePpm()) {
         this->writePressurePpm(this->getGlobalPressureBounds());
@@ -187,6 +188,7 @@ void HybridConcentration<T>::simulate() {
 
 template<typename T>
 void HybridConcentration<T>::saveState() {
+    result::ScopedTimer timer(result::Phase::SaveState);
     std::unordered_map<int, T> savePressures;
     std::unordered_map<int, T> saveFlowRates;
     std::unordered_map<int, std::deque<MixturePosition<T>>> saveMixturePositions;
@@ -238,6 +240,9 @@ void HybridConcentration<T>::saveState() {
 
     // state
     this->getSimulationResults()->addState(this->getTime(), savePressures, saveFlowRates, saveMixturePositions, vtkFiles);
+
+    // theta schedules of adaptive update schemes
+    this->saveThetaSchedules();
 }
 
 template<typename T>
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include <iostream>
 #include <math.h>
 #include <memory>
@@ -36,6 +37,9 @@ class Scheme;
 template<typename T>
 class NaiveScheme;
 
+template<typename T>
+class AdaptiveScheme;
+
 }
 
 namespace sim {
@@ -72,6 +76,14 @@ private:
     bool writePpm = true;
     bool eventBasedWriting = false;
 
+    /**
+     * @brief Creates an adaptive update scheme for a simulator and sets it, replacing the previous scheme.
+     * @param[in] simulator A pointer to the simulator for which the update scheme is set.
+     * @param[in] createScheme Function that creates the adaptive scheme, called once the simulator is found.
+     * @throws logic_error if the simulator is not part of this simulation.
+     */
+    void installAdaptiveScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, const std::function<std::unique_ptr<mmft::AdaptiveScheme<T>>()>& createScheme);
+
 protected:
 
     /**
@@ -129,6 +141,11 @@ protected:
      */
     bool getWritePpm() { return writePpm; }
 
+    /**
+     * @brief Stores the theta schedules of all adaptive update schemes in the simulation results.
+     */
+    void saveThetaSchedules();
+
 public:
 
     /**
@@ -238,6 +255,35 @@ public:
      */
     void setNaiveHybridScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, std::unordered_map<int, T> alpha, std::unordered_map<int, T> beta, int theta);
 
+    /**
+     * @brief Define and set the adaptive update scheme for a hybrid simulation on all nodes in all simulators.
+     * @param[in] alpha The relaxation value for the pressure value update for all nodes.
+     * @param[in] beta The relaxation value for the flow rate value update for all nodes.
+     * @param[in] thetaMin The minimal amount of LBM stream and collide cycles between updates for all simulators.
+     * @param[in] thetaMax The maximal amount of LBM stream and collide cycles between updates for all simulators.
+     */
+    void setAdaptiveHybridScheme(T alpha, T beta, int thetaMin, int thetaMax);
+
+    /**
+     * @brief Define and set the adaptive update scheme for a hybrid simulation on all nodes of the module.
+     * @param[in] simulator A pointer to the simulator for which the update scheme is set.
+     * @param[in] alpha The relaxation value for the pressure value update for all nodes of the module.
+     * @param[in] beta The relaxation value for the flow rate value update for all nodes of the module.
+     * @param[in] thetaMin The minimal amount of LBM stream and collide cycles between updates for the module.
+     * @param[in] thetaMax The maximal amount of LBM stream and collide cycles between updates for the module.
+     */
+    void setAdaptiveHybridScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, T alpha, T beta, int thetaMin, int thetaMax);
+
+    /**
+     * @brief Define and set the adaptive update scheme for a hybrid simulation.
+     * @param[in] simulator A pointer to the simulator for which the update scheme is set.
+     * @param[in] alpha The relaxation value for the pressure value update for the nodes of the module. <nodeId, alpha>
+     * @param[in] beta The relaxation value for the flow rate value update for the nodes of the module. <nodeId, beta>
+     * @param[in] thetaMin The minimal amount of LBM stream and collide cycles between updates for the module.
+     * @param[in] thetaMax The maximal amount of LBM stream and collide cycles between updates for the module.
+     */
+    void setAdaptiveHybridScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, std::unordered_map<int, T> alpha, std::unordered_map<int, T> beta, int thetaMin, int thetaMax);
+
     /**
      * @brief Get the global bounds of pressure values in the CFD simulators.
      * @return A tuple with the global bounds for pressure values <pMin, pMax>
@@ -146,6 +146,49 @@ void HybridContinuous<T>::setNaiveHybridScheme(const std::shared_ptr<CFDSimulato
     }
 }
 
+template<typename T>
+void HybridContinuous<T>::setAdaptiveHybridScheme(T alpha, T beta, int thetaMin, int thetaMax) {
+    for (auto& [key, simulator] : cfdSimulators) {
+        setAdaptiveHybridScheme(simulator, alpha, beta, thetaMin, thetaMax);
+    }
+}
+
+template<typename T>
+void HybridContinuous<T>::setAdaptiveHybridScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, T alpha, T beta, int thetaMin, int thetaMax) {
+    installAdaptiveScheme(simulator, [&]() {
+        return std::make_unique<mmft::AdaptiveScheme<T>>(simulator->getModule(), alpha, beta, thetaMin, thetaMax);
+    });
+}
+
+template<typename T>
+void HybridContinuous<T>::setAdaptiveHybridScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, std::unordered_map<int, T> alpha, std::unordered_map<int, T> beta, int thetaMin, int thetaMax) {
+    installAdaptiveScheme(simulator, [&]() {
+        return std::make_unique<mmft::AdaptiveScheme<T>>(simulator->getModule(), alpha, beta, thetaMin, thetaMax);
+    });
+}
+
+template<typename T>
+void HybridContinuous<T>::installAdaptiveScheme(const std::shared_ptr<CFDSimulator<T>>& simulator, const std::function<std::unique_ptr<mmft::AdaptiveScheme<T>>()>& createScheme) {
+    if (cfdSimulators.find(simulator->getId()) == cfdSimulators.end()) {
+        // The provided simulator pointer is not listed in this hybrid simulation
+        throw std::logic_error("Cannot set Scheme for Lbm Simulator " + std::to_string(simulator->getId()) + ". Simulator not found.");
+    }
+    // Always create a new scheme, such that the residual history and schedule start fresh
+    auto adaptiveScheme = createScheme();
+    simulator->setUpdateScheme(adaptiveScheme.get());
+    updateSchemes.insert_or_assign(simulator->getId(), std::move(adaptiveScheme));
+}
+
+template<typename T>
+void HybridContinuous<T>::saveThetaSchedules() {
+    for (auto& [key, scheme] : updateSchemes) {
+        if (scheme->isAdaptive()) {
+            auto adaptiveScheme = static_cast<const mmft::AdaptiveScheme<T>*>(scheme.get());
+            this->getSimulationResults()->setThetaSchedule(key, adaptiveScheme->getThetaSchedule());
+        }
+    }
+}
+
 template<typename T>
 essLbmSimulator<T>* HybridContinuous<T>::addEssLbmSimulator(std::string name, std::string stlFile, std::shared_ptr<arch::Module<T>> module, std::unordered_map<int, arch::Opening<T>> openings,
                                                     T charPhysLength, T charPhysVelocity, T resolution, T epsilon, T tau)
@@ -244,9 +287,7 @@ void HybridContinuous<T>::initialize() {
 
     Simulation<T>::initialize();    // Initialize base class
 
-    #ifdef VERBOSE
-        std::cout << "[Simulation] Initialize CFD simulators..." << std::endl;
-    #endif
+    MMFT_LOG_INFO("[Simulation] Initialize CFD simulators...");
 
     // Initialize the CFD simulators
     for (auto& [key, cfdSimulator] : cfdSimulators) {
@@ -254,15 +295,11 @@ void HybridContinuous<T>::initialize() {
     }
 
     // compute nodal analysis
-    #ifdef VERBOSE
-        std::cout << "[Simulation] Conduct initial nodal analysis..." << std::endl;
-    #endif
+    MMFT_LOG_INFO("[Simulation] Conduct initial nodal analysis...");
     HybridContinuous<T>::conductNodalAnalysis();
 
     // Prepare CFD geometry and lattice
-    #ifdef VERBOSE
-        std::cout << "[Simulation] Prepare CFD geometry and lattice..." << std::endl;
-    #endif
+    MMFT_LOG_INFO("[Simulation] Prepare CFD geometry and lattice...");
 
     for (auto& [key, cfdSimulator] : cfdSimulators) {
         cfdSimulator->prepareGeometry();
@@ -272,6 +309,7 @@ void HybridContinuous<T>::initialize() {
 
 template<typename T>
 void HybridContinuous<T>::simulate() {
+    result::ProfileScope profileScope(this->startProfile());
     Simulation<T>::simulate();
     this->assertInitialized();              // perform initialization checks
     this->initialize();                     // initialize the simulation
@@ -297,12 +335,12 @@ void HybridContinuous<T>::simulate() {
         pressureConverged = HybridContinuous<T>::conductNodalAnalysis().value();
     }
 
-    #ifdef VERBOSE     
-        if (pressureConverged && allConverged) {
-            std::cout << "[Simulation] All pressures have converged." << std::endl;
-        } 
+    if (pressureConverged && allConverged) {
+        MMFT_LOG_INFO("[Simulation] All pressures have converged.");
+    }
+    if (logging::Logger::isEnabled(logging::LogLevel::Debug)) {
         this->printResults();
-    #endif
+    }
 
     if (writePpm) {
         writePressurePpm(getGlobalPressureBounds());
@@ -314,6 +352,7 @@ void HybridContinuous<T>::simulate() {
 
 template<typename T>
 void HybridContinuous<T>::saveState() {
+    result::ScopedTimer timer(result::Phase::SaveState);
     std::unordered_map<int, T> savePressures;
     std::unordered_map<int, T> saveFlowRates;
     std::unordered_map<int, std::string> vtkFiles;
@@ -341,6 +380,9 @@ void HybridContinuous<T>::saveState() {
 
     // state
     this->getSimulationResults()->addState(this->getTime(), savePressures, saveFlowRates, vtkFiles);
+
+    // theta schedules of adaptive update schemes
+    saveThetaSchedules();
 }
     
 template<typename T>
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <math.h>
 #include <memory>
 #include <optional>
@@ -33,6 +34,8 @@ class NodalAnalysis;
 namespace result {
 
 // Forward declared dependencies
+class Profile;
+
 template<typename T>
 class SimulationResult;
 
@@ -83,6 +86,11 @@ private:
     T writeInterval = 0.1;
     T tMax = 100;
     std::shared_ptr<result::SimulationResult<T>> simulationResult = nullptr;
+    bool profiling = false;                                                             ///< Whether run times and counters are recorded in the simulation result.
+    bool sampling = false;                                                              ///< Whether states are only recorded at multiples of the write interval.
+    bool started = false;                                                               ///< Whether the simulation was started for stepping with start().
+    bool finished = false;                                                              ///< Whether a started simulation has no events left.
+    result::Profile* activeProfile = nullptr;                                           ///< Profile of the current run, or nullptr if it is not profiled.
 
     // Disabled because no stable simulator uses tissues
     // std::unordered_map<int, std::shared_ptr<Tissue<T>>> tissues;                        ///< Tissues specified for the simulation.
@@ -181,11 +189,54 @@ protected:
      */
     inline result::SimulationResult<T>* getSimulationResults() const { return simulationResult.get(); }
 
+    /**
+     * @brief Creates a new profile in the simulation result if profiling is enabled. The simulators activate it with
+     * a result::ProfileScope for the duration of simulate(), and start(), step() and advanceTo() continue it.
+     * @return Pointer to the new profile, or nullptr if profiling is disabled.
+     */
+    result::Profile* startProfile();
+
+    /**
+     * @brief Collects the pressures of the nodes and the flow rates of the channels and pumps for a new state. For a
+     * keyframe all values are collected, otherwise only the values that changed since the last state of the result.
+     * @param[out] pressures The collected pressures.
+     * @param[out] flowRates The collected flow rates.
+     * @return Whether the collected values form a keyframe.
+     */
+    bool collectHydraulicState(std::unordered_map<int, T>& pressures, std::unordered_map<int, T>& flowRates) const;
+
     /**
      * @brief Get the current iteration number.
      */
     inline size_t& getIterations() { return iteration; }
 
+    /**
+     * @brief Prepares the simulation loop, i.e., performs the checks and initialization that simulate() performs before
+     * its first iteration, and resets the state of the loop.
+     * @throws std::logic_error if the simulation does not support stepping.
+     */
+    virtual void startSimulation();
+
+    /**
+     * @brief Prepares a started simulation for the next call of step() or advanceTo(), e.g., to take changes of the
+     * pumps into account.
+     */
+    virtual void resumeSimulation() { }
+
+    /**
+     * @brief Performs one iteration of the simulation loop, i.e., solves the network, stores the state and performs the
+     * next event. If the next event takes place after endTime, the simulation is only advanced to endTime.
+     * @param[in] endTime Time in s up to which the simulation may be advanced.
+     * @return Whether the simulation continues, i.e., false if no events are left or the maximal end time is reached.
+     * @throws std::logic_error if the simulation does not support stepping.
+     */
+    virtual bool iterate(T endTime);
+
+    /**
+     * @brief Completes the results once the simulation loop has ended.
+     */
+    virtual void finishSimulation() { }
+
     /**
      * @brief Removes a fluid from the simulation, based on the fluid id
      * @param[in] fluidId The id of the fluid that is to be removed
@@ -335,6 +386,46 @@ public:
      */
     void inline setWriteInterval(T interval) { this->writeInterval = interval; }
 
+    /**
+     * @brief Enable or disable time-based sampling of the simulation states. When enabled, the abstract droplet and
+     * concentration simulations record the state at every multiple of the write interval, instead of after every event,
+     * and end at the maximal end time. The size of the result is then bounded by the simulated duration instead of the
+     * number of events.
+     * @param[in] sampling Whether the states are sampled at the write interval.
+     */
+    inline void setSampling(bool sampling) { this->sampling = sampling; }
+
+    /**
+     * @brief Returns whether the simulation states are sampled at the write interval.
+     */
+    [[nodiscard]] inline bool isSampling() const { return sampling; }
+
+    /**
+     * @brief Set the keyframe interval of the states. The abstract droplet and concentration simulations store the
+     * pressures and flow rates of a state only as far as they changed since the previous state, and store all of them
+     * in every keyframeInterval-th state. The full values of a state are rebuilt transparently on access.
+     * @param[in] keyframeInterval Number of states from one keyframe to the next. 1 stores every state as a keyframe.
+     * @throws std::invalid_argument if the interval is 0.
+     */
+    void setKeyframeInterval(size_t keyframeInterval);
+
+    /**
+     * @brief Returns the keyframe interval of the states.
+     */
+    [[nodiscard]] inline size_t getKeyframeInterval() const { return simulationResult->keyframeInterval; }
+
+    /**
+     * @brief Enable or disable the recording of run times and counters of the simulation phases. The profile of a
+     * simulation is available from its result.
+     * @param[in] profiling Whether the simulation is profiled.
+     */
+    inline void setProfiling(bool profiling) { this->profiling = profiling; }
+
+    /**
+     * @brief Returns whether run times and counters of the simulation phases are recorded.
+     */
+    [[nodiscard]] inline bool isProfiling() const { return profiling; }
+
     /**
      * @brief Returns the maximal allowed time, tMax.
      */
@@ -363,6 +454,36 @@ public:
      */
     virtual void simulate();
 
+    /**
+     * @brief Prepares the simulation for stepping with step() and advanceTo(). This performs the checks and the
+     * initialization of simulate() once. Subsequent calls do nothing. Changes of the pumps between the steps are taken
+     * into account by the next step, while the solver, the simulation time and the results are kept.
+     * Supported by the abstract droplet, concentration and membrane simulations.
+     * @throws std::logic_error if the simulation does not support stepping.
+     */
+    void start();
+
+    /**
+     * @brief Performs the next iterations of the simulation, each of which performs one event (see simulate()).
+     * Starts the simulation if it was not started yet.
+     * @param[in] events Number of iterations.
+     * @return Whether the simulation continues, i.e., false if no events are left.
+     */
+    bool step(size_t events = 1);
+
+    /**
+     * @brief Advances the simulation up to the given time. Events until this time are performed, and the simulation is
+     * then moved to exactly this time. Starts the simulation if it was not started yet.
+     * @param[in] time Simulation time in s.
+     * @return Whether the simulation continues, i.e., false if no events are left.
+     */
+    bool advanceTo(T time);
+
+    /**
+     * @brief Returns whether a simulation that was started for stepping has ended.
+     */
+    [[nodiscard]] inline bool isFinished() const { return finished; }
+
     /**
      * @brief Mandatory virtual destructor is set to default.
      */
@@ -141,6 +141,9 @@ namespace sim {
         if (resistanceModel == nullptr) {
             throw std::logic_error("Simulation not initialized: Resistance model is not set.");
         }
+        if (sampling && writeInterval <= 0) {
+            throw std::logic_error("Simulation not initialized: Write interval must be positive for sampling.");
+        }
     }
 
     template<typename T>
@@ -161,9 +164,7 @@ namespace sim {
     template<typename T>
     void Simulation<T>::initialize() {
         // compute and set channel lengths
-        #ifdef VERBOSE
-            std::cout << "[Simulation] Compute and set channel lengths..." << std::endl;
-        #endif
+        MMFT_LOG_INFO("[Simulation] Compute and set channel lengths...");
         for (auto& [key, channel] : network->getChannels()) {
             T calculatedLength = network->calculateNodeDistance(channel->getNodeAId(), channel->getNodeBId());
 
@@ -175,9 +176,7 @@ namespace sim {
         }
 
         // compute channel resistances
-        #ifdef VERBOSE
-            std::cout << "[Simulation] Compute and set channel resistances..." << std::endl;
-        #endif
+        MMFT_LOG_INFO("[Simulation] Compute and set channel resistances...");
         for (auto& [key, channel] : network->getChannels()) {
             if (channel->isRectangular()) {
                 T resistance = resistanceModel->getChannelResistance(dynamic_cast<arch::RectangularChannel<T>*>(channel.get()));
@@ -193,6 +192,59 @@ namespace sim {
         nodalAnalysis = std::make_shared<nodal::NodalAnalysis<T>> (network.get());
     }
 
+    template<typename T>
+    result::Profile* Simulation<T>::startProfile() {
+        if (!profiling) {
+            simulationResult->profile = nullptr;
+            activeProfile = nullptr;
+            return nullptr;
+        }
+        auto profile = std::make_shared<result::Profile>();
+        simulationResult->profile = profile;
+        activeProfile = profile.get();
+        return activeProfile;
+    }
+
+    template<typename T>
+    bool Simulation<T>::collectHydraulicState(std::unordered_map<int, T>& pressures, std::unordered_map<int, T>& flowRates) const {
+        const bool keyframe = simulationResult->isKeyframeDue();
+        const size_t revision = simulationResult->getSavedRevision();
+        auto changed = [&](const auto& entity) { return keyframe || entity->getRevision() > revision; };
+
+        // pressures
+        for (auto& [id, node] : network->getNodes()) {
+            if (changed(node)) {
+                pressures.try_emplace(node->getId(), node->getPressure());
+            }
+        }
+
+        // flow rates
+        for (auto& [id, channel] : network->getChannels()) {
+            if (changed(channel)) {
+                flowRates.try_emplace(channel->getId(), channel->getFlowRate());
+            }
+        }
+        for (auto& [id, pump] : network->getFlowRatePumps()) {
+            if (changed(pump)) {
+                flowRates.try_emplace(pump->getId(), pump->getFlowRate());
+            }
+        }
+        for (auto& [id, pump] : network->getPressurePumps()) {
+            if (changed(pump)) {
+                flowRates.try_emplace(pump->getId(), pump->getFlowRate());
+            }
+        }
+        return keyframe;
+    }
+
+    template<typename T>
+    void Simulation<T>::setKeyframeInterval(size_t keyframeInterval) {
+        if (keyframeInterval == 0) {
+            throw std::invalid_argument("Keyframe interval must be at least 1.");
+        }
+        simulationResult->keyframeInterval = keyframeInterval;
+    }
+
     template<typename T>
     void Simulation<T>::simulate() {
         // Perform common simulation steps
@@ -200,4 +252,57 @@ namespace sim {
         network->isNetworkValid();         // Check if the network is valid
     }
 
+    template<typename T>
+    void Simulation<T>::startSimulation() {
+        throw std::logic_error("Stepping is not supported for this simulation.");
+    }
+
+    template<typename T>
+    bool Simulation<T>::iterate(T) {
+        throw std::logic_error("Stepping is not supported for this simulation.");
+    }
+
+    template<typename T>
+    void Simulation<T>::start() {
+        if (started) {
+            return;
+        }
+        result::ProfileScope profileScope(startProfile());
+        startSimulation();
+        started = true;
+        finished = false;
+    }
+
+    template<typename T>
+    bool Simulation<T>::step(size_t events) {
+        start();
+        result::ProfileScope profileScope(activeProfile);
+        if (!finished) {
+            resumeSimulation();
+        }
+        for (size_t i = 0; i < events && !finished; ++i) {
+            if (!iterate(std::numeric_limits<T>::infinity())) {
+                finishSimulation();
+                finished = true;
+            }
+        }
+        return !finished;
+    }
+
+    template<typename T>
+    bool Simulation<T>::advanceTo(T endTime) {
+        start();
+        result::ProfileScope profileScope(activeProfile);
+        if (!finished) {
+            resumeSimulation();
+        }
+        while (!finished && time < endTime) {
+            if (!iterate(endTime)) {
+                finishSimulation();
+                finished = true;
+            }
+        }
+        return !finished;
+    }
+
 }   /// namespace sim
@@ -0,0 +1,83 @@
+/**
+ * @file SimulationPool.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+#include <vector>
+
+namespace sim {
+
+// Forward declared dependencies
+template<typename T>
+class Simulation;
+
+/**
+ * @brief Enum to specify how worker threads are pinned to the processors.
+*/
+enum class Pinning {
+    None,       ///< Threads are not pinned and scheduled freely by the operating system.
+    Compact,    ///< Worker w is pinned to processor w, modulo the number of processors.
+    Spread      ///< Workers are pinned to processors that are evenly spread over all processors.
+};
+
+/**
+ * @brief Returns the processor to which a worker thread is pinned.
+ * @param[in] pinning The pinning strategy, must not be Pinning::None.
+ * @param[in] worker Index of the worker.
+ * @param[in] workers Number of workers.
+ * @returns Index of the processor.
+*/
+inline size_t pinnedProcessor(Pinning pinning, size_t worker, size_t workers);
+
+/**
+ * @brief Pins the calling thread to a processor. Only supported on Linux.
+ * @param[in] processor Index of the processor.
+ * @returns Whether the thread was pinned.
+*/
+inline bool pinCurrentThread(size_t processor);
+
+/**
+ * @brief Returns the number of worker threads that is used for a number of independent jobs.
+ * @param[in] threads Requested number of threads, 0 selects the number of hardware threads.
+ * @param[in] jobCount Number of jobs.
+ * @returns Number of threads, at least 1 and at most the number of jobs.
+*/
+inline size_t workerCount(size_t threads, size_t jobCount);
+
+/**
+ * @brief Runs independent jobs on a pool of worker threads. Each worker repeatedly takes the next job that has not
+ * been started yet, such that jobs of different run times are balanced over the workers. With a single worker, the
+ * jobs are run in order on the calling thread.
+ * @param[in] jobCount Number of jobs. Job i is run by calling job(i).
+ * @param[in] threads Number of worker threads, 0 selects the number of hardware threads.
+ * @param[in] job The function that runs a job.
+ * @param[in] startWorker Optional function that is called with the index of the worker when a worker starts, e.g., to
+ * pin the worker thread. With a single worker, it is called on the calling thread.
+ * @returns The exception that was thrown by each job, or nullptr if the job succeeded.
+*/
+inline std::vector<std::exception_ptr> runJobs(size_t jobCount, size_t threads, const std::function<void(size_t)>& job,
+                                               const std::function<void(size_t)>& startWorker = nullptr);
+
+/**
+ * @brief Simulates independent simulations concurrently. Abstract simulations are distributed over the worker threads.
+ * Hybrid and CFD simulations share process-wide state of the CFD solvers and are simulated one after another.
+ * @param[in] simulations The simulations. No two simulations may act on the same network.
+ * @param[in] threads Number of worker threads, 0 selects the number of hardware threads.
+ * @throws The first exception, in the order of the simulations, that was thrown by a simulation. All simulations are
+ * run to completion or failure before.
+*/
+template<typename T>
+void simulateConcurrently(const std::vector<Simulation<T>*>& simulations, size_t threads = 0);
+
+}   // namespace sim
@@ -0,0 +1,98 @@
+#include "SimulationPool.h"
+
+namespace sim {
+
+inline size_t workerCount(size_t threads, size_t jobCount) {
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    return std::max<size_t>(std::min(threads, jobCount), 1);
+}
+
+inline size_t pinnedProcessor(Pinning pinning, size_t worker, size_t workers) {
+    size_t processors = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    if (pinning == Pinning::Spread && workers < processors) {
+        return worker * processors / workers;
+    }
+    return worker % processors;
+}
+
+inline bool pinCurrentThread(size_t processor) {
+#ifdef __linux__
+    if (processor >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(processor, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+inline std::vector<std::exception_ptr> runJobs(size_t jobCount, size_t threads, const std::function<void(size_t)>& job,
+                                               const std::function<void(size_t)>& startWorker) {
+    std::vector<std::exception_ptr> errors(jobCount);
+    std::atomic<size_t> nextJob { 0 };
+
+    auto work = [&](size_t worker) {
+        if (startWorker) {
+            startWorker(worker);
+        }
+        for (size_t i = nextJob++; i < jobCount; i = nextJob++) {
+            try {
+                job(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    size_t workers = workerCount(threads, jobCount);
+    if (workers == 1) {
+        work(0);
+        return errors;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        pool.emplace_back(work, w);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return errors;
+}
+
+template<typename T>
+void simulateConcurrently(const std::vector<Simulation<T>*>& simulations, size_t threads) {
+    std::vector<size_t> concurrent;
+    std::vector<size_t> sequential;
+    for (size_t i = 0; i < simulations.size(); ++i) {
+        if (simulations[i]->getType() == Type::Abstract) {
+            concurrent.push_back(i);
+        } else {
+            sequential.push_back(i);
+        }
+    }
+
+    std::vector<std::exception_ptr> errors(simulations.size());
+    auto concurrentErrors = runJobs(concurrent.size(), threads, [&](size_t i) { simulations[concurrent[i]]->simulate(); });
+    auto sequentialErrors = runJobs(sequential.size(), 1, [&](size_t i) { simulations[sequential[i]]->simulate(); });
+    for (size_t i = 0; i < concurrent.size(); ++i) {
+        errors[concurrent[i]] = concurrentErrors[i];
+    }
+    for (size_t i = 0; i < sequential.size(); ++i) {
+        errors[sequential[i]] = sequentialErrors[i];
+    }
+
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}   // namespace sim
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -58,13 +59,26 @@ class HybridConcentration;
 template<typename T>
 class Specie;
 
+/**
+ * @brief Floating point type of the lattices of the CFD simulators. If the simulator is built with USE_FLOAT_LATTICE,
+ * the lattices run in single precision, which halves their memory traffic, while the nodal analysis and the values
+ * that are exchanged with it through storePressures() and storeFlowRates() remain in precision T.
+ */
+#ifdef USE_FLOAT_LATTICE
+template<typename T>
+using LatticePrecision = float;
+#else
+template<typename T>
+using LatticePrecision = T;
+#endif
+
 /**
  * @brief Class to specify a module, which is a functional component in a network.
 */
 template<typename T>
 class CFDSimulator {
 protected:
-    inline static size_t simulatorCounter = 0;  ///< Global counter for amount of created CFD simulator objects.
+    inline static std::atomic<size_t> simulatorCounter { 0 };   ///< Global counter for amount of created CFD simulator objects.
     size_t const id;                            ///< Id of the simulator.
     std::string name;                           ///< Name of the simulator.
     std::string vtkFolder = "./tmp/";           ///< Folder in which vtk files will be saved.
@@ -411,6 +425,60 @@ public:
         throw std::runtime_error("The function getConcentrationBounds is undefined for this CFD simulator.");
     }
 
+    /**
+     * @brief Write a checkpoint of the simulator state, from which the simulation can be resumed.
+     * @param[in] name The name of the checkpoint.
+     */
+    virtual void writeCheckpoint(const std::string& name)
+    {
+        throw std::runtime_error("The function writeCheckpoint is undefined for this CFD simulator.");
+    }
+
+    /**
+     * @brief Restore the simulator state from a checkpoint.
+     * @param[in] name The name of the checkpoint.
+     */
+    virtual void readCheckpoint(const std::string& name)
+    {
+        throw std::runtime_error("The function readCheckpoint is undefined for this CFD simulator.");
+    }
+
+    /**
+     * @brief Set the number of iterations between automatic checkpoints.
+     * @param[in] interval The number of iterations between checkpoints. 0 disables automatic checkpoints.
+     */
+    virtual void setCheckpointInterval(size_t interval)
+    {
+        throw std::runtime_error("The function setCheckpointInterval is undefined for this CFD simulator.");
+    }
+
+    /**
+     * @brief Set the checkpoint from which the simulator is restored after the lattice is prepared.
+     * @param[in] name The name of the checkpoint.
+     */
+    virtual void setRestartCheckpoint(const std::string& name)
+    {
+        throw std::runtime_error("The function setRestartCheckpoint is undefined for this CFD simulator.");
+    }
+
+    /**
+     * @brief Set a checkpoint from which the lattice populations are loaded as initial field.
+     * @param[in] name The name of the checkpoint.
+     */
+    virtual void setWarmStartCheckpoint(const std::string& name)
+    {
+        throw std::runtime_error("The function setWarmStartCheckpoint is undefined for this CFD simulator.");
+    }
+
+    /**
+     * @brief Set whether the initial field is estimated from the Poiseuille channels of the moduleNetwork.
+     * @param[in] warmStart Whether the estimate is used as initial condition.
+     */
+    virtual void setPoiseuilleWarmStart(bool warmStart)
+    {
+        throw std::runtime_error("The function setPoiseuilleWarmStart is undefined for this CFD simulator.");
+    }
+
     friend bool conductCFDSimulation<T>(const std::unordered_map<int, std::shared_ptr<CFDSimulator<T>>>& cfdSimulators);
     friend void coupleNsAdLattices<T>(const std::unordered_map<int, std::shared_ptr<CFDSimulator<T>>>& cfdSimulators);
     friend bool conductADSimulation<T>(const std::unordered_map<int, std::shared_ptr<CFDSimulator<T>>>& cfdSimulators);
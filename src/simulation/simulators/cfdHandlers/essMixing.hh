@@ -78,9 +78,7 @@ namespace sim{
         setFlowRates(flowRates);
         setPressures(pressures);
 
-        #ifdef VERBOSE
-            std::cout << "[essLbmModule] lbmInit " << this->name << "... OK" << std::endl;
-        #endif
+        MMFT_LOG_INFO("[essLbmModule] lbmInit " << this->name << "... OK");
     }
 
     template<typename T>
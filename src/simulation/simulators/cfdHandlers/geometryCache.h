@@ -0,0 +1,142 @@
+/**
+ * @file geometryCache.h
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace arch {
+
+// Forward declared dependencies
+template<typename T>
+class CfdModule;
+
+}
+
+namespace sim {
+
+/**
+ * @brief The voxelized geometry of a CFD module, i.e., the material numbers of the lattice after the STL file was
+ * read and the openings were defined, together with the bounds that are needed to rebuild the cuboid geometry.
+*/
+template<typename T>
+struct CachedGeometry {
+    std::array<T,2> stlMin;                         ///< Lower bound of the STL mesh.
+    std::array<T,2> origin;                         ///< Origin of the cuboid geometry.
+    std::array<T,2> extend;                         ///< Extend of the cuboid geometry.
+    std::vector<std::vector<int>> materials;        ///< Material numbers of each cuboid, ordered by x and then y. <cuboidId, <material>>
+};
+
+/**
+ * @brief Process-wide cache of voxelized module geometries, keyed by the content of the STL file, the grid spacing,
+ * the STL margin and the openings of the module. Geometries are kept in memory and, if a cache directory is set,
+ * also written to and read from disk, so that subsequent runs on the same chip skip the voxelization.
+*/
+template<typename T>
+class GeometryCache {
+
+private:
+    /**
+     * @brief The state of the cache, shared by all simulators of the process.
+     */
+    struct State {
+        std::mutex mutex;
+        bool enabled = true;
+        std::string directory = "";
+        std::unordered_map<std::string, std::shared_ptr<const CachedGeometry<T>>> entries;
+    };
+
+    static constexpr uint32_t cacheVersion = 1;     ///< Version of the binary cache file format.
+
+    /**
+     * @brief Returns the state of the cache.
+     * @returns The cache state.
+     */
+    static State& getState();
+
+    /**
+     * @brief Returns the location of the cache file of a geometry.
+     * @param[in] directory The cache directory.
+     * @param[in] key The key of the geometry.
+     * @returns The path to the cache file.
+     */
+    static std::string getCacheFile(const std::string& directory, const std::string& key);
+
+public:
+    /**
+     * @brief Computes the cache key of the geometry of a module.
+     * @param[in] module The module.
+     * @param[in] dx The grid spacing in _m_.
+     * @param[in] margin The margin around the STL geometry in grid cells.
+     * @returns The cache key, or an empty string if the STL file cannot be read.
+     */
+    [[nodiscard]] static std::string getKey(const arch::CfdModule<T>& module, T dx, int margin);
+
+    /**
+     * @brief Computes the cache key of a module geometry that is given in memory.
+     * @param[in] content The content that defines the geometry, e.g., an STL file or a binary signature.
+     * @param[in] module The module.
+     * @param[in] dx The grid spacing in _m_.
+     * @param[in] margin The margin around the geometry in grid cells.
+     * @returns The cache key.
+     */
+    [[nodiscard]] static std::string getKey(const std::string& content, const arch::CfdModule<T>& module, T dx, int margin);
+
+    /**
+     * @brief Looks up a geometry, first in memory and then in the cache directory.
+     * @param[in] key The key of the geometry.
+     * @returns The cached geometry, or nullptr if the geometry is not cached or the cache is disabled.
+     */
+    [[nodiscard]] static std::shared_ptr<const CachedGeometry<T>> find(const std::string& key);
+
+    /**
+     * @brief Stores a geometry in memory and, if a cache directory is set, on disk.
+     * @param[in] key The key of the geometry.
+     * @param[in] geometry The voxelized geometry. Nothing is stored for a nullptr.
+     */
+    static void store(const std::string& key, std::shared_ptr<const CachedGeometry<T>> geometry);
+
+    /**
+     * @brief Enables or disables the cache.
+     * @param[in] enabled Whether geometries are looked up and stored.
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether the cache is enabled.
+     * @returns Whether the cache is enabled.
+     */
+    [[nodiscard]] static bool isEnabled();
+
+    /**
+     * @brief Sets the directory in which geometries are cached on disk.
+     * @param[in] directory The cache directory. An empty directory disables the on-disk cache.
+     */
+    static void setDirectory(const std::string& directory);
+
+    /**
+     * @brief Returns the directory in which geometries are cached on disk.
+     * @returns The cache directory.
+     */
+    [[nodiscard]] static std::string getDirectory();
+
+    /**
+     * @brief Removes all geometries from memory. Cache files on disk are kept.
+     */
+    static void clear();
+
+    /**
+     * @brief Returns the number of geometries in memory.
+     * @returns The number of cached geometries.
+     */
+    [[nodiscard]] static size_t size();
+};
+
+}   // namespace sim
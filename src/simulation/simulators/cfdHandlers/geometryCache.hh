@@ -0,0 +1,173 @@
+#include "geometryCache.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace sim {
+
+template<typename T>
+typename GeometryCache<T>::State& GeometryCache<T>::getState() {
+    static State state;
+    return state;
+}
+
+template<typename T>
+std::string GeometryCache<T>::getCacheFile(const std::string& directory, const std::string& key) {
+    return (std::filesystem::path(directory) / (key + ".geometry")).string();
+}
+
+template<typename T>
+std::string GeometryCache<T>::getKey(const arch::CfdModule<T>& module, T dx, int margin) {
+    std::ifstream file(module.getStlFile(), std::ios::binary);
+    if (!file) {
+        return "";
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return getKey(content, module, dx, margin);
+}
+
+template<typename T>
+std::string GeometryCache<T>::getKey(const std::string& content, const arch::CfdModule<T>& module, T dx, int margin) {
+    // FNV-1a hash over the geometry content and all parameters that determine the voxelized geometry
+    uint64_t hash = 14695981039346656037ull;
+    auto hashBytes = [&hash](const char* bytes, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= 1099511628211ull;
+        }
+    };
+    auto hashValue = [&hashBytes](auto value) {
+        hashBytes(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    hashBytes(content.data(), content.size());
+    hashValue(dx);
+    hashValue(margin);
+
+    // Openings in a fixed order, relative to the module position
+    std::vector<size_t> keys;
+    for (auto& [key, opening] : module.getOpenings()) {
+        keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (size_t key : keys) {
+        auto& opening = module.getOpenings().at(key);
+        hashValue(key);
+        hashValue(opening.node->getPosition()[0] - module.getPosition()[0]);
+        hashValue(opening.node->getPosition()[1] - module.getPosition()[1]);
+        hashValue(opening.width);
+        hashValue(opening.radial);
+    }
+
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+template<typename T>
+std::shared_ptr<const CachedGeometry<T>> GeometryCache<T>::find(const std::string& key) {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.enabled || key.empty()) {
+        return nullptr;
+    }
+
+    auto it = state.entries.find(key);
+    if (it != state.entries.end()) {
+        return it->second;
+    }
+
+    if (state.directory.empty()) {
+        return nullptr;
+    }
+    std::ifstream file(getCacheFile(state.directory, key), std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+
+    auto geometry = std::make_shared<CachedGeometry<T>>();
+    try {
+        porting::readBinaryHeader(file, "MMFT-GEOMETRY-CACHE", cacheVersion);
+        porting::readBinary(file, geometry->stlMin);
+        porting::readBinary(file, geometry->origin);
+        porting::readBinary(file, geometry->extend);
+        porting::readBinary(file, geometry->materials);
+    } catch (const std::runtime_error& e) {
+        // A corrupt or outdated cache file is treated as a cache miss and overwritten later
+        MMFT_LOG_WARNING("[GeometryCache] ignore cache file " << getCacheFile(state.directory, key) << ": " << e.what());
+        return nullptr;
+    }
+    state.entries.try_emplace(key, geometry);
+    return geometry;
+}
+
+template<typename T>
+void GeometryCache<T>::store(const std::string& key, std::shared_ptr<const CachedGeometry<T>> geometry) {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.enabled || key.empty() || geometry == nullptr) {
+        return;
+    }
+
+    state.entries.insert_or_assign(key, geometry);
+
+    if (!state.directory.empty()) {
+        std::filesystem::create_directories(state.directory);
+        std::ofstream file(getCacheFile(state.directory, key), std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Could not open geometry cache file " + getCacheFile(state.directory, key) + ".");
+        }
+        porting::writeBinaryHeader(file, "MMFT-GEOMETRY-CACHE", cacheVersion);
+        porting::writeBinary(file, geometry->stlMin);
+        porting::writeBinary(file, geometry->origin);
+        porting::writeBinary(file, geometry->extend);
+        porting::writeBinary(file, geometry->materials);
+    }
+}
+
+template<typename T>
+void GeometryCache<T>::setEnabled(bool enabled) {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.enabled = enabled;
+}
+
+template<typename T>
+bool GeometryCache<T>::isEnabled() {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.enabled;
+}
+
+template<typename T>
+void GeometryCache<T>::setDirectory(const std::string& directory) {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.directory = directory;
+}
+
+template<typename T>
+std::string GeometryCache<T>::getDirectory() {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.directory;
+}
+
+template<typename T>
+void GeometryCache<T>::clear() {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.entries.clear();
+}
+
+template<typename T>
+size_t GeometryCache<T>::size() {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.entries.size();
+}
+
+}   // namespace sim
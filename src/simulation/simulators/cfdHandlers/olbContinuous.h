@@ -6,11 +6,18 @@
 
 #define M_PI 3.14159265358979323846
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <math.h>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
 
 #include <olb2D.h>
 #include <olb2D.hh>
@@ -48,16 +55,118 @@ class HybridContinuous;
 template<typename T>
 class CfdContinuous;
 
+/**
+ * @brief Analytical functor that estimates the flow field in a module from its internal moduleNetwork. The
+ * moduleNetwork connects all openings of the module with Poiseuille channels. Every point of the domain takes
+ * the values of the nearest channel, along which the density is interpolated linearly between the openings and
+ * the velocity is the mean velocity of the channel. All values are in lattice units. The functor is evaluated on
+ * the lattice in LatticePrecision<T>, the channels are stored in precision T.
+*/
+template<typename T>
+class ModuleNetworkEstimate2D final : public olb::AnalyticalF2D<LatticePrecision<T>,LatticePrecision<T>> {
+
+using L = LatticePrecision<T>;
+
+public:
+    /**
+     * @brief A channel of the moduleNetwork in geometry coordinates and lattice units.
+     */
+    struct Segment {
+        T xA, yA;       ///< Position of node A.
+        T xB, yB;       ///< Position of node B.
+        T rhoA, rhoB;   ///< Lattice density at node A and node B.
+        T uX, uY;       ///< Mean lattice velocity along the channel.
+    };
+
+private:
+    std::vector<Segment> segments;  ///< The channels of the moduleNetwork.
+    bool velocity;                  ///< Whether the functor returns the velocity (true) or the density (false).
+
+public:
+    /**
+     * @brief Constructor of the moduleNetwork estimate.
+     * @param[in] segments The channels of the moduleNetwork.
+     * @param[in] velocity Whether the functor returns the velocity (true) or the density (false).
+     */
+    ModuleNetworkEstimate2D(std::vector<Segment> segments, bool velocity);
+
+    /**
+     * @brief Evaluates the estimate at a point of the geometry.
+     * @param[out] output The lattice density, or the two components of the lattice velocity.
+     * @param[in] input The physical coordinates of the point in the geometry.
+     */
+    bool operator() (L output[], const L input[]) override;
+};
+
+/**
+ * @brief Indicator of the channel network of a CfdContinuous simulation, which hands the generated geometry over to
+ * the lbmSimulator in memory instead of through an STL file. Channels are rectangles around their centerline and
+ * junctions are discs at the inner nodes of the network. Dangling nodes have no junction, so that the channels end
+ * flat at the openings. The network is stored in precision T and evaluated at the points of the lattice.
+*/
+template<typename T>
+class NetworkIndicator2D final : public olb::IndicatorF2D<LatticePrecision<T>> {
+
+using L = LatticePrecision<T>;
+
+public:
+    /**
+     * @brief A straight channel between two nodes.
+     */
+    struct Channel {
+        T xA, yA;       ///< Position of node A.
+        T xB, yB;       ///< Position of node B.
+        T halfWidth;    ///< Half of the channel width.
+    };
+
+    /**
+     * @brief A junction at an inner node.
+     */
+    struct Junction {
+        T x, y;         ///< Position of the node.
+        T radius;       ///< Radius of the junction.
+    };
+
+private:
+    std::vector<Channel> channels;      ///< The channels of the network.
+    std::vector<Junction> junctions;    ///< The junctions of the network.
+
+public:
+    /**
+     * @brief Constructor of the network indicator.
+     * @param[in] channels The channels of the network.
+     * @param[in] junctions The junctions at the inner nodes of the network.
+     * @throws invalid_argument if the network geometry is empty.
+     */
+    NetworkIndicator2D(std::vector<Channel> channels, std::vector<Junction> junctions);
+
+    /**
+     * @brief Evaluates whether a point lies inside the channel network.
+     * @param[out] output Whether the point lies inside.
+     * @param[in] input The physical coordinates of the point.
+     */
+    bool operator() (bool output[], const L input[]) override;
+
+    /**
+     * @brief Returns a binary representation of the geometry, which identifies it in the geometry cache.
+     * @returns The signature of the geometry.
+     */
+    [[nodiscard]] std::string getSignature() const;
+};
+
 /**
  * @brief Class that defines the lbm module which is the interface between the 1D solver and OLB.
+ * The lattice, geometry and functors run in LatticePrecision<T>. The parameters and the values at the module nodes,
+ * which are exchanged with the 1D solver, are stored in precision T.
 */
 template<typename T>
 class lbmSimulator : public CFDSimulator<T> {
 
+using L = LatticePrecision<T>;
 using DESCRIPTOR = olb::descriptors::D2Q9<>;
-using NoDynamics = olb::NoDynamics<T,DESCRIPTOR>;
-using BGKdynamics = olb::BGKdynamics<T,DESCRIPTOR>;
-using BounceBack = olb::BounceBack<T,DESCRIPTOR>;
+using NoDynamics = olb::NoDynamics<L,DESCRIPTOR>;
+using BGKdynamics = olb::BGKdynamics<L,DESCRIPTOR>;
+using BounceBack = olb::BounceBack<L,DESCRIPTOR>;
 
 private:
 
@@ -77,19 +186,30 @@ private:
     bool isInitialized = false;             ///< Has lbmInit taken place?
     bool isConverged = false;               ///< Has the module converged?
     
-    std::shared_ptr<olb::STLreader<T>> stlReader;
-    std::shared_ptr<olb::IndicatorF2DfromIndicatorF3D<T>> stl2Dindicator;
-    std::shared_ptr<olb::LoadBalancer<T>> loadBalancer;             ///< Loadbalancer for geometries in multiple cuboids.
-    std::shared_ptr<olb::CuboidGeometry<T,2>> cuboidGeometry;       ///< The geometry in a single cuboid.
-    std::shared_ptr<olb::SuperGeometry<T,2>> geometry;              ///< The final geometry of the channels.
-    std::shared_ptr<olb::SuperLattice<T, DESCRIPTOR>> lattice;      ///< The LBM lattice on the geometry.
+    std::array<T,2> stlMin;                 ///< Lower bound of the STL mesh.
+    std::array<T,2> cuboidOrigin;           ///< Origin of the cuboid geometry.
+    std::array<T,2> cuboidExtend;           ///< Extend of the cuboid geometry.
+    std::shared_ptr<NetworkIndicator2D<T>> networkIndicator;        ///< In-memory geometry, which replaces the STL file if set.
+    std::shared_ptr<olb::STLreader<L>> stlReader;
+    std::shared_ptr<olb::IndicatorF2DfromIndicatorF3D<L>> stl2Dindicator;
+    std::shared_ptr<olb::LoadBalancer<L>> loadBalancer;             ///< Loadbalancer for geometries in multiple cuboids.
+    std::shared_ptr<olb::CuboidGeometry<L,2>> cuboidGeometry;       ///< The geometry in a single cuboid.
+    std::shared_ptr<olb::SuperGeometry<L,2>> geometry;              ///< The final geometry of the channels.
+    std::shared_ptr<olb::SuperLattice<L, DESCRIPTOR>> lattice;      ///< The LBM lattice on the geometry.
     std::unique_ptr<olb::util::ValueTracer<T>> converge;            ///< Value tracer to track convergence.
 
-    std::unordered_map<size_t, std::shared_ptr<olb::Poiseuille2D<T>>> flowProfiles;
-    std::unordered_map<size_t, std::shared_ptr<olb::AnalyticalConst2D<T,T>>> densities;
-    std::shared_ptr<const olb::UnitConverterFromResolutionAndRelaxationTime<T, DESCRIPTOR>> converter;      ///< Object that stores conversion factors from phyical to lattice parameters.
-    std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxVelocity2D<T>>> fluxes;           ///< Map of fluxes at module nodes. 
-    std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>>> meanPressures;    ///< Map of mean pressure values at module nodes.
+    std::unordered_map<size_t, std::shared_ptr<olb::Poiseuille2D<L>>> flowProfiles;
+    std::unordered_map<size_t, std::shared_ptr<olb::AnalyticalConst2D<L,L>>> densities;
+    std::shared_ptr<const olb::UnitConverterFromResolutionAndRelaxationTime<L, DESCRIPTOR>> converter;      ///< Object that stores conversion factors from phyical to lattice parameters.
+    std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxVelocity2D<L>>> fluxes;           ///< Map of fluxes at module nodes. 
+    std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<L>>> meanPressures;    ///< Map of mean pressure values at module nodes.
+
+    static constexpr uint32_t checkpointVersion = 2;    ///< Version of the binary checkpoint format.
+    size_t checkpointInterval = 0;                      ///< Number of iterations between automatic checkpoints. 0 disables automatic checkpoints.
+    int lastCheckpointStep = 0;                         ///< Iteration step at which the last automatic checkpoint was written.
+    std::string restartCheckpoint = "";                 ///< Checkpoint from which the simulator is restored after prepareLattice().
+    std::string warmStartCheckpoint = "";               ///< Checkpoint from which only the lattice populations are loaded after prepareLattice().
+    bool poiseuilleWarmStart = false;                   ///< Initialize the lattice from the moduleNetwork estimate instead of a fluid at rest?
 
     [[nodiscard]] std::string getDefaultName(int id);
 
@@ -123,18 +243,83 @@ protected:
 
     void initNsConvergeTracker();
 
-    virtual void prepareNsLattice(const T omega);
+    virtual void prepareNsLattice(const L omega);
 
     void initPressureIntegralPlane();
 
     void initFlowRateIntegralPlane();
 
-    void initNsLattice(const T omega);
+    void initNsLattice(const L omega);
 
     void setFlowProfile2D(int key, T openingWidth);
 
     void setPressure2D(int key);
 
+    /**
+     * @brief Returns the location of the binary state file of a checkpoint in the output directory.
+     * @param[in] name The name of the checkpoint.
+     * @returns The path to the state file.
+     */
+    [[nodiscard]] std::string getCheckpointFile(const std::string& name) const;
+
+    /**
+     * @brief Write the simulator state (parameters, step, interface values and update scheme) to a binary stream.
+     * @param[in] stream The binary output stream.
+     */
+    virtual void writeCheckpointState(std::ostream& stream) const;
+
+    /**
+     * @brief Read the simulator state from a binary stream and check it against the current simulator parameters.
+     * The simulator is not modified until the returned function is called, so a checkpoint that does not match leaves it untouched.
+     * @param[in] stream The binary input stream.
+     * @returns Function that applies the read state to the simulator.
+     * @throws runtime_error if the checkpoint does not match the simulator.
+     */
+    virtual std::function<void()> readCheckpointState(std::istream& stream);
+
+    /**
+     * @brief Save the populations of the lattice(s) with the OpenLB serializer.
+     * @param[in] name The name of the checkpoint.
+     */
+    virtual void saveLattices(const std::string& name);
+
+    /**
+     * @brief Load the populations of the lattice(s) with the OpenLB serializer.
+     * @param[in] name The name of the checkpoint.
+     * @throws runtime_error if the lattice data could not be loaded.
+     */
+    virtual void loadLattices(const std::string& name);
+
+    /**
+     * @brief Returns whether the checkpoint interval has passed since the last automatic checkpoint.
+     */
+    inline bool isCheckpointDue() const { return checkpointInterval > 0 && step - lastCheckpointStep >= int(checkpointInterval); }
+
+    /**
+     * @brief Writes a checkpoint, if one is due.
+     */
+    void writePeriodicCheckpoint();
+
+    /**
+     * @brief Read the simulation parameters of a checkpoint from a binary stream and check them against those of this simulator.
+     * @param[in] stream The binary input stream.
+     * @throws runtime_error if the parameters of the checkpoint do not match the simulator.
+     */
+    void readCheckpointParameters(std::istream& stream);
+
+    /**
+     * @brief Restores the simulator from the restart checkpoint, if one was set. Otherwise, loads the lattice
+     * populations of the warm start checkpoint, if one was set.
+     */
+    void restoreCheckpoint();
+
+    /**
+     * @brief Returns the channels of the moduleNetwork, with the pressures and flow rates of the last nodal analysis,
+     * in geometry coordinates and lattice units.
+     * @returns The channels of the moduleNetwork.
+     */
+    [[nodiscard]] std::vector<typename ModuleNetworkEstimate2D<T>::Segment> getModuleNetworkSegments();
+
     /**
      * @brief Update the values at the module nodes based on the simulation result after stepIter iterations.
      * @param[in] iT Iteration step.
@@ -228,6 +413,26 @@ protected:
 
     void readGeometryStl(const T dx, const bool print);
 
+    /**
+     * @brief Create the cuboid geometry, load balancer and super geometry from the cuboid origin and extend.
+     * @param[in] dx The grid spacing in _m_.
+     */
+    void initCuboidGeometry(const T dx);
+
+    /**
+     * @brief Create the geometry from a cached geometry instead of reading and voxelizing the STL file.
+     * @param[in] cachedGeometry The cached geometry.
+     * @param[in] dx The grid spacing in _m_.
+     * @throws runtime_error if the cached geometry does not match the cuboid geometry.
+     */
+    void loadGeometry(const CachedGeometry<T>& cachedGeometry, const T dx);
+
+    /**
+     * @brief Copy the voxelized geometry, including the openings, for the geometry cache.
+     * @returns The geometry to be cached, or nullptr if not all cuboids are available on this process.
+     */
+    [[nodiscard]] std::shared_ptr<const CachedGeometry<T>> storeGeometry();
+
     void readOpenings(const T dx);
 
     /**
@@ -337,6 +542,18 @@ public:
     */
     [[nodiscard]] inline int getStepIter() const { return stepIter; }
 
+    /**
+     * @brief Get the number of iterations that this module has performed.
+     * @returns Number of performed iterations.
+    */
+    [[nodiscard]] inline int getIterations() const { return step; }
+
+    /**
+     * @brief Get the number of fluid cells of the lattice, e.g., to compute the throughput in MLUPS.
+     * @returns Number of fluid cells, or 0 if the geometry was not yet prepared.
+    */
+    [[nodiscard]] size_t getFluidCellCount() const;
+
     /**
      * @brief Returns whether the simulator has converged or not.
      * @returns Boolean for simulator convergence.
@@ -365,6 +582,69 @@ public:
     */
     void writeVelocityPpm (T min, T max, int imgResolution) override;
 
+    /**
+     * @brief Write a checkpoint of the simulator state to the output directory. The checkpoint consists of a binary
+     * state file (<name>.mmft) and the lattice populations written by the OpenLB serializer.
+     * @param[in] name The name of the checkpoint.
+     * @throws logic_error if the lattice has not been prepared.
+     */
+    void writeCheckpoint(const std::string& name) override;
+
+    /**
+     * @brief Restore the simulator state from a checkpoint in the output directory.
+     * @param[in] name The name of the checkpoint.
+     * @throws logic_error if the lattice has not been prepared.
+     * @throws runtime_error if the checkpoint cannot be read or does not match the simulator.
+     */
+    void readCheckpoint(const std::string& name) override;
+
+    /**
+     * @brief Set the number of iterations between automatic checkpoints. The automatic checkpoint is named
+     * <simulator name>_checkpoint and is overwritten each time.
+     * @param[in] interval The number of iterations between checkpoints. 0 disables automatic checkpoints.
+     */
+    void setCheckpointInterval(size_t interval) override { checkpointInterval = interval; }
+
+    /**
+     * @brief Get the number of iterations between automatic checkpoints.
+     * @returns The checkpoint interval.
+     */
+    [[nodiscard]] inline size_t getCheckpointInterval() const { return checkpointInterval; }
+
+    /**
+     * @brief Set the checkpoint from which the simulator is restored after the lattice is prepared.
+     * @param[in] name The name of the checkpoint. An empty name disables the restart.
+     */
+    void setRestartCheckpoint(const std::string& name) override { restartCheckpoint = name; }
+
+    /**
+     * @brief Set an in-memory geometry, which is voxelized instead of the STL file of the module.
+     * @param[in] indicator The geometry of the module in network coordinates. A nullptr restores the STL file.
+     */
+    void setNetworkIndicator(std::shared_ptr<NetworkIndicator2D<T>> indicator) { networkIndicator = indicator; }
+
+    /**
+     * @brief Set a checkpoint from which the lattice populations are loaded after the lattice is prepared. In contrast to
+     * a restart, the iteration step, interface values and update scheme are not restored, so that a previous solution
+     * can serve as initial field for a simulation with different boundary conditions.
+     * @param[in] name The name of the checkpoint. An empty name disables the warm start.
+     * @note The checkpoint must stem from a module with the same geometry and simulation parameters.
+     */
+    void setWarmStartCheckpoint(const std::string& name) override { warmStartCheckpoint = name; }
+
+    /**
+     * @brief Set whether the lattice is initialized from an estimate of the flow field, based on the pressures and flow
+     * rates of the Poiseuille channels of the moduleNetwork after the initial nodal analysis, instead of a fluid at rest.
+     * @param[in] warmStart Whether the moduleNetwork estimate is used as initial condition.
+     */
+    void setPoiseuilleWarmStart(bool warmStart) override { poiseuilleWarmStart = warmStart; }
+
+    /**
+     * @brief Returns whether the lattice is initialized from the moduleNetwork estimate.
+     * @returns Whether the Poiseuille warm start is enabled.
+     */
+    [[nodiscard]] inline bool getPoiseuilleWarmStart() const { return poiseuilleWarmStart; }
+
     friend class HybridContinuous<T>;
     friend class CfdContinuous<T>;
     friend class test::definitions::GeometryTest<T>;
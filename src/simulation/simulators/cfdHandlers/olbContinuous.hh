@@ -1,8 +1,119 @@
 #include "olbContinuous.h"
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 namespace sim{
 
+template<typename T>
+ModuleNetworkEstimate2D<T>::ModuleNetworkEstimate2D(std::vector<Segment> segments_, bool velocity_) :
+    olb::AnalyticalF2D<L,L>(velocity_ ? 2 : 1), segments(std::move(segments_)), velocity(velocity_)
+{
+    this->getName() = "ModuleNetworkEstimate2D";
+}
+
+template<typename T>
+bool ModuleNetworkEstimate2D<T>::operator() (L output[], const L input[]) {
+    // Fluid at rest if there is no estimate
+    output[0] = velocity ? L(0) : L(1);
+    if (velocity) {
+        output[1] = L(0);
+    }
+
+    T minDistance = std::numeric_limits<T>::max();
+    for (auto& segment : segments) {
+        // Project the point on the channel
+        T dx = segment.xB - segment.xA;
+        T dy = segment.yB - segment.yA;
+        T length2 = dx*dx + dy*dy;
+        T s = (length2 > 0.0) ? ((input[0] - segment.xA)*dx + (input[1] - segment.yA)*dy) / length2 : T(0);
+        s = std::clamp(s, T(0), T(1));
+        T distX = input[0] - (segment.xA + s*dx);
+        T distY = input[1] - (segment.yA + s*dy);
+        T distance = distX*distX + distY*distY;
+
+        if (distance < minDistance) {
+            minDistance = distance;
+            if (velocity) {
+                output[0] = segment.uX;
+                output[1] = segment.uY;
+            } else {
+                output[0] = segment.rhoA + s*(segment.rhoB - segment.rhoA);
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T>
+NetworkIndicator2D<T>::NetworkIndicator2D(std::vector<Channel> channels_, std::vector<Junction> junctions_) :
+    channels(std::move(channels_)), junctions(std::move(junctions_))
+{
+    if (channels.empty() && junctions.empty()) {
+        throw std::invalid_argument("The network geometry must contain at least one channel or junction.");
+    }
+
+    L inf = std::numeric_limits<L>::max();
+    this->_myMin = olb::Vector<L,2>(inf, inf);
+    this->_myMax = olb::Vector<L,2>(-inf, -inf);
+    auto extend = [this](T x, T y, T r) {
+        this->_myMin[0] = std::min<L>(this->_myMin[0], x - r);
+        this->_myMin[1] = std::min<L>(this->_myMin[1], y - r);
+        this->_myMax[0] = std::max<L>(this->_myMax[0], x + r);
+        this->_myMax[1] = std::max<L>(this->_myMax[1], y + r);
+    };
+    for (auto& channel : channels) {
+        // Corners of the rectangle around the centerline of the channel
+        T length = std::sqrt((channel.xB - channel.xA)*(channel.xB - channel.xA) + (channel.yB - channel.yA)*(channel.yB - channel.yA));
+        T nX = (length > 0.0) ? -(channel.yB - channel.yA) / length * channel.halfWidth : T(0);
+        T nY = (length > 0.0) ? (channel.xB - channel.xA) / length * channel.halfWidth : T(0);
+        extend(channel.xA + nX, channel.yA + nY, 0.0);
+        extend(channel.xA - nX, channel.yA - nY, 0.0);
+        extend(channel.xB + nX, channel.yB + nY, 0.0);
+        extend(channel.xB - nX, channel.yB - nY, 0.0);
+    }
+    for (auto& junction : junctions) {
+        extend(junction.x, junction.y, junction.radius);
+    }
+}
+
+template<typename T>
+bool NetworkIndicator2D<T>::operator() (bool output[], const L input[]) {
+    output[0] = false;
+    for (auto& channel : channels) {
+        T dx = channel.xB - channel.xA;
+        T dy = channel.yB - channel.yA;
+        T length2 = dx*dx + dy*dy;
+        if (length2 <= 0.0) {
+            continue;
+        }
+        // Position along and across the centerline of the channel
+        T along = ((input[0] - channel.xA)*dx + (input[1] - channel.yA)*dy) / length2;
+        T across = std::abs((input[0] - channel.xA)*dy - (input[1] - channel.yA)*dx) / std::sqrt(length2);
+        if (along >= 0.0 && along <= 1.0 && across <= channel.halfWidth) {
+            output[0] = true;
+            return true;
+        }
+    }
+    for (auto& junction : junctions) {
+        T dx = input[0] - junction.x;
+        T dy = input[1] - junction.y;
+        if (dx*dx + dy*dy <= junction.radius*junction.radius) {
+            output[0] = true;
+            return true;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+std::string NetworkIndicator2D<T>::getSignature() const {
+    std::ostringstream stream;
+    porting::writeBinary(stream, channels);
+    porting::writeBinary(stream, junctions);
+    return stream.str();
+}
+
 template<typename T>
 lbmSimulator<T>::lbmSimulator (
     size_t id_, std::string name_, std::shared_ptr<arch::CfdModule<T>> cfdModule_,
@@ -44,9 +155,7 @@ void lbmSimulator<T>::lbmInit (T dynViscosity, T density) {
     initNsConvergeTracker();
     isInitialized = true;
 
-    #ifdef VERBOSE
-        std::cout << "[lbmSimulator] lbmInit " << this->name << "... OK" << std::endl;
-    #endif
+    MMFT_LOG_INFO("[lbmSimulator] lbmInit " << this->name << "... OK");
 }
 
 template<typename T>
@@ -59,35 +168,39 @@ void lbmSimulator<T>::checkInitialized () {
 template<typename T>
 void lbmSimulator<T>::prepareGeometry () {
 
-    bool print = false;
+    bool print = logging::Logger::isEnabled(logging::LogLevel::Debug);
     T dx = getConverter().getConversionFactorLength();
 
-    #ifdef VERBOSE
-        print = true;
-    #endif
 
-    readGeometryStl(dx, print);
-    readOpenings(dx);
+    std::string cacheKey = (networkIndicator != nullptr) ? 
+        GeometryCache<T>::getKey(networkIndicator->getSignature(), *this->cfdModule, dx, stlMargin) :
+        GeometryCache<T>::getKey(*this->cfdModule, dx, stlMargin);
+    auto cachedGeometry = GeometryCache<T>::find(cacheKey);
+    if (cachedGeometry != nullptr) {
+        loadGeometry(*cachedGeometry, dx);
+    } else {
+        readGeometryStl(dx, print);
+        readOpenings(dx);
+        GeometryCache<T>::store(cacheKey, storeGeometry());
+    }
     this->geometry->checkForErrors(print);
 
-    if (print) {
-        std::cout << "[lbmSimulator] prepare geometry " << this->name << "... OK" << std::endl;
-    }
+    MMFT_LOG_DEBUG("[lbmSimulator] prepare geometry " << this->name << "... OK");
 }
 
 template<typename T>
 void lbmSimulator<T>::prepareLattice () {
 
-    const T omega = converter->getLatticeRelaxationFrequency();
+    const L omega = converter->getLatticeRelaxationFrequency();
 
     prepareNsLattice(omega);
     initPressureIntegralPlane();
     initFlowRateIntegralPlane();
     initNsLattice(omega);
 
-    #ifdef VERBOSE
-        std::cout << "[lbmSimulator] prepare lattice " << this->name << "... OK" << std::endl;
-    #endif
+    MMFT_LOG_INFO("[lbmSimulator] prepare lattice " << this->name << "... OK");
+
+    restoreCheckpoint();
 }
 
 template<typename T>
@@ -104,16 +217,14 @@ void lbmSimulator<T>::setBoundaryValues (int iT) {
 
 template<typename T>
 void lbmSimulator<T>::writeVTK (int iT) {
+    result::ScopedTimer timer(result::Phase::WriteVTK);
 
-    bool print = false;
-    #ifdef VERBOSE
-        print = true;
-    #endif
+    bool print = logging::Logger::isEnabled(logging::LogLevel::Debug);
 
-    olb::SuperVTMwriter2D<T> vtmWriter( this->name );
+    olb::SuperVTMwriter2D<L> vtmWriter( this->name );
     // Writes geometry to file system
     if (iT == 0) {
-        olb::SuperLatticeGeometry2D<T,DESCRIPTOR> writeGeometry (getLattice(), getGeometry());
+        olb::SuperLatticeGeometry2D<L,DESCRIPTOR> writeGeometry (getLattice(), getGeometry());
         vtmWriter.write(writeGeometry);
         vtmWriter.createMasterFile();
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + olb::createFileName( this->name ) + ".pvd";
@@ -121,9 +232,9 @@ void lbmSimulator<T>::writeVTK (int iT) {
 
     if (iT % 1000 == 0) {
         
-        olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(getLattice(), getConverter());
-        olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(getLattice(), getConverter());
-        olb::SuperLatticeDensity2D<T,DESCRIPTOR> latDensity(getLattice());
+        olb::SuperLatticePhysVelocity2D<L,DESCRIPTOR> velocity(getLattice(), getConverter());
+        olb::SuperLatticePhysPressure2D<L,DESCRIPTOR> pressure(getLattice(), getConverter());
+        olb::SuperLatticeDensity2D<L,DESCRIPTOR> latDensity(getLattice());
         vtmWriter.addFunctor(velocity);
         vtmWriter.addFunctor(pressure);
         vtmWriter.addFunctor(latDensity);
@@ -134,16 +245,16 @@ void lbmSimulator<T>::writeVTK (int iT) {
         converge->takeValue(getLattice().getStatistics().getAverageEnergy(), print);
     }
     if (iT %1000 == 0) {
-        #ifdef VERBOSE
-            std::cout << "[writeVTK] " << this->name << " currently at timestep " << iT << std::endl;
+        MMFT_LOG_DEBUG("[writeVTK] " << this->name << " currently at timestep " << iT);
+        if (logging::Logger::isEnabled(logging::LogLevel::Debug)) {
             for (auto& [key, Opening] : this->cfdModule->getOpenings()) {
                 if (this->groundNodes.at(key)) {
                     meanPressures.at(key)->print();
                 } else {
                     fluxes.at(key)->print();
                 }
-            } 
-        #endif
+            }
+        }
     }
 
     converge->takeValue(getLattice().getStatistics().getAverageEnergy(), print);
@@ -160,9 +271,9 @@ template<typename T>
 void lbmSimulator<T>::writePressurePpm (T min, T max, int imgResolution) {
     // Color map options are 'earth'|'water'|'air'|'fire'|'leeloo'
     std::string colorMap = "leeloo";
-    olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(getLattice(), getConverter());
-    olb::BlockReduction2D2D<T> planeReductionP(pressure, imgResolution);
-    olb::BlockGifWriter<T> ppmWriter(colorMap);
+    olb::SuperLatticePhysPressure2D<L,DESCRIPTOR> pressure(getLattice(), getConverter());
+    olb::BlockReduction2D2D<L> planeReductionP(pressure, imgResolution);
+    olb::BlockGifWriter<L> ppmWriter(colorMap);
     ppmWriter.write(planeReductionP, min, max, step, this->name+"_pressure_");
 }
 
@@ -170,17 +281,19 @@ template<typename T>
 void lbmSimulator<T>::writeVelocityPpm (T min, T max, int imgResolution) {
     // Color map options are 'earth'|'water'|'air'|'fire'|'leeloo'
     std::string colorMap = "leeloo";
-    olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(getLattice(), getConverter());
-    olb::SuperEuklidNorm2D<T, DESCRIPTOR> normVel( velocity );   
-    olb::BlockReduction2D2D<T> planeReductionVel(normVel, imgResolution);
-    olb::BlockGifWriter<T> ppmWriter(colorMap);
+    olb::SuperLatticePhysVelocity2D<L,DESCRIPTOR> velocity(getLattice(), getConverter());
+    olb::SuperEuklidNorm2D<L, DESCRIPTOR> normVel( velocity );   
+    olb::BlockReduction2D2D<L> planeReductionVel(normVel, imgResolution);
+    olb::BlockGifWriter<L> ppmWriter(colorMap);
     ppmWriter.write(planeReductionVel, min, max, step, this->name+"_velocity_");
 }
 
 template<typename T>
 void lbmSimulator<T>::solve() {
+    result::ScopedTimer timer(result::Phase::LbmSolve);
     checkInitialized();
     int theta = this->updateScheme->getTheta();
+    result::Profiler::count(result::Counter::LbmSteps, theta);
     this->setBoundaryValues(step);
     for (int iT = 0; iT < theta; ++iT){    
         writeVTK(step);       
@@ -188,6 +301,8 @@ void lbmSimulator<T>::solve() {
         step += 1;
     }
     storeCfdResults(step);
+    this->updateScheme->updateTheta(pressures, flowRates);
+    writePeriodicCheckpoint();
 }
 
 template<typename T>
@@ -200,11 +315,239 @@ void lbmSimulator<T>::solveCFD(size_t maxIter) {
         writeVTK(step);       
         lattice->collideAndStream();
         step += 1;
+        writePeriodicCheckpoint();
         // Check convergence
         if (isConverged) { break; }
     }
 }
 
+template<typename T>
+std::string lbmSimulator<T>::getCheckpointFile(const std::string& name) const {
+    return olb::singleton::directories().getLogOutDir() + name + ".mmft";
+}
+
+template<typename T>
+void lbmSimulator<T>::writeCheckpoint(const std::string& name) {
+    checkInitialized();
+    if (lattice == nullptr) {
+        throw std::logic_error("Cannot write checkpoint " + name + ". The lattice of " + this->name + " was not prepared.");
+    }
+
+    if (olb::singleton::mpi().isMainProcessor()) {
+        std::ofstream file(getCheckpointFile(name), std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Could not open checkpoint file " + getCheckpointFile(name) + ".");
+        }
+        porting::writeBinaryHeader(file, "MMFT-LBM-CHECKPOINT", checkpointVersion);
+        writeCheckpointState(file);
+    }
+    saveLattices(name);
+
+    MMFT_LOG_DEBUG("[lbmSimulator] write checkpoint " << name << " of " << this->name << " at step " << step << "... OK");
+}
+
+template<typename T>
+void lbmSimulator<T>::readCheckpoint(const std::string& name) {
+    checkInitialized();
+    if (lattice == nullptr) {
+        throw std::logic_error("Cannot read checkpoint " + name + ". The lattice of " + this->name + " was not prepared.");
+    }
+
+    std::ifstream file(getCheckpointFile(name), std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Could not open checkpoint file " + getCheckpointFile(name) + ".");
+    }
+    porting::readBinaryHeader(file, "MMFT-LBM-CHECKPOINT", checkpointVersion);
+    auto commit = readCheckpointState(file);
+    loadLattices(name);
+    commit();
+    lastCheckpointStep = step;
+
+    MMFT_LOG_DEBUG("[lbmSimulator] read checkpoint " << name << " of " << this->name << " at step " << step << "... OK");
+}
+
+template<typename T>
+void lbmSimulator<T>::writeCheckpointState(std::ostream& stream) const {
+    // Simulation parameters, which determine the lattice and converter
+    porting::writeBinary(stream, static_cast<uint64_t>(resolution));
+    porting::writeBinary(stream, static_cast<uint64_t>(sizeof(L)));
+    porting::writeBinary(stream, relaxationTime);
+    porting::writeBinary(stream, charPhysLength);
+    porting::writeBinary(stream, charPhysVelocity);
+    porting::writeBinary(stream, static_cast<T>(converter->getPhysViscosity()));
+    porting::writeBinary(stream, static_cast<T>(converter->getPhysDensity()));
+
+    // Iteration state and interface values
+    porting::writeBinary(stream, step);
+    porting::writeBinary(stream, isConverged);
+    porting::writeBinary(stream, pressures);
+    porting::writeBinary(stream, flowRates);
+
+    // Update scheme
+    porting::writeBinary(stream, this->updateScheme != nullptr);
+    if (this->updateScheme != nullptr) {
+        porting::writeBinary(stream, this->updateScheme->isAdaptive());
+        this->updateScheme->writeState(stream);
+    }
+}
+
+template<typename T>
+void lbmSimulator<T>::readCheckpointParameters(std::istream& stream) {
+    auto matches = [](T a, T b) { return std::abs(a - b) <= 1e-12 * std::max(std::abs(a), std::abs(b)); };
+
+    uint64_t readResolution = 0;
+    uint64_t readLatticePrecision = 0;
+    T readRelaxationTime, readCharPhysLength, readCharPhysVelocity, readViscosity, readDensity;
+    porting::readBinary(stream, readResolution);
+    porting::readBinary(stream, readLatticePrecision);
+    porting::readBinary(stream, readRelaxationTime);
+    porting::readBinary(stream, readCharPhysLength);
+    porting::readBinary(stream, readCharPhysVelocity);
+    porting::readBinary(stream, readViscosity);
+    porting::readBinary(stream, readDensity);
+    if (readResolution != resolution || readLatticePrecision != sizeof(L) || !matches(readRelaxationTime, relaxationTime) || 
+        !matches(readCharPhysLength, charPhysLength) || !matches(readCharPhysVelocity, charPhysVelocity) ||
+        !matches(readViscosity, converter->getPhysViscosity()) || !matches(readDensity, converter->getPhysDensity())) 
+    {
+        throw std::runtime_error("The checkpoint does not match the simulation parameters of " + this->name + ".");
+    }
+}
+
+template<typename T>
+std::function<void()> lbmSimulator<T>::readCheckpointState(std::istream& stream) {
+    readCheckpointParameters(stream);
+
+    int readStep = 0;
+    bool readIsConverged = false;
+    std::unordered_map<size_t, T> readPressures;
+    std::unordered_map<size_t, T> readFlowRates;
+    porting::readBinary(stream, readStep);
+    porting::readBinary(stream, readIsConverged);
+    porting::readBinary(stream, readPressures);
+    porting::readBinary(stream, readFlowRates);
+    for (auto* values : { &readPressures, &readFlowRates }) {
+        for (auto& [key, value] : *values) {
+            if (pressures.find(key) == pressures.end() || flowRates.find(key) == flowRates.end()) {
+                throw std::runtime_error("The checkpoint contains node " + std::to_string(key) + ", which is not an opening of " + this->name + ".");
+            }
+        }
+    }
+
+    // The scheme state is checked by reading it into the scheme, which is then reset to its previous state until the commit
+    std::string schemeState;
+    bool hasScheme = false;
+    porting::readBinary(stream, hasScheme);
+    if (hasScheme) {
+        bool isAdaptive = false;
+        porting::readBinary(stream, isAdaptive);
+        if (this->updateScheme == nullptr || this->updateScheme->isAdaptive() != isAdaptive) {
+            throw std::runtime_error("The update scheme of the checkpoint does not match the update scheme of " + this->name + ".");
+        }
+        std::stringstream previous;
+        std::stringstream next;
+        this->updateScheme->writeState(previous);
+        try {
+            this->updateScheme->readState(stream);
+            this->updateScheme->writeState(next);
+        } catch (...) {
+            this->updateScheme->readState(previous);
+            throw;
+        }
+        this->updateScheme->readState(previous);
+        schemeState = next.str();
+    }
+
+    return [this, readStep, readIsConverged, readPressures = std::move(readPressures), readFlowRates = std::move(readFlowRates), 
+            hasScheme, schemeState = std::move(schemeState)]() mutable {
+        step = readStep;
+        isConverged = readIsConverged;
+        pressures = std::move(readPressures);
+        flowRates = std::move(readFlowRates);
+        if (hasScheme) {
+            std::stringstream next(schemeState);
+            this->updateScheme->readState(next);
+        }
+    };
+}
+
+template<typename T>
+void lbmSimulator<T>::saveLattices(const std::string& name) {
+    lattice->save(name + "_ns");
+}
+
+template<typename T>
+void lbmSimulator<T>::loadLattices(const std::string& name) {
+    if (!lattice->load(name + "_ns")) {
+        throw std::runtime_error("Could not load the lattice of checkpoint " + name + ".");
+    }
+    lattice->postLoad();
+}
+
+template<typename T>
+void lbmSimulator<T>::writePeriodicCheckpoint() {
+    if (isCheckpointDue()) {
+        writeCheckpoint(this->name + "_checkpoint");
+        lastCheckpointStep = step;
+    }
+}
+
+template<typename T>
+void lbmSimulator<T>::restoreCheckpoint() {
+    if (!restartCheckpoint.empty()) {
+        readCheckpoint(restartCheckpoint);
+    } else if (!warmStartCheckpoint.empty()) {
+        std::ifstream file(getCheckpointFile(warmStartCheckpoint), std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Could not open checkpoint file " + getCheckpointFile(warmStartCheckpoint) + ".");
+        }
+        porting::readBinaryHeader(file, "MMFT-LBM-CHECKPOINT", checkpointVersion);
+        readCheckpointParameters(file);
+        loadLattices(warmStartCheckpoint);
+
+        MMFT_LOG_DEBUG("[lbmSimulator] warm start " << this->name << " from checkpoint " << warmStartCheckpoint << "... OK");
+    }
+}
+
+template<typename T>
+std::vector<typename ModuleNetworkEstimate2D<T>::Segment> lbmSimulator<T>::getModuleNetworkSegments() {
+    // Shift from the network coordinates to the coordinates of the geometry, see readOpenings()
+    auto& min = stlMin;
+    T stlShift[2];
+    stlShift[0] = this->cfdModule->getPosition()[0] - min[0];
+    stlShift[1] = this->cfdModule->getPosition()[1] - min[1];
+
+    std::vector<typename ModuleNetworkEstimate2D<T>::Segment> segments;
+    for (auto& [key, channel] : this->cfdModule->getNetwork()->getChannels()) {
+        auto& openingA = this->cfdModule->getOpenings().at(channel->getNodeAId());
+        auto& openingB = this->cfdModule->getOpenings().at(channel->getNodeBId());
+        T pressureA = openingA.node->getPressure();
+        T pressureB = openingB.node->getPressure();
+
+        typename ModuleNetworkEstimate2D<T>::Segment segment;
+        segment.xA = openingA.node->getPosition()[0] - stlShift[0];
+        segment.yA = openingA.node->getPosition()[1] - stlShift[1];
+        segment.xB = openingB.node->getPosition()[0] - stlShift[0];
+        segment.yB = openingB.node->getPosition()[1] - stlShift[1];
+        segment.rhoA = getConverter().getLatticeDensityFromPhysPressure(L(pressureA));
+        segment.rhoB = getConverter().getLatticeDensityFromPhysPressure(L(pressureB));
+        segment.uX = 0.0;
+        segment.uY = 0.0;
+
+        // Mean velocity of the Poiseuille flow, rescaled from the channel to the cross-section of the openings
+        T length = channel->getLength();
+        T resistance = channel->getResistance();
+        if (length > 0.0 && resistance > 0.0) {
+            T flowRate = (pressureA - pressureB) / resistance;
+            T area = 0.25 * (openingA.width + openingB.width) * (openingA.height + openingB.height);
+            T meanVelocity = getConverter().getLatticeVelocity(L(flowRate / area));
+            segment.uX = meanVelocity * (segment.xB - segment.xA) / length;
+            segment.uY = meanVelocity * (segment.yB - segment.yA) / length;
+        }
+        segments.push_back(segment);
+    }
+    return segments;
+}
+
 template<typename T>
 void lbmSimulator<T>::storePressures(const std::unordered_map<size_t, T>& pressure) { 
     assert(pressure.size() <= this->pressures.size());
@@ -264,18 +607,18 @@ void lbmSimulator<T>::initNsConverter (T dynViscosity, T density) {
     assert(this->moduleOpenings.size() == this->cfdModule->getNodes().size());
     #endif
 
-    this->converter = std::make_shared<const olb::UnitConverterFromResolutionAndRelaxationTime<T,DESCRIPTOR>>(
+    this->converter = std::make_shared<const olb::UnitConverterFromResolutionAndRelaxationTime<L,DESCRIPTOR>>(
         resolution,
-        relaxationTime,
-        charPhysLength,
-        charPhysVelocity,
-        kinViscosity,
-        density
+        L(relaxationTime),
+        L(charPhysLength),
+        L(charPhysVelocity),
+        L(kinViscosity),
+        L(density)
     );
 
-    #ifdef VERBOSE
+    if (logging::Logger::isEnabled(logging::LogLevel::Debug)) {
         this->converter->print();
-    #endif
+    }
     
 }
 
@@ -286,14 +629,14 @@ void lbmSimulator<T>::initNsConvergeTracker () {
 }
 
 template<typename T>
-void lbmSimulator<T>::prepareNsLattice (const T omega) {
+void lbmSimulator<T>::prepareNsLattice (const L omega) {
 
-    lattice = std::make_shared<olb::SuperLattice<T, DESCRIPTOR>>(getGeometry());
+    lattice = std::make_shared<olb::SuperLattice<L, DESCRIPTOR>>(getGeometry());
 
     // Initial conditions
-    std::vector<T> velocity(T(0), T(0));
-    olb::AnalyticalConst2D<T,T> rhoF(1);
-    olb::AnalyticalConst2D<T,T> uF(velocity);
+    std::vector<L> velocity(L(0), L(0));
+    olb::AnalyticalConst2D<L,L> rhoF(1);
+    olb::AnalyticalConst2D<L,L> uF(velocity);
 
     // Set lattice dynamics
     lattice->template defineDynamics<NoDynamics>(getGeometry(), 0);
@@ -301,8 +644,16 @@ void lbmSimulator<T>::prepareNsLattice (const T omega) {
     lattice->template defineDynamics<BounceBack>(getGeometry(), 2);
 
     // Set initial conditions
-    lattice->defineRhoU(getGeometry(), 1, rhoF, uF);
-    lattice->iniEquilibrium(getGeometry(), 1, rhoF, uF);
+    if (poiseuilleWarmStart) {
+        auto segments = getModuleNetworkSegments();
+        ModuleNetworkEstimate2D<T> rhoEstimate(segments, false);
+        ModuleNetworkEstimate2D<T> uEstimate(segments, true);
+        lattice->defineRhoU(getGeometry(), 1, rhoEstimate, uEstimate);
+        lattice->iniEquilibrium(getGeometry(), 1, rhoEstimate, uEstimate);
+    } else {
+        lattice->defineRhoU(getGeometry(), 1, rhoF, uF);
+        lattice->iniEquilibrium(getGeometry(), 1, rhoF, uF);
+    }
 
     // Set lattice dynamics and initial condition for in- and outlets
     for (auto& [key, Opening] : this->cfdModule->getOpenings()) {
@@ -325,20 +676,21 @@ void lbmSimulator<T>::initPressureIntegralPlane() {
             throw std::runtime_error("The number of openings in a module cannot exceed " + std::to_string(std::numeric_limits<int>::max()) + ".");
         }
 
-        auto min = stlReader->getMesh().getMin();
+        auto& min = stlMin;
 
         T posX =  Opening.node->getPosition()[0] - this->cfdModule->getPosition()[0] + min[0];
         T posY =  Opening.node->getPosition()[1] - this->cfdModule->getPosition()[1] + min[1];          
 
-        std::vector<T> position = {posX, posY};
+        std::vector<L> position = {L(posX), L(posY)};
+        std::vector<L> tangent(Opening.tangent.begin(), Opening.tangent.end());
         std::vector<int> materials = {1, int(key)+3};
 
         if (this->groundNodes.at(key)) {
-            std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>> meanPressure;
-            meanPressure = std::make_shared< olb::SuperPlaneIntegralFluxPressure2D<T>> (getLattice(), getConverter(), getGeometry(),
-            position, Opening.tangent, materials);
+            std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<L>> meanPressure;
+            meanPressure = std::make_shared< olb::SuperPlaneIntegralFluxPressure2D<L>> (getLattice(), getConverter(), getGeometry(),
+            position, tangent, materials);
             this->meanPressures.try_emplace(key, meanPressure);
-            flowProfiles.try_emplace(key, std::make_shared<olb::Poiseuille2D<T>>(getGeometry(), 0, (T) 0.0, (T) 0.0));
+            flowProfiles.try_emplace(key, std::make_shared<olb::Poiseuille2D<L>>(getGeometry(), 0, (L) 0.0, (L) 0.0));
         }
     }
 }
@@ -353,27 +705,28 @@ void lbmSimulator<T>::initFlowRateIntegralPlane() {
             throw std::runtime_error("The number of openings in a module cannot exceed " + std::to_string(std::numeric_limits<int>::max()) + ".");
         }
 
-        auto min = stlReader->getMesh().getMin();
+        auto& min = stlMin;
 
         T posX =  Opening.node->getPosition()[0] - this->cfdModule->getPosition()[0] + min[0];
         T posY =  Opening.node->getPosition()[1] - this->cfdModule->getPosition()[1] + min[1];
 
-        std::vector<T> position = {posX, posY};
+        std::vector<L> position = {L(posX), L(posY)};
+        std::vector<L> tangent(Opening.tangent.begin(), Opening.tangent.end());
         std::vector<int> materials = {1, int(key)+3};
 
         if (!this->groundNodes.at(key)) {
-            std::shared_ptr<olb::SuperPlaneIntegralFluxVelocity2D<T>> flux;
-            flux = std::make_shared< olb::SuperPlaneIntegralFluxVelocity2D<T> > (getLattice(), getConverter(), getGeometry(),
-            position, Opening.tangent, materials);
+            std::shared_ptr<olb::SuperPlaneIntegralFluxVelocity2D<L>> flux;
+            flux = std::make_shared< olb::SuperPlaneIntegralFluxVelocity2D<L> > (getLattice(), getConverter(), getGeometry(),
+            position, tangent, materials);
             this->fluxes.try_emplace(key, flux);
-            densities.try_emplace(key, std::make_shared<olb::AnalyticalConst2D<T,T>>((T) 0.0));
+            densities.try_emplace(key, std::make_shared<olb::AnalyticalConst2D<L,L>>((L) 0.0));
         }
     }
 
 }
 
 template<typename T>
-void lbmSimulator<T>::initNsLattice (const T omega) {
+void lbmSimulator<T>::initNsLattice (const L omega) {
     // Initialize lattice with relaxation frequency omega
     lattice->template setParameter<olb::descriptors::OMEGA>(omega);
     lattice->initialize();
@@ -384,10 +737,20 @@ template<typename T>
 void lbmSimulator<T>::readGeometryStl (const T dx, const bool print) {
 
     T correction[2]= {0.0, 0.0};
-
-    stlReader = std::make_shared<olb::STLreader<T>>(this->cfdModule->getStlFile(), dx);
-    auto min = stlReader->getMesh().getMin();
-    auto max = stlReader->getMesh().getMax();
+    std::array<T,2> min;
+    std::array<T,2> max;
+
+    if (networkIndicator != nullptr) {
+        // The in-memory geometry is defined in network coordinates, i.e., without a shift
+        min = {networkIndicator->getMin()[0], networkIndicator->getMin()[1]};
+        max = {networkIndicator->getMax()[0], networkIndicator->getMax()[1]};
+        stlMin = {this->cfdModule->getPosition()[0], this->cfdModule->getPosition()[1]};
+    } else {
+        stlReader = std::make_shared<olb::STLreader<L>>(this->cfdModule->getStlFile(), L(dx));
+        min = {stlReader->getMesh().getMin()[0], stlReader->getMesh().getMin()[1]};
+        max = {stlReader->getMesh().getMax()[0], stlReader->getMesh().getMax()[1]};
+        stlMin = min;
+    }
 
     if (max[0] - min[0] > this->cfdModule->getSize()[0] + 1e-9 ||
         max[1] - min[1] > this->cfdModule->getSize()[1] + 1e-9) 
@@ -411,41 +774,100 @@ void lbmSimulator<T>::readGeometryStl (const T dx, const bool print) {
         }
     }
 
-    if (print) {
-        std::cout << "[lbmSimulator] reading STL file " << this->name << "... OK" << std::endl;
-    }
-        
-    stl2Dindicator = std::make_shared<olb::IndicatorF2DfromIndicatorF3D<T>>(*stlReader);
+    if (networkIndicator == nullptr) {
+        MMFT_LOG_DEBUG("[lbmSimulator] reading STL file " << this->name << "... OK");
+            
+        stl2Dindicator = std::make_shared<olb::IndicatorF2DfromIndicatorF3D<L>>(*stlReader);
 
-    if (print) {
-        std::cout << "[lbmSimulator] create 2D indicator " << this->name << "... OK" << std::endl;
+        MMFT_LOG_DEBUG("[lbmSimulator] create 2D indicator " << this->name << "... OK");
     }
 
-    olb::Vector<T,2> origin(min[0]-stlMargin*dx-correction[0]*dx, min[1]-stlMargin*dx-correction[1]*dx);
-    olb::Vector<T,2> extend(max[0]-min[0]+2*stlMargin*dx+2*correction[0]*dx, max[1]-min[1]+2*stlMargin*dx+2*correction[1]*dx);
-    olb::IndicatorCuboid2D<T> cuboid(extend, origin);
-    cuboidGeometry = std::make_shared<olb::CuboidGeometry2D<T>> (cuboid, dx, 1);
-    loadBalancer = std::make_shared<olb::HeuristicLoadBalancer<T>> (*cuboidGeometry);
-    geometry = std::make_shared<olb::SuperGeometry<T,2>> (*cuboidGeometry, *loadBalancer);
+    cuboidOrigin = {min[0]-stlMargin*dx-correction[0]*dx, min[1]-stlMargin*dx-correction[1]*dx};
+    cuboidExtend = {max[0]-min[0]+2*stlMargin*dx+2*correction[0]*dx, max[1]-min[1]+2*stlMargin*dx+2*correction[1]*dx};
+    initCuboidGeometry(dx);
 
-    if (print) {
-        std::cout << "[lbmSimulator] generate geometry " << this->name << "... OK" << std::endl;   
-    }
+    MMFT_LOG_DEBUG("[lbmSimulator] generate geometry " << this->name << "... OK");
 
     this->geometry->rename(0, 2);
-    this->geometry->rename(2, 1, *stl2Dindicator);
+    if (networkIndicator != nullptr) {
+        this->geometry->rename(2, 1, *networkIndicator);
+    } else {
+        this->geometry->rename(2, 1, *stl2Dindicator);
+    }
     this->geometry->clean(print);
 
-    if (print) {
-        std::cout << "[lbmSimulator] generate 2D geometry from STL  " << this->name << "... OK" << std::endl;
+    MMFT_LOG_DEBUG("[lbmSimulator] generate 2D geometry from STL  " << this->name << "... OK");
+}
+
+template<typename T>
+void lbmSimulator<T>::initCuboidGeometry (const T dx) {
+    olb::Vector<L,2> origin(L(cuboidOrigin[0]), L(cuboidOrigin[1]));
+    olb::Vector<L,2> extend(L(cuboidExtend[0]), L(cuboidExtend[1]));
+    olb::IndicatorCuboid2D<L> cuboid(extend, origin);
+    cuboidGeometry = std::make_shared<olb::CuboidGeometry2D<L>> (cuboid, L(dx), 1);
+    loadBalancer = std::make_shared<olb::HeuristicLoadBalancer<L>> (*cuboidGeometry);
+    geometry = std::make_shared<olb::SuperGeometry<L,2>> (*cuboidGeometry, *loadBalancer);
+}
+
+template<typename T>
+void lbmSimulator<T>::loadGeometry (const CachedGeometry<T>& cachedGeometry, const T dx) {
+    stlMin = cachedGeometry.stlMin;
+    cuboidOrigin = cachedGeometry.origin;
+    cuboidExtend = cachedGeometry.extend;
+    initCuboidGeometry(dx);
+
+    for (int iC = 0; iC < loadBalancer->size(); ++iC) {
+        auto& blockGeometry = geometry->getBlockGeometry(iC);
+        int globC = loadBalancer->glob(iC);
+        if (globC >= int(cachedGeometry.materials.size()) || 
+            cachedGeometry.materials[globC].size() != size_t(blockGeometry.getNx()) * size_t(blockGeometry.getNy())) 
+        {
+            throw std::runtime_error("The cached geometry does not match the cuboid geometry of " + this->name + ".");
+        }
+        auto& materials = cachedGeometry.materials[globC];
+        for (int iX = 0; iX < blockGeometry.getNx(); ++iX) {
+            for (int iY = 0; iY < blockGeometry.getNy(); ++iY) {
+                blockGeometry.set({iX, iY}, materials[iX*blockGeometry.getNy() + iY]);
+            }
+        }
     }
+    geometry->communicate();
+    geometry->getStatisticsStatus() = true;
+    geometry->updateStatistics(false);
+
+    MMFT_LOG_INFO("[lbmSimulator] load cached geometry " << this->name << "... OK");
+}
+
+template<typename T>
+std::shared_ptr<const CachedGeometry<T>> lbmSimulator<T>::storeGeometry () {
+    // Only geometries of which all cuboids are available on this process can be cached
+    if (loadBalancer->size() != cuboidGeometry->getNc()) {
+        return nullptr;
+    }
+
+    auto cachedGeometry = std::make_shared<CachedGeometry<T>>();
+    cachedGeometry->stlMin = stlMin;
+    cachedGeometry->origin = cuboidOrigin;
+    cachedGeometry->extend = cuboidExtend;
+    cachedGeometry->materials.resize(cuboidGeometry->getNc());
+    for (int iC = 0; iC < loadBalancer->size(); ++iC) {
+        auto& blockGeometry = geometry->getBlockGeometry(iC);
+        auto& materials = cachedGeometry->materials[loadBalancer->glob(iC)];
+        materials.reserve(size_t(blockGeometry.getNx()) * size_t(blockGeometry.getNy()));
+        for (int iX = 0; iX < blockGeometry.getNx(); ++iX) {
+            for (int iY = 0; iY < blockGeometry.getNy(); ++iY) {
+                materials.push_back(blockGeometry.get({iX, iY}));
+            }
+        }
+    }
+    return cachedGeometry;
 }
 
 template<typename T>
 void lbmSimulator<T>::readOpenings (const T dx) {
 
     int extendMargin = 4;
-    auto min = stlReader->getMesh().getMin();
+    auto& min = stlMin;
 
     T stlShift[2];
     stlShift[0] = this->cfdModule->getPosition()[0] - min[0];
@@ -460,9 +882,9 @@ void lbmSimulator<T>::readOpenings (const T dx) {
         T x_extend = extendMargin*dx;
         T y_extend = Opening.width;
 
-        olb::Vector<T,2> originO (x_origin, y_origin);
-        olb::Vector<T,2> extendO (x_extend, y_extend);
-        olb::IndicatorCuboid2D<T> opening(extendO, originO, Opening.radial);
+        olb::Vector<L,2> originO (L(x_origin), L(y_origin));
+        olb::Vector<L,2> extendO (L(x_extend), L(y_extend));
+        olb::IndicatorCuboid2D<L> opening(extendO, originO, L(Opening.radial));
         
         this->geometry->rename(2, key+3, opening);
     }
@@ -483,21 +905,21 @@ template<typename T>
 void lbmSimulator<T>::setFlowProfile2D (int openingKey, T openingWidth)  {
     T maxVelocity = (3./2.)*(flowRates[openingKey]/(openingWidth));
     T distance2Wall = getConverter().getConversionFactorLength()/2.;
-    this->flowProfiles.at(openingKey) = std::make_shared<olb::Poiseuille2D<T>>(getGeometry(), openingKey+3, getConverter().getLatticeVelocity(maxVelocity), distance2Wall);
+    this->flowProfiles.at(openingKey) = std::make_shared<olb::Poiseuille2D<L>>(getGeometry(), openingKey+3, getConverter().getLatticeVelocity(L(maxVelocity)), L(distance2Wall));
     getLattice().defineU(getGeometry(), openingKey+3, *this->flowProfiles.at(openingKey));
 }
 
 template<typename T>
 void lbmSimulator<T>::setPressure2D (int openingKey)  {
-    T rhoV = getConverter().getLatticeDensityFromPhysPressure((pressures[openingKey]));
-    this->densities.at(openingKey) = std::make_shared<olb::AnalyticalConst2D<T,T>>(rhoV);
+    L rhoV = getConverter().getLatticeDensityFromPhysPressure(L(pressures[openingKey]));
+    this->densities.at(openingKey) = std::make_shared<olb::AnalyticalConst2D<L,L>>(rhoV);
     getLattice().defineRho(getGeometry(), openingKey+3, *this->densities.at(openingKey));
 }
 
 template<typename T>
 void lbmSimulator<T>::storeCfdResults (int iT) {
     int input[1] = { };
-    T output[10];
+    L output[10];
 
     for (auto& [key, Opening] : this->cfdModule->getOpenings()) {
         if (this->groundNodes.at(key)) {
@@ -513,26 +935,34 @@ void lbmSimulator<T>::storeCfdResults (int iT) {
 
 template<typename T>
 std::tuple<T, T> lbmSimulator<T>::getPressureBounds() {
-    olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(getLattice(), getConverter());
-    olb::SuperMin2D<T> minPressureF( pressure, getGeometry(), 1);
-    olb::SuperMax2D<T> maxPressureF( pressure, getGeometry(), 1);
+    olb::SuperLatticePhysPressure2D<L,DESCRIPTOR> pressure(getLattice(), getConverter());
+    olb::SuperMin2D<L> minPressureF( pressure, getGeometry(), 1);
+    olb::SuperMax2D<L> maxPressureF( pressure, getGeometry(), 1);
     int input[0];
-    T minPressure[1];
-    T maxPressure[1];
+    L minPressure[1];
+    L maxPressure[1];
     minPressureF( minPressure, input );
     maxPressureF( maxPressure, input );
     return std::tuple<T, T> {minPressure[0], maxPressure[0]};
 }
 
+template<typename T>
+size_t lbmSimulator<T>::getFluidCellCount() const {
+    if (geometry == nullptr) {
+        return 0;
+    }
+    return geometry->getStatistics().getNvoxel(1);
+}
+
 template<typename T>
 std::tuple<T, T> lbmSimulator<T>::getVelocityBounds() {
-    olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(getLattice(), getConverter());
-    olb::SuperEuklidNorm2D<T, DESCRIPTOR> normVel( velocity );
-    olb::SuperMin2D<T> minVelF( normVel, getGeometry(), 1);
-    olb::SuperMax2D<T> maxVelF( normVel, getGeometry(), 1);
+    olb::SuperLatticePhysVelocity2D<L,DESCRIPTOR> velocity(getLattice(), getConverter());
+    olb::SuperEuklidNorm2D<L, DESCRIPTOR> normVel( velocity );
+    olb::SuperMin2D<L> minVelF( normVel, getGeometry(), 1);
+    olb::SuperMax2D<L> maxVelF( normVel, getGeometry(), 1);
     int input[0];
-    T minVel[1];
-    T maxVel[1];
+    L minVel[1];
+    L maxVel[1];
     minVelF( minVel, input );
     maxVelF( maxVel, input );
     return std::tuple<T, T> {minVel[0], maxVel[0]};
@@ -6,6 +6,7 @@
 
 #define M_PI 3.14159265358979323846
 
+#include <functional>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -40,15 +41,16 @@ class CfdConcentration;
 template<typename T>
 class lbmMixingSimulator : public lbmSimulator<T> {
 
+using L = LatticePrecision<T>;
 using DESCRIPTOR = olb::descriptors::D2Q9<>;
-using NoDynamics = olb::NoDynamics<T,DESCRIPTOR>;
-using BGKdynamics = olb::BGKdynamics<T,DESCRIPTOR>;
-using BounceBack = olb::BounceBack<T,DESCRIPTOR>;
+using NoDynamics = olb::NoDynamics<L,DESCRIPTOR>;
+using BGKdynamics = olb::BGKdynamics<L,DESCRIPTOR>;
+using BounceBack = olb::BounceBack<L,DESCRIPTOR>;
 
 using ADDESCRIPTOR = olb::descriptors::D2Q5<olb::descriptors::VELOCITY>;        
-using ADDynamics = olb::AdvectionDiffusionBGKdynamics<T,ADDESCRIPTOR>;          ///< Advection diffusion dynamics
-// using ADDynamics = olb::AdvectionDiffusionTRTdynamics<T,ADDESCRIPTOR>;       ///< Optional alternative to advection diffusion dynamics Needs a 'magical number', set to 1/12 in initAdLattice()
-using NoADDynamics = olb::NoDynamics<T,ADDESCRIPTOR>;
+using ADDynamics = olb::AdvectionDiffusionBGKdynamics<L,ADDESCRIPTOR>;          ///< Advection diffusion dynamics
+// using ADDynamics = olb::AdvectionDiffusionTRTdynamics<L,ADDESCRIPTOR>;       ///< Optional alternative to advection diffusion dynamics Needs a 'magical number', set to 1/12 in initAdLattice()
+using NoADDynamics = olb::NoDynamics<L,ADDESCRIPTOR>;
 
 private:
     bool diffusiveBC = false;
@@ -64,15 +66,15 @@ private:
     std::unordered_map<size_t, T> averageDensities;
     std::unordered_map<size_t, bool> custConverges;
 
-    std::unordered_map<size_t, std::shared_ptr<olb::SuperLattice<T, ADDESCRIPTOR>>> adLattices;      ///< The LBM lattice on the geometry.
+    std::unordered_map<size_t, std::shared_ptr<olb::SuperLattice<L, ADDESCRIPTOR>>> adLattices;      ///< The LBM lattice on the geometry.
     std::unordered_map<size_t, std::unique_ptr<olb::util::ValueTracer<T>>> adConverges;            ///< Value tracer to track convergence.
-    std::unordered_map<size_t, std::shared_ptr<const olb::AdeUnitConverterFromResolutionAndRelaxationTime<T, ADDESCRIPTOR>>> adConverters;      ///< Object that stores conversion factors from phyical to lattice parameters.
+    std::unordered_map<size_t, std::shared_ptr<const olb::AdeUnitConverterFromResolutionAndRelaxationTime<L, ADDESCRIPTOR>>> adConverters;      ///< Object that stores conversion factors from phyical to lattice parameters.
 
-    std::unordered_map<size_t, T*> fluxWall;
-    T zeroFlux = 0.0;
+    std::unordered_map<size_t, L*> fluxWall;
+    L zeroFlux = 0.0;
 
-    std::unordered_map<size_t, std::unordered_map<size_t, std::shared_ptr<olb::AnalyticalConst2D<T,T>>>> lbmConcentrationProfiles;
-    std::unordered_map<size_t, std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>>>> meanConcentrations;       ///< Map of mean pressure values at module nodes.
+    std::unordered_map<size_t, std::unordered_map<size_t, std::shared_ptr<olb::AnalyticalConst2D<L,L>>>> lbmConcentrationProfiles;
+    std::unordered_map<size_t, std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<L>>>> meanConcentrations;       ///< Map of mean pressure values at module nodes.
 
     [[nodiscard]] std::string getDefaultName(size_t id);
 
@@ -92,7 +94,7 @@ protected:
 
     void initAdConvergenceTracker();
 
-    void prepareAdLattice(const T omega, size_t speciesId);
+    void prepareAdLattice(const L omega, size_t speciesId);
 
     void initConcentrationIntegralPlane(size_t adKey);
 
@@ -135,6 +137,32 @@ protected:
      */
     void storeConcentrationProfileCfdResults(int iT);
 
+    /**
+     * @brief Write the simulator state, including the advection-diffusion parameters and interface concentrations, to a binary stream.
+     * @param[in] stream The binary output stream.
+     */
+    void writeCheckpointState(std::ostream& stream) const override;
+
+    /**
+     * @brief Read the simulator state from a binary stream and check it against the current simulator parameters.
+     * @param[in] stream The binary input stream.
+     * @throws runtime_error if the checkpoint does not match the simulator.
+     */
+    std::function<void()> readCheckpointState(std::istream& stream) override;
+
+    /**
+     * @brief Save the populations of the NS lattice and all AD lattices with the OpenLB serializer.
+     * @param[in] name The name of the checkpoint.
+     */
+    void saveLattices(const std::string& name) override;
+
+    /**
+     * @brief Load the populations of the NS lattice and all AD lattices with the OpenLB serializer.
+     * @param[in] name The name of the checkpoint.
+     * @throws runtime_error if the lattice data could not be loaded.
+     */
+    void loadLattices(const std::string& name) override;
+
     /**
      * @brief Construct the concentration profile for a given set of concentrations.
      * @param[in] concentrations The concentrations to use for the profile.
@@ -253,7 +281,7 @@ protected:
      * @param[in] adLattice The advection-diffusion lattice.
      * @param[in] key The key for the boundary condition.
      */
-    void constructBCProfiles(size_t speciesId, std::shared_ptr<olb::SuperLattice<T, ADDESCRIPTOR>> adLattice, int key);
+    void constructBCProfiles(size_t speciesId, std::shared_ptr<olb::SuperLattice<L, ADDESCRIPTOR>> adLattice, int key);
 
     /**
      * @brief Store the abstract concentrations at the nodes on the module boundary in the simulator.
@@ -39,9 +39,7 @@ void lbmMixingSimulator<T>::lbmInit (T dynViscosity, T density) {
     initAdConvergenceTracker();
     this->setIsInitialized();
 
-    #ifdef VERBOSE
-        std::cout << "[lbmSimulator] lbmInit " << this->name << "... OK" << std::endl;
-    #endif
+    MMFT_LOG_INFO("[lbmSimulator] lbmInit " << this->name << "... OK");
 }
 
 template<typename T>
@@ -50,14 +48,14 @@ void lbmMixingSimulator<T>::prepareLattice () {
     /**
      * Prepare the NS lattice
     */
-    const T omega = this->getConverter().getLatticeRelaxationFrequency();
+    const L omega = this->getConverter().getLatticeRelaxationFrequency();
     this->prepareNsLattice(omega);
     
     /**
      * Prepare the AD lattices
     */
     for (auto& [speciesId, converter] : adConverges) {
-        const T adOmega = getAdConverter(speciesId).getLatticeRelaxationFrequency();
+        const L adOmega = getAdConverter(speciesId).getLatticeRelaxationFrequency();
         prepareAdLattice(adOmega, speciesId);
     }
     
@@ -78,11 +76,13 @@ void lbmMixingSimulator<T>::prepareLattice () {
         initAdLattice(speciesId);
     }
 
-    std::cout << "[lbmSimulator] prepare lattice " << this->name << "... OK" << std::endl;
+    MMFT_LOG_INFO("[lbmSimulator] prepare lattice " << this->name << "... OK");
 
     prepareCoupling();
 
-    std::cout << "[lbmSimulator] prepare coupling " << this->name << "... OK" << std::endl;
+    MMFT_LOG_INFO("[lbmSimulator] prepare coupling " << this->name << "... OK");
+
+    this->restoreCheckpoint();
 }
 
 template<typename T>
@@ -142,7 +142,7 @@ template<typename T>
 void lbmMixingSimulator<T>::storeConstantConcentrationCfdResults (int iT) {
     // Store the concentration values at the module nodes
     int input[1] = { };
-    T output[10];
+    L output[10];
     
     for (auto& [key, Opening] : this->cfdModule->getOpenings()) {
         // If the node is an outflow, write the concentration value
@@ -236,16 +236,14 @@ std::tuple<std::function<T(T)>, std::vector<T>, T> lbmMixingSimulator<T>::constr
 
 template<typename T>
 void lbmMixingSimulator<T>::writeVTK (int iT) {
+    result::ScopedTimer timer(result::Phase::WriteVTK);
 
-    bool print = false;
-    #ifdef VERBOSE
-        print = true;
-    #endif
+    bool print = logging::Logger::isEnabled(logging::LogLevel::Debug);
 
-    olb::SuperVTMwriter2D<T> vtmWriter( this->name );
+    olb::SuperVTMwriter2D<L> vtmWriter( this->name );
     // Writes geometry to file system
     if (iT == 0) {
-        olb::SuperLatticeGeometry2D<T,DESCRIPTOR> writeGeometry (this->getLattice(), this->getGeometry());
+        olb::SuperLatticeGeometry2D<L,DESCRIPTOR> writeGeometry (this->getLattice(), this->getGeometry());
         vtmWriter.write(writeGeometry);
         vtmWriter.createMasterFile();
         this->vtkFile = olb::singleton::directories().getVtkOutDir() + olb::createFileName( this->name ) + ".pvd";
@@ -253,9 +251,9 @@ void lbmMixingSimulator<T>::writeVTK (int iT) {
 
     if (iT % 1000 == 0) {
 
-        olb::SuperLatticePhysVelocity2D<T,DESCRIPTOR> velocity(this->getLattice(), this->getConverter());
-        olb::SuperLatticePhysPressure2D<T,DESCRIPTOR> pressure(this->getLattice(), this->getConverter());
-        olb::SuperLatticeDensity2D<T,DESCRIPTOR> latDensity(this->getLattice());
+        olb::SuperLatticePhysVelocity2D<L,DESCRIPTOR> velocity(this->getLattice(), this->getConverter());
+        olb::SuperLatticePhysPressure2D<L,DESCRIPTOR> pressure(this->getLattice(), this->getConverter());
+        olb::SuperLatticeDensity2D<L,DESCRIPTOR> latDensity(this->getLattice());
         vtmWriter.addFunctor(velocity);
         vtmWriter.addFunctor(pressure);
         vtmWriter.addFunctor(latDensity);
@@ -264,7 +262,7 @@ void lbmMixingSimulator<T>::writeVTK (int iT) {
 
         // write all concentrations
         for (auto& [speciesId, adLattice] : adLattices) {
-            olb::SuperLatticeDensity2D<T,ADDESCRIPTOR> concentration( getAdLattice(speciesId) );
+            olb::SuperLatticeDensity2D<L,ADDESCRIPTOR> concentration( getAdLattice(speciesId) );
             concentration.getName() = "concentration " + std::to_string(speciesId);
             vtmWriter.write(concentration, iT);
         }
@@ -282,9 +280,7 @@ void lbmMixingSimulator<T>::writeVTK (int iT) {
         }
     }
     if (iT %1000 == 0) {
-        #ifdef VERBOSE
-            std::cout << "[writeVTK] " << this->name << " currently at timestep " << iT << std::endl;
-        #endif
+        MMFT_LOG_DEBUG("[writeVTK] " << this->name << " currently at timestep " << iT);
     }
 
     this->getConverge().takeValue(this->getLattice().getStatistics().getAverageEnergy(), print);
@@ -299,12 +295,12 @@ void lbmMixingSimulator<T>::writeVTK (int iT) {
 
 template<typename T>
 std::tuple<T, T> lbmMixingSimulator<T>::getConcentrationBounds(size_t adKey) {
-    olb::SuperLatticePhysPressure2D<T,ADDESCRIPTOR> pressure(getAdLattice(adKey), getAdConverter(adKey));
-    olb::SuperMin2D<T> minPressureF( pressure, this->getGeometry(), 1);
-    olb::SuperMax2D<T> maxPressureF( pressure, this->getGeometry(), 1);
+    olb::SuperLatticePhysPressure2D<L,ADDESCRIPTOR> pressure(getAdLattice(adKey), getAdConverter(adKey));
+    olb::SuperMin2D<L> minPressureF( pressure, this->getGeometry(), 1);
+    olb::SuperMax2D<L> maxPressureF( pressure, this->getGeometry(), 1);
     int input[0];
-    T minPressure[1];
-    T maxPressure[1];
+    L minPressure[1];
+    L maxPressure[1];
     minPressureF( minPressure, input );
     maxPressureF( maxPressure, input );
     return std::tuple<T, T> {minPressure[0], maxPressure[0]};
@@ -314,14 +310,15 @@ template<typename T>
 void lbmMixingSimulator<T>::writeConcentrationPpm(size_t adKey, T min, T max, int imgResolution) {
     // Color map options are 'earth'|'water'|'air'|'fire'|'leeloo'
     std::string colorMap = "leeloo";
-    olb::SuperLatticePhysPressure2D<T,ADDESCRIPTOR> pressure(getAdLattice(adKey), getAdConverter(adKey));
-    olb::BlockReduction2D2D<T> planeReductionP(pressure, imgResolution);
-    olb::BlockGifWriter<T> ppmWriter(colorMap);
+    olb::SuperLatticePhysPressure2D<L,ADDESCRIPTOR> pressure(getAdLattice(adKey), getAdConverter(adKey));
+    olb::BlockReduction2D2D<L> planeReductionP(pressure, imgResolution);
+    olb::BlockGifWriter<L> ppmWriter(colorMap);
     ppmWriter.write(planeReductionP, min, max, this->getStep(), this->name+"_concentration-"+std::to_string(adKey)+"_");
 }
 
 template<typename T>
 void lbmMixingSimulator<T>::solve() {
+    result::ScopedTimer timer(result::Phase::LbmSolve);
     // this->checkInitialized();
     // int theta = this->updateScheme->getTheta();
     // this->setBoundaryValues(this->getStep());
@@ -340,7 +337,7 @@ void lbmMixingSimulator<T>::solve() {
 
 template<typename T>
 void lbmMixingSimulator<T>::solveCFD(size_t maxIter) {
-    std::cout << "Solving the NS" << std::endl;
+    MMFT_LOG_DEBUG("Solving the NS");
 
     // Check if initialized and set boundary conditions
     this->checkInitialized();
@@ -351,18 +348,19 @@ void lbmMixingSimulator<T>::solveCFD(size_t maxIter) {
         writeVTK(this->getStep());       
         this->getLattice().collideAndStream();
         this->getStep() += 1;
+        this->writePeriodicCheckpoint();
         // Check convergence
         if (this->getIsConverged()) { break; }
     }
 
-    std::cout << "Storing the NS results" << std::endl;
+    MMFT_LOG_DEBUG("Storing the NS results");
     lbmSimulator<T>::storeCfdResults(this->getStep());
 
-    std::cout << "Solving the AD" << std::endl;
+    MMFT_LOG_DEBUG("Solving the AD");
     // Advection Diffusion Solver
-    std::cout << "Setting concentration BC" << std::endl;
+    MMFT_LOG_DEBUG("Setting concentration BC");
     this->setConcBoundaryValues(this->getStep());
-    std::cout << "Starting AD solve loop" << std::endl;
+    MMFT_LOG_DEBUG("Starting AD solve loop");
     for (int iT = 0; iT < int(maxIter); ++iT) {
         writeVTK(this->getStep());
         for (auto& [speciesId, adLattice] : adLattices) {
@@ -371,15 +369,16 @@ void lbmMixingSimulator<T>::solveCFD(size_t maxIter) {
             adConverges.at(speciesId)->takeValue(adLattice->getStatistics().getAverageRho(),true);
         }
         this->getStep() += 1;
+        this->writePeriodicCheckpoint();
     }
-    std::cout << "Finished AD solve loop" << std::endl;
+    MMFT_LOG_DEBUG("Finished AD solve loop");
     storeCfdResults(this->getStep());
 }
 
 template<typename T>
 void lbmMixingSimulator<T>::executeCoupling() {
     this->getLattice().executeCoupling();
-    std::cout << "[lbmSimulator] Execute NS-AD coupling " << this->name << "... OK" << std::endl;
+    MMFT_LOG_INFO("[lbmSimulator] Execute NS-AD coupling " << this->name << "... OK");
 }
 
 
@@ -387,6 +386,7 @@ template<typename T>
 void lbmMixingSimulator<T>::nsSolve() {
     this->checkInitialized();
     int theta = this->updateScheme->getTheta();
+    result::Profiler::count(result::Counter::LbmSteps, theta);
     this->setBoundaryValues(this->getStep());
     for (int iT = 0; iT < theta; ++iT){
         writeVTK(this->getStep());
@@ -394,6 +394,8 @@ void lbmMixingSimulator<T>::nsSolve() {
         this->getStep() += 1;
     }
     storeCfdResults(this->getStep());
+    this->updateScheme->updateTheta(this->getPressures(), this->getFlowRates());
+    this->writePeriodicCheckpoint();
 }
 
 template<typename T>
@@ -408,6 +410,58 @@ void lbmMixingSimulator<T>::adSolve(size_t maxIter) {
         this->getStep() += 1;
     }
     storeCfdResults(this->getStep());
+    this->writePeriodicCheckpoint();
+}
+
+template<typename T>
+void lbmMixingSimulator<T>::writeCheckpointState(std::ostream& stream) const {
+    lbmSimulator<T>::writeCheckpointState(stream);
+    porting::writeBinary(stream, adRelaxationTime);
+    porting::writeBinary(stream, concentrations);
+}
+
+template<typename T>
+std::function<void()> lbmMixingSimulator<T>::readCheckpointState(std::istream& stream) {
+    auto commitBase = lbmSimulator<T>::readCheckpointState(stream);
+
+    T readAdRelaxationTime;
+    std::unordered_map<size_t, std::unordered_map<size_t, T>> readConcentrations;
+    porting::readBinary(stream, readAdRelaxationTime);
+    porting::readBinary(stream, readConcentrations);
+    if (std::abs(readAdRelaxationTime - adRelaxationTime) > 1e-12 * std::abs(adRelaxationTime)) {
+        throw std::runtime_error("The checkpoint does not match the advection-diffusion parameters of " + this->name + ".");
+    }
+    for (auto& [nodeId, nodeConcentrations] : readConcentrations) {
+        for (auto& [speciesId, concentration] : nodeConcentrations) {
+            if (adLattices.find(speciesId) == adLattices.end()) {
+                throw std::runtime_error("The checkpoint contains species " + std::to_string(speciesId) + ", which is not simulated in " + this->name + ".");
+            }
+        }
+    }
+
+    return [this, commitBase = std::move(commitBase), readConcentrations = std::move(readConcentrations)]() mutable {
+        commitBase();
+        concentrations = std::move(readConcentrations);
+    };
+}
+
+template<typename T>
+void lbmMixingSimulator<T>::saveLattices(const std::string& name) {
+    lbmSimulator<T>::saveLattices(name);
+    for (auto& [speciesId, adLattice] : adLattices) {
+        adLattice->save(name + "_ad" + std::to_string(speciesId));
+    }
+}
+
+template<typename T>
+void lbmMixingSimulator<T>::loadLattices(const std::string& name) {
+    lbmSimulator<T>::loadLattices(name);
+    for (auto& [speciesId, adLattice] : adLattices) {
+        if (!adLattice->load(name + "_ad" + std::to_string(speciesId))) {
+            throw std::runtime_error("Could not load the advection-diffusion lattice of species " + std::to_string(speciesId) + " of checkpoint " + name + ".");
+        }
+        adLattice->postLoad();
+    }
 }
 
 template<typename T>
@@ -431,17 +485,17 @@ void lbmMixingSimulator<T>::initValueContainers () {
 template<typename T>
 void lbmMixingSimulator<T>::initAdConverters (T density) {
     for (auto& [speciesId, specie] : species) {
-        std::shared_ptr<const olb::AdeUnitConverterFromResolutionAndRelaxationTime<T,ADDESCRIPTOR>> tempAD = std::make_shared<const olb::AdeUnitConverterFromResolutionAndRelaxationTime<T,ADDESCRIPTOR>> (
+        std::shared_ptr<const olb::AdeUnitConverterFromResolutionAndRelaxationTime<L,ADDESCRIPTOR>> tempAD = std::make_shared<const olb::AdeUnitConverterFromResolutionAndRelaxationTime<L,ADDESCRIPTOR>> (
             this->getResolution(),
-            this->getTau(),
-            this->getCharPhysLength(),
-            this->getCharPhysVelocity(),
-            specie->getDiffusivity(),
+            L(this->getTau()),
+            L(this->getCharPhysLength()),
+            L(this->getCharPhysVelocity()),
+            L(specie->getDiffusivity()),
             this->getConverter().getPhysDensity()
         );
-        #ifdef VERBOSE
+        if (logging::Logger::isEnabled(logging::LogLevel::Debug)) {
             tempAD->print();
-        #endif
+        }
 
         this->adConverters.try_emplace(speciesId, tempAD);
     }
@@ -458,16 +512,16 @@ void lbmMixingSimulator<T>::initAdConvergenceTracker () {
 }
 
 template<typename T>
-void lbmMixingSimulator<T>::prepareAdLattice (const T adOmega, size_t speciesId) {
+void lbmMixingSimulator<T>::prepareAdLattice (const L adOmega, size_t speciesId) {
 
-    std::shared_ptr<olb::SuperLattice<T, ADDESCRIPTOR>> adLattice = std::make_shared<olb::SuperLattice<T,ADDESCRIPTOR>>(this->getGeometry());
+    std::shared_ptr<olb::SuperLattice<L, ADDESCRIPTOR>> adLattice = std::make_shared<olb::SuperLattice<L,ADDESCRIPTOR>>(this->getGeometry());
 
     // Initial conditions
-    std::vector<T> zeroVelocity(T(0), T(0));
-    olb::AnalyticalConst2D<T,T> rhoZero(0.0);
-    olb::AnalyticalConst2D<T,T> rhoF(1.0);
-    olb::AnalyticalConst2D<T,T> rhoBulk(bulkConcentrations.at(speciesId));
-    olb::AnalyticalConst2D<T,T> uZero(zeroVelocity);
+    std::vector<L> zeroVelocity(L(0), L(0));
+    olb::AnalyticalConst2D<L,L> rhoZero(0.0);
+    olb::AnalyticalConst2D<L,L> rhoF(1.0);
+    olb::AnalyticalConst2D<L,L> rhoBulk(bulkConcentrations.at(speciesId));
+    olb::AnalyticalConst2D<L,L> uZero(zeroVelocity);
 
     // Set AD lattice dynamics
     adLattice->template defineDynamics<NoADDynamics>(this->getGeometry(), 0);
@@ -493,7 +547,7 @@ void lbmMixingSimulator<T>::prepareAdLattice (const T adOmega, size_t speciesId)
     }
 
     // Add wall boundary
-    olb::setFunctionalRegularizedHeatFluxBoundary<T,ADDESCRIPTOR>(*adLattice, adOmega, this->getGeometry(), 2, fluxWall.at(0), fluxWall.at(0));
+    olb::setFunctionalRegularizedHeatFluxBoundary<L,ADDESCRIPTOR>(*adLattice, adOmega, this->getGeometry(), 2, fluxWall.at(0), fluxWall.at(0));
 
     adLattices.try_emplace(speciesId, adLattice);
 
@@ -501,7 +555,7 @@ void lbmMixingSimulator<T>::prepareAdLattice (const T adOmega, size_t speciesId)
 
 template<typename T>
 void lbmMixingSimulator<T>::initAdLattice(size_t adKey) {
-    const T adOmega = getAdConverter(adKey).getLatticeRelaxationFrequency();
+    const L adOmega = getAdConverter(adKey).getLatticeRelaxationFrequency();
     getAdLattice(adKey).template setParameter<olb::descriptors::OMEGA>(adOmega);
     // getAdLattice(adKey).template setParameter<olb::collision::TRT::MAGIC>(1./12.);   // For a TRT ADDynamics
     getAdLattice(adKey).initialize();
@@ -516,13 +570,14 @@ void lbmMixingSimulator<T>::initConcentrationIntegralPlane(size_t adKey) {
         T posX =  Opening.node->getPosition()[0] - this->cfdModule->getPosition()[0];
         T posY =  Opening.node->getPosition()[1] - this->cfdModule->getPosition()[1];          
 
-        std::vector<T> position = {posX, posY};
+        std::vector<L> position = {L(posX), L(posY)};
+        std::vector<L> tangent(Opening.tangent.begin(), Opening.tangent.end());
         std::vector<int> materials = {1, int(key)+3};
 
-        std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>>>  meanConcentration;
-        std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<T>> concentration;
-        concentration = std::make_shared<olb::SuperPlaneIntegralFluxPressure2D<T>> (getAdLattice(adKey), getAdConverter(adKey), this->getGeometry(),
-            position, Opening.tangent, materials);
+        std::unordered_map<size_t, std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<L>>>  meanConcentration;
+        std::shared_ptr<olb::SuperPlaneIntegralFluxPressure2D<L>> concentration;
+        concentration = std::make_shared<olb::SuperPlaneIntegralFluxPressure2D<L>> (getAdLattice(adKey), getAdConverter(adKey), this->getGeometry(),
+            position, tangent, materials);
         meanConcentration.try_emplace(adKey, concentration);
         this->meanConcentrations.try_emplace(key, meanConcentration);
     }
@@ -530,14 +585,14 @@ void lbmMixingSimulator<T>::initConcentrationIntegralPlane(size_t adKey) {
 
 template<typename T>
 void lbmMixingSimulator<T>::prepareCoupling() {
-    std::vector<olb::SuperLattice<T,ADDESCRIPTOR>*> adLatticesVec;
-    std::vector<T> velFactors;
+    std::vector<olb::SuperLattice<L,ADDESCRIPTOR>*> adLatticesVec;
+    std::vector<L> velFactors;
     for (auto& [speciesId, adLattice] : adLattices) {
         adLatticesVec.emplace_back(adLattices[speciesId].get());
         //velFactors.emplace_back(this->converter->getConversionFactorVelocity() / this->adConverters[speciesId]->getConversionFactorVelocity());
         velFactors.emplace_back(1.0);
     }
-    olb::NavierStokesAdvectionDiffusionSingleCouplingGenerator2D<T,DESCRIPTOR> coupling(0, this->getConverter().getLatticeLength(this->cfdModule->getSize()[0]), 0, this->getConverter().getLatticeLength(this->cfdModule->getSize()[1]), velFactors);
+    olb::NavierStokesAdvectionDiffusionSingleCouplingGenerator2D<L,DESCRIPTOR> coupling(0, this->getConverter().getLatticeLength(this->cfdModule->getSize()[0]), 0, this->getConverter().getLatticeLength(this->cfdModule->getSize()[1]), velFactors);
     this->getLattice().addLatticeCoupling(coupling, adLatticesVec);
 }
 
@@ -559,15 +614,15 @@ void lbmMixingSimulator<T>::setConcentration2D (int key) {
     // If the boundary is an inflow
     if (this->getFlowDirection(key) > 0.0) {
         for (auto& [speciesId, adLattice] : adLattices) {
-            olb::setAdvectionDiffusionTemperatureBoundary<T,ADDESCRIPTOR>(*adLattice, this->getGeometry(), key+3);
-            olb::AnalyticalConst2D<T,T> inConc(concentrations.at(key).at(speciesId));
+            olb::setAdvectionDiffusionTemperatureBoundary<L,ADDESCRIPTOR>(*adLattice, this->getGeometry(), key+3);
+            olb::AnalyticalConst2D<L,L> inConc(concentrations.at(key).at(speciesId));
             adLattice->defineRho(this->getGeometry(), key+3, inConc);
         }
     }
     // If the boundary is an outflow or there is no flow
     else if (this->getFlowDirection(key) <= 0.0) {
         for (auto& [speciesId, adLattice] : adLattices) {
-            olb::setRegularizedHeatFluxBoundary<T,ADDESCRIPTOR>(*adLattice, getAdConverter(speciesId).getLatticeRelaxationFrequency(), this->getGeometry(), key+3, &zeroFlux);
+            olb::setRegularizedHeatFluxBoundary<L,ADDESCRIPTOR>(*adLattice, getAdConverter(speciesId).getLatticeRelaxationFrequency(), this->getGeometry(), key+3, &zeroFlux);
         }
     }
 }
@@ -578,20 +633,20 @@ void lbmMixingSimulator<T>::setConcentrationProfiles2D (int key) {
     // If the boundary is an inflow
     if (this->getFlowDirection(key) > 0.0) {
         for (auto& [speciesId, adLattice] : adLattices) {
-            olb::setAdvectionDiffusionTemperatureBoundary<T,ADDESCRIPTOR>(*adLattice, this->getGeometry(), key+3);
+            olb::setAdvectionDiffusionTemperatureBoundary<L,ADDESCRIPTOR>(*adLattice, this->getGeometry(), key+3);
             constructBCProfiles(speciesId, adLattice, key);
         }
     }
     // If the boundary is an outflow or there is no flow
     else if (this->getFlowDirection(key) <= 0.0) {
         for (auto& [speciesId, adLattice] : adLattices) {
-            olb::setRegularizedHeatFluxBoundary<T,ADDESCRIPTOR>(*adLattice, getAdConverter(speciesId).getLatticeRelaxationFrequency(), this->getGeometry(), key+3, &zeroFlux);
+            olb::setRegularizedHeatFluxBoundary<L,ADDESCRIPTOR>(*adLattice, getAdConverter(speciesId).getLatticeRelaxationFrequency(), this->getGeometry(), key+3, &zeroFlux);
         }
     }
 }
 
 template<typename T>
-void lbmMixingSimulator<T>::constructBCProfiles(size_t speciesId, std::shared_ptr<olb::SuperLattice<T, ADDESCRIPTOR>> adLattice, int key) {
+void lbmMixingSimulator<T>::constructBCProfiles(size_t speciesId, std::shared_ptr<olb::SuperLattice<L, ADDESCRIPTOR>> adLattice, int key) {
     arch::Opening<T> Opening = this->cfdModule->getOpenings().at(key);
 
     // 1. Obtain all cells with the corresponding material value
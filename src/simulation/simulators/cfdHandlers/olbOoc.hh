@@ -38,29 +38,22 @@ void lbmOocSimulator<T>::lbmInit (T dynViscosity, T density) {
 
     Vmax = (*tissue->getVmax(0))*this->getAdConverter(0).getPhysDeltaT();
 
-    #ifdef VERBOSE
-        std::cout << "[lbmSimulator] lbmInit " << this->name << "... OK" << std::endl;
-    #endif
+    MMFT_LOG_INFO("[lbmSimulator] lbmInit " << this->name << "... OK");
 }
 
 template<typename T>
 void lbmOocSimulator<T>::prepareGeometry () {
 
-    bool print = false;
+    bool print = logging::Logger::isEnabled(logging::LogLevel::Debug);
     T dx = this->getConverter().getConversionFactorLength();
 
-    #ifdef VERBOSE
-        print = true;
-    #endif
 
     this->readGeometryStl(dx, print);
     this->readOpenings(dx);
     readOrganStl(dx);
     this->geometry->clean(print);
     this->geometry->checkForErrors(print);
-    #ifdef VERBOSE
-        std::cout << "[lbmSimulator] prepare geometry " << this->name << "... OK" << std::endl;
-    #endif
+    MMFT_LOG_INFO("[lbmSimulator] prepare geometry " << this->name << "... OK");
 }
 
 template<typename T>
@@ -97,20 +90,17 @@ void lbmOocSimulator<T>::prepareLattice () {
         this->initAdLattice(speciesId);
     }
 
-    std::cout << "[lbmSimulator] prepare lattice " << this->name << "... OK" << std::endl;
+    MMFT_LOG_INFO("[lbmSimulator] prepare lattice " << this->name << "... OK");
 
     this->prepareCoupling();
 
-    std::cout << "[lbmSimulator] prepare coupling " << this->name << "... OK" << std::endl;
+    MMFT_LOG_INFO("[lbmSimulator] prepare coupling " << this->name << "... OK");
 }
 
 template<typename T>
 void lbmOocSimulator<T>::writeVTK (int iT) {
 
-    bool print = false;
-    #ifdef VERBOSE
-        print = true;
-    #endif
+    bool print = logging::Logger::isEnabled(logging::LogLevel::Debug);
 
     olb::SuperVTMwriter2D<T> vtmWriter( this->name );
     // Writes geometry to file system
@@ -144,9 +134,7 @@ void lbmOocSimulator<T>::writeVTK (int iT) {
         this->converge->takeValue(this->getLattice().getStatistics().getAverageEnergy(), print);
     }
     if (iT %1000 == 0) {
-        #ifdef VERBOSE
-            std::cout << "[writeVTK] " << this->name << " currently at timestep " << iT << std::endl;
-        #endif
+        MMFT_LOG_DEBUG("[writeVTK] " << this->name << " currently at timestep " << iT);
     }
 
     this->converge->takeValue(this->getLattice().getStatistics().getAverageEnergy(), print);
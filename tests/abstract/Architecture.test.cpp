@@ -226,4 +226,123 @@ TEST_F(Network, networkArchitectureDefinition) {
     EXPECT_EQ(c3->getNodeAId(), node2->getId());
     EXPECT_EQ(c3->getNodeBId(), node0->getId());
     EXPECT_EQ(c3->getChannelType(), arch::ChannelType::CLOGGABLE);
-}
\ No newline at end of file
+}
+
+TEST_F(Network, bulkNetworkConstruction) {
+    // define network
+    auto network = arch::Network<T>::createNetwork();
+    auto nodeIds = network->addNodes({0.0, 1e-3, 1e-3, 0.0}, {0.0, 0.0, 1e-3, 1e-3}, {true, false, false, false});
+    auto channelIds = network->addRectangularChannels({nodeIds[0], nodeIds[1], nodeIds[2], nodeIds[3]}, 
+                                                      {nodeIds[1], nodeIds[2], nodeIds[3], nodeIds[0]}, 
+                                                      {1e-4, 1e-4, 1e-4, 1e-4}, {2e-4, 2e-4, 2e-4, 2e-4}, 
+                                                      {}, {arch::ChannelType::NORMAL, arch::ChannelType::NORMAL, 
+                                                      arch::ChannelType::BYPASS, arch::ChannelType::NORMAL});
+
+    // reference network built element by element
+    auto reference = arch::Network<T>::createNetwork();
+    auto node0 = reference->addNode(0.0, 0.0, true);
+    auto node1 = reference->addNode(1e-3, 0.0, false);
+    auto node2 = reference->addNode(1e-3, 1e-3, false);
+    auto node3 = reference->addNode(0.0, 1e-3, false);
+    reference->addRectangularChannel(node0->getId(), node1->getId(), 1e-4, 2e-4, arch::ChannelType::NORMAL);
+    reference->addRectangularChannel(node1->getId(), node2->getId(), 1e-4, 2e-4, arch::ChannelType::NORMAL);
+    reference->addRectangularChannel(node2->getId(), node3->getId(), 1e-4, 2e-4, arch::ChannelType::BYPASS);
+    reference->addRectangularChannel(node3->getId(), node0->getId(), 1e-4, 2e-4, arch::ChannelType::NORMAL);
+
+    ASSERT_EQ(nodeIds.size(), reference->getNodes().size());
+    ASSERT_EQ(channelIds.size(), reference->getChannels().size());
+    EXPECT_EQ(network->getGroundNodeIds(), reference->getGroundNodeIds());
+    for (size_t nodeId : nodeIds) {
+        EXPECT_EQ(network->getNode(nodeId)->getPosition(), reference->getNode(nodeId)->getPosition());
+        EXPECT_EQ(network->getChannelsAtNode(nodeId).size(), reference->getChannelsAtNode(nodeId).size());
+    }
+    for (size_t channelId : channelIds) {
+        auto channel = network->getRectangularChannel(channelId);
+        auto expected = reference->getRectangularChannel(channelId);
+        EXPECT_EQ(channel->getNodeAId(), expected->getNodeAId());
+        EXPECT_EQ(channel->getNodeBId(), expected->getNodeBId());
+        EXPECT_EQ(channel->getChannelType(), expected->getChannelType());
+        EXPECT_DOUBLE_EQ(channel->getLength(), expected->getLength());
+        EXPECT_DOUBLE_EQ(channel->getWidth(), expected->getWidth());
+        EXPECT_DOUBLE_EQ(channel->getHeight(), expected->getHeight());
+    }
+
+    // invalid input leaves the network untouched
+    EXPECT_THROW(network->addNodes({0.0, 1.0}, {0.0}), std::invalid_argument);
+    EXPECT_THROW(network->addRectangularChannels({nodeIds[0]}, {42}, {1e-4}, {2e-4}), std::invalid_argument);
+    EXPECT_THROW(network->addRectangularChannels({nodeIds[0]}, {nodeIds[2]}, {1e-4}, {}), std::invalid_argument);
+    EXPECT_EQ(network->getNodes().size(), 4);
+    EXPECT_EQ(network->getChannels().size(), 4);
+}
+
+TEST_F(Network, generatedNetworks) {
+    arch::NetworkGenerator<T> generator(1);
+
+    auto grid = generator.grid(4, 5);
+    EXPECT_EQ(grid.network->getNodes().size(), 20);
+    EXPECT_EQ(grid.network->getChannels().size(), 4*4 + 3*5);
+
+    auto tree = generator.binaryTree(3);
+    EXPECT_EQ(tree.network->getNodes().size(), 3*8 - 2);
+    EXPECT_EQ(tree.network->getChannels().size(), 2*(8 + 4 + 2));
+
+    auto gradient = generator.gradientGenerator(3, 5e-3);
+    EXPECT_EQ(gradient.network->getNodes().size(), 2 + 3 + 4 + 5 + 1);
+    EXPECT_EQ(gradient.network->getChannels().size(), 2*(2 + 3 + 4) + 5);
+    EXPECT_EQ(gradient.pumps.size(), 2);
+
+    auto ladder = generator.serpentineLadder(5, 5e-3);
+    EXPECT_EQ(ladder.network->getNodes().size(), 10);
+    EXPECT_EQ(ladder.network->getChannels().size(), 5 + 2*4);
+    EXPECT_DOUBLE_EQ(ladder.network->getChannel(0)->getLength(), 5e-3);
+
+    auto planar = generator.randomPlanar(6, 6, 0.5);
+    EXPECT_EQ(planar.network->getNodes().size(), 36);
+    EXPECT_GE(planar.network->getChannels().size(), 35);
+    EXPECT_LE(planar.network->getChannels().size(), 2*6*5 + 5*5);
+
+    for (auto* generated : { &grid, &tree, &gradient, &ladder, &planar }) {
+        EXPECT_EQ(generated->network->getGroundNodeIds(), std::set<size_t>({ generated->outlet }));
+        EXPECT_EQ(generated->inletChannels.size(), generated->inlets.size());
+        ASSERT_EQ(generated->pumps.size(), generated->inlets.size());
+
+        // every generated network is valid and can be simulated
+        sim::AbstractContinuous<T> simulation(generated->network);
+        auto fluid = simulation.addFluid(1e-3, 1e3);
+        simulation.setContinuousPhase(fluid->getId());
+        simulation.set1DResistanceModel();
+        EXPECT_NO_THROW(simulation.simulate());
+        for (auto& pump : generated->pumps) {
+            EXPECT_DOUBLE_EQ(pump->getFlowRate(), generator.getFlowRate());
+        }
+    }
+
+    EXPECT_THROW(generator.grid(1, 1), std::invalid_argument);
+    EXPECT_THROW(generator.randomPlanar(4, 4, 1.5), std::invalid_argument);
+}
+
+TEST_F(Network, generatedNetworkSeed) {
+    arch::NetworkGenerator<T> generatorA(42);
+    arch::NetworkGenerator<T> generatorB(42);
+    auto networkA = generatorA.randomPlanar(10, 10, 0.3).network;
+    auto networkB = generatorB.randomPlanar(10, 10, 0.3).network;
+
+    ASSERT_EQ(networkA->getChannels().size(), networkB->getChannels().size());
+    for (size_t nodeId = 0; nodeId < networkA->getNodes().size(); ++nodeId) {
+        EXPECT_EQ(networkA->getNode(nodeId)->getPosition(), networkB->getNode(nodeId)->getPosition());
+    }
+    for (size_t channelId = 0; channelId < networkA->getChannels().size(); ++channelId) {
+        EXPECT_EQ(networkA->getChannel(channelId)->getNodeAId(), networkB->getChannel(channelId)->getNodeAId());
+        EXPECT_EQ(networkA->getChannel(channelId)->getNodeBId(), networkB->getChannel(channelId)->getNodeBId());
+    }
+
+    // The draws only depend on std::mt19937_64, hence, the positions are the same with every standard library
+    EXPECT_DOUBLE_EQ(networkA->getNode(0)->getPosition().at(0), 1.0206221318181558e-4);
+    EXPECT_DOUBLE_EQ(networkA->getNode(0)->getPosition().at(1), 5.5612557541878993e-5);
+    EXPECT_DOUBLE_EQ(networkA->getNode(1)->getPosition().at(0), 1.0085808029921067e-4);
+    EXPECT_DOUBLE_EQ(networkA->getNode(1)->getPosition().at(1), 1e-3 - 1.4549092654702521e-4);
+
+    generatorA.setSeed(7);
+    auto networkC = generatorA.randomPlanar(10, 10, 0.3).network;
+    EXPECT_NE(networkA->getNode(5)->getPosition(), networkC->getNode(5)->getPosition());
+}
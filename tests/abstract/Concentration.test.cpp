@@ -77,6 +77,115 @@ TEST_F(InstantaneousMixing, Case1) {
         0.5*result->getMixtures().at(0)->getSpecieConcentrations().at(0), 1e-7);
 }
 
+TEST_F(InstantaneousMixing, Case1StateTable) {
+    // Define JSON files
+    std::string networkFile = "../examples/Abstract/Concentration/Network1.JSON";
+    std::string simFile = "../examples/Abstract/Concentration/Case1.JSON";
+
+    // Load and set the network from a JSON file
+    auto network = porting::networkFromJSON<T>(networkFile);
+
+    // Load and set the simulations from the JSON files
+    auto sim = porting::simulationFromJSON<T>(simFile, network);
+
+    // simulate
+    sim->simulate();
+
+    // results
+    const std::shared_ptr<result::SimulationResult<T>> result = sim->getResults();
+    auto table = result->getStateTable();
+
+    ASSERT_EQ(table->times.size(), result->getStates().size());
+    ASSERT_EQ(table->nodeIds.size(), network->getNodes().size());
+    ASSERT_TRUE(std::is_sorted(table->nodeIds.begin(), table->nodeIds.end()));
+    ASSERT_TRUE(std::is_sorted(table->edgeIds.begin(), table->edgeIds.end()));
+    ASSERT_EQ(table->pressures.size(), table->times.size() * table->nodeIds.size());
+    ASSERT_EQ(table->flowRates.size(), table->times.size() * table->edgeIds.size());
+
+    for (size_t i = 0; i < table->times.size(); ++i) {
+        auto& state = result->getStates().at(i);
+        EXPECT_EQ(table->times.at(i), state->getTime());
+        for (size_t j = 0; j < table->nodeIds.size(); ++j) {
+            EXPECT_EQ(table->pressures.at(i * table->nodeIds.size() + j), state->getPressures().at(table->nodeIds.at(j)));
+        }
+        for (size_t j = 0; j < table->edgeIds.size(); ++j) {
+            EXPECT_EQ(table->flowRates.at(i * table->edgeIds.size() + j), state->getFlowRates().at(table->edgeIds.at(j)));
+        }
+    }
+
+    // The table is only rebuilt when states were added
+    EXPECT_EQ(result->getStateTable(), table);
+}
+
+TEST_F(InstantaneousMixing, Case1SteadyState) {
+    // Define JSON files
+    std::string networkFile = "../examples/Abstract/Concentration/Network1.JSON";
+    std::string simFile = "../examples/Abstract/Concentration/Case1.JSON";
+
+    // Load and set the network from a JSON file
+    auto network = porting::networkFromJSON<T>(networkFile);
+
+    // Load and set the simulations from the JSON files
+    auto sim = porting::simulationFromJSON<T>(simFile, network);
+    auto* concentrationSim = dynamic_cast<sim::AbstractConcentration<T>*>(sim.get());
+    ASSERT_NE(concentrationSim, nullptr);
+    concentrationSim->setSteadyState(true);
+
+    // simulate
+    sim->simulate();
+
+    // results
+    const std::shared_ptr<result::SimulationResult<T>> result = sim->getResults();
+
+    // A single state with the final mixture distribution of Case 1
+    EXPECT_EQ(result->getStates().size(), 1);
+    EXPECT_EQ(result->getMixtures().size(), 2);
+
+    EXPECT_EQ(result->getStates().at(0)->getMixturePositions().size(), 2);
+    EXPECT_EQ(result->getStates().at(0)->getMixturePositions().at(2).front().mixtureId, 0);
+    EXPECT_NEAR(result->getStates().at(0)->getMixturePositions().at(2).front().position2, 1.0, 1e-12);
+    EXPECT_EQ(result->getStates().at(0)->getMixturePositions().at(4).front().mixtureId, 1);
+    EXPECT_NEAR(result->getStates().at(0)->getMixturePositions().at(4).front().position2, 1.0, 1e-12);
+
+    EXPECT_NEAR(result->getMixtures().at(1)->getSpecieConcentrations().at(0), 
+        0.5*result->getMixtures().at(0)->getSpecieConcentrations().at(0), 1e-7);
+}
+
+TEST_F(InstantaneousMixing, Case1Stepping) {
+    // Define JSON files
+    std::string networkFile = "../examples/Abstract/Concentration/Network1.JSON";
+    std::string simFile = "../examples/Abstract/Concentration/Case1.JSON";
+
+    auto reference = porting::simulationFromJSON<T>(simFile, porting::networkFromJSON<T>(networkFile));
+    reference->simulate();
+    T endTime = reference->getResults()->getStates().back()->getTime();
+
+    // stepping event by event ends in the same state as a single simulate() call
+    auto stepped = porting::simulationFromJSON<T>(simFile, porting::networkFromJSON<T>(networkFile));
+    while (stepped->step()) { }
+    EXPECT_NEAR(stepped->getResults()->getStates().back()->getTime(), endTime, 5e-7);
+    EXPECT_NEAR(stepped->getResults()->getMixtures().at(1)->getSpecieConcentrations().at(0), 
+        reference->getResults()->getMixtures().at(1)->getSpecieConcentrations().at(0), 1e-7);
+
+    /**
+     * Doubling the flow rate of pump 0 at 0.5 s:
+     * Mixture 0 has filled 0.5/0.745356 of channel 2 with the previous flow rate, and fills the remainder at twice 
+     * the speed. Hence, it reaches node 4 at 0.5 + (0.745356 - 0.5)/2 s.
+    */
+    auto network = porting::networkFromJSON<T>(networkFile);
+    auto controlled = porting::simulationFromJSON<T>(simFile, network);
+    EXPECT_TRUE(controlled->advanceTo(0.5));
+    network->getFlowRatePump(0)->setFlowRate(6e-11);
+    while (controlled->step()) { }
+
+    const auto& states = controlled->getResults()->getStates();
+    auto reachesNode4 = std::find_if(states.begin(), states.end(), [](const auto& state) {
+        return state->getMixturePositions().count(4) > 0;
+    });
+    ASSERT_NE(reachesNode4, states.end());
+    EXPECT_NEAR((*reachesNode4)->getTime(), 0.622678, 5e-7);
+}
+
 TEST_F(InstantaneousMixing, Case2) {
     // Define JSON files
     std::string networkFile = "../examples/Abstract/Concentration/Network1.JSON";
@@ -810,6 +919,77 @@ TEST_F(InstantaneousMixing, Case12) {
 
 }
 
+TEST_F(InstantaneousMixing, Case11SteadyStateDilution) {
+    // Define JSON files
+    std::string networkFile = "../examples/Abstract/Concentration/Network6.JSON";
+    std::string simFile = "../examples/Abstract/Concentration/Case11.JSON";
+
+    // Load and set the network from a JSON file
+    auto network = porting::networkFromJSON<T>(networkFile);
+
+    // Load and set the simulations from the JSON files
+    auto sim = porting::simulationFromJSON<T>(simFile, network);
+    auto* concentrationSim = dynamic_cast<sim::AbstractConcentration<T>*>(sim.get());
+    ASSERT_NE(concentrationSim, nullptr);
+    concentrationSim->setSteadyState(true);
+
+    // simulate
+    sim->simulate();
+
+    // results
+    const std::shared_ptr<result::SimulationResult<T>> result = sim->getResults();
+    ASSERT_EQ(result->getStates().size(), 1);
+    auto& positions = result->getStates().at(0)->getMixturePositions();
+
+    /**
+     * Mixture 0 (4.0) in channel 1 meets pure continuous phase from channel 3 at node 4, with equal flow rates.
+     * The outflow of node 4 is diluted to 2.0. Before, mixture 0 passed node 4 undiluted.
+     */
+    ASSERT_EQ(positions.count(4), 1);
+    ASSERT_EQ(positions.count(5), 1);
+    size_t outflowMixture = positions.at(4).front().mixtureId;
+    EXPECT_EQ(positions.at(5).front().mixtureId, outflowMixture);
+    EXPECT_NE(outflowMixture, 0);
+    EXPECT_NEAR(result->getMixtures().at(outflowMixture)->getSpecieConcentrations().at(0), 2.0, 1e-12);
+}
+
+TEST_F(InstantaneousMixing, Case12SteadyStateDuplicateInflows) {
+    // Define JSON files
+    std::string networkFile = "../examples/Abstract/Concentration/Network6.JSON";
+    std::string simFile = "../examples/Abstract/Concentration/Case12.JSON";
+
+    // Load and set the network from a JSON file
+    auto network = porting::networkFromJSON<T>(networkFile);
+
+    // Load and set the simulations from the JSON files
+    auto sim = porting::simulationFromJSON<T>(simFile, network);
+    auto* concentrationSim = dynamic_cast<sim::AbstractConcentration<T>*>(sim.get());
+    ASSERT_NE(concentrationSim, nullptr);
+    concentrationSim->setSteadyState(true);
+
+    // simulate
+    sim->simulate();
+
+    // results
+    const std::shared_ptr<result::SimulationResult<T>> result = sim->getResults();
+    ASSERT_EQ(result->getStates().size(), 1);
+    auto& positions = result->getStates().at(0)->getMixturePositions();
+
+    /**
+     * Mixture 0 (4.0, -) in channel 1 and mixture 1 (2.0, 18.0) in channel 3 meet at node 4, with equal flow rates.
+     * Each inflow is counted once, which gives (3.0, 9.0). Before, the repeated propagation passes appended the
+     * inflows of node 4 a second time and the outflow was over-concentrated to (6.0, 18.0).
+     */
+    ASSERT_EQ(positions.count(4), 1);
+    ASSERT_EQ(positions.count(5), 1);
+    size_t outflowMixture = positions.at(4).front().mixtureId;
+    EXPECT_EQ(positions.at(5).front().mixtureId, outflowMixture);
+    auto& concentrations = result->getMixtures().at(outflowMixture)->getSpecieConcentrations();
+    ASSERT_EQ(concentrations.size(), 2);
+    EXPECT_NEAR(concentrations.at(0), 3.0, 1e-12);
+    EXPECT_NEAR(concentrations.at(1), 9.0, 1e-12);
+}
+
 /** Diffusive mixing based on Case 1 from:
  *
  * Michel Takken, Maria Emmerich, and Robert Wille. "An Abstract Simulator for Species 
@@ -1154,6 +1334,39 @@ TEST_F(DiffusiveMixing, case4) {
 }
 
 
+TEST_F(DiffusiveMixing, case1SteadyState) {
+    // Load and set the network and simulation from a JSON file
+    std::string file = "../examples/Abstract/Concentration/DiffusionCase1.JSON";
+    auto [network, testSimulation] = porting::networkAndSimulationFromJSON<T>(file);
+    auto* concentrationSim = dynamic_cast<sim::AbstractConcentration<T>*>(testSimulation.get());
+    ASSERT_NE(concentrationSim, nullptr);
+    concentrationSim->setSteadyState(true);
+
+    // simulate
+    testSimulation->simulate();
+
+    // results
+    const std::shared_ptr<result::SimulationResult<T>> result = testSimulation->getResults();
+    ASSERT_EQ(result->getStates().size(), 1);
+    auto& positions = result->getStates().at(0)->getMixturePositions();
+
+    // The mixture fills its injection channel and every channel downstream of node 2
+    for (size_t channelId : {1, 2, 3, 4}) {
+        ASSERT_EQ(positions.count(channelId), 1);
+        EXPECT_NEAR(positions.at(channelId).back().position2, 1.0, 1e-12);
+    }
+    EXPECT_EQ(positions.count(0), 0);
+
+    // a_0 is twice the mean concentration. The mixture (1.0) and pure fluid meet at node 2 with equal flow rates,
+    // and the species are conserved when the flow splits again at node 3.
+    auto meanCoefficient = [&](size_t channelId) {
+        size_t mixtureId = positions.at(channelId).back().mixtureId;
+        return std::get<2>(result->getMixtures().at(mixtureId)->getSpecieDistributions().at(0));
+    };
+    EXPECT_NEAR(meanCoefficient(2), 1.0, 1e-9);
+    EXPECT_NEAR(meanCoefficient(3) + meanCoefficient(4), 2.0, 1e-6);
+}
+
 /** 
  * Validation case against experimental results from 
  * Jeon, et. al., “Generation of solution and surface gradients using microfluidic systems,” 
@@ -112,6 +112,35 @@ TEST_F(Continuous, jsonDefinition) {
 
 }
 
+TEST_F(Continuous, jsonDefinitionSinglePass) {
+    std::string file = "../examples/Abstract/Continuous/Network1.JSON";
+
+    // Load and set the network and the simulation from a single parse of the JSON file
+    auto [network, testSimulation] = porting::networkAndSimulationFromJSON<T>(file);
+
+    // Reference network and simulation from separate parses
+    auto refNetwork = porting::networkFromJSON<T>(file);
+    auto refSimulation = porting::simulationFromJSON<T>(file, refNetwork);
+
+    EXPECT_EQ(testSimulation->getNetwork(), network);
+    EXPECT_EQ(network->getNodes().size(), refNetwork->getNodes().size());
+    EXPECT_EQ(network->getChannels().size(), refNetwork->getChannels().size());
+    EXPECT_EQ(network->getPressurePumps().size(), refNetwork->getPressurePumps().size());
+
+    // Perform simulations and compare results
+    testSimulation->simulate();
+    refSimulation->simulate();
+
+    const auto& state = testSimulation->getResults()->getStates().at(0);
+    const auto& refState = refSimulation->getResults()->getStates().at(0);
+    for (auto& [nodeId, pressure] : refState->getPressures()) {
+        EXPECT_DOUBLE_EQ(state->getPressures().at(nodeId), pressure);
+    }
+    for (auto& [channelId, flowRate] : refState->getFlowRates()) {
+        EXPECT_DOUBLE_EQ(state->getFlowRates().at(channelId), flowRate);
+    }
+}
+
 TEST_F(Continuous, triangleNetwork) {
     // define network 1
     auto network1 = arch::Network<T>::createNetwork();
@@ -299,6 +328,185 @@ TEST_F(Continuous, Network2) {
     EXPECT_NEAR(result->getStates().at(0)->getFlowRates().at(13), result->getStates().at(0)->getFlowRates().at(14), 5e-10);
 }
 
+TEST_F(Continuous, sparseNodeIds) {
+    // same network as in allResultValues, but with node ids that are far apart
+    auto network = arch::Network<T>::createNetwork();
+
+    auto node0 = network->addNode(7000, 0.0, 0.0, true);
+    auto node1 = network->addNode(1000, 1e-3, 2e-3, false);
+    auto node2 = network->addNode(2000, 1e-3, 1e-3, false);
+    auto node3 = network->addNode(3000, 1e-3, 0.0, false);
+    auto node4 = network->addNode(4000, 2e-3, 2e-3, false);
+    auto node5 = network->addNode(5000, 2e-3, 1e-3, false);
+    auto node6 = network->addNode(6000, 2e-3, 0.0, false);
+    auto node7 = network->addNode(20, 3e-3, 1e-3, true);
+
+    auto pressure = 1e3;
+    network->addPressurePump(node0->getId(), node1->getId(), pressure);
+    network->addPressurePump(node0->getId(), node2->getId(), pressure);
+    network->addPressurePump(node0->getId(), node3->getId(), pressure);
+
+    auto cWidth = 100e-6;
+    auto cHeight = 100e-6;
+    auto cLength = 1000e-6;
+    network->addRectangularChannel(node1->getId(), node4->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node2->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node3->getId(), node6->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node4->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node6->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node5->getId(), node7->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+
+    // the outdated indices may be requested from several threads at once
+    auto errors = sim::runJobs(8, 4, [&network](size_t) {
+        if (network->getNodeIndex().size() != 8 || network->getEdgeIndex().size() != 9) {
+            throw std::runtime_error("Incomplete network index.");
+        }
+    });
+    for (const auto& error : errors) {
+        EXPECT_EQ(error, nullptr);
+    }
+
+    // the nodes are indexed densely in ascending order of their ids
+    const auto& nodeIndex = network->getNodeIndex();
+    ASSERT_EQ(nodeIndex.size(), 8);
+    EXPECT_EQ(nodeIndex.index(node7->getId()), 0);
+    EXPECT_EQ(nodeIndex.index(node0->getId()), 7);
+    EXPECT_EQ(nodeIndex.id(1), node1->getId());
+    EXPECT_FALSE(nodeIndex.contains(0));
+    EXPECT_EQ(network->getEdgeIndex().size(), 9);
+
+    sim::AbstractContinuous<T> testSimulation(network);
+    auto fluid0 = testSimulation.addFluid(1e-3, 997.0);
+    testSimulation.setContinuousPhase(fluid0->getId());
+    testSimulation.set1DResistanceModel();
+    testSimulation.simulate();
+
+    const auto& pressures = testSimulation.getResults()->getStates().at(0)->getPressures();
+    EXPECT_NEAR(pressures.at(node0->getId()), 0.0, 5e-7);
+    EXPECT_NEAR(pressures.at(node1->getId()), 1000.000000, 5e-7);
+    EXPECT_NEAR(pressures.at(node2->getId()), 1000.000000, 5e-7);
+    EXPECT_NEAR(pressures.at(node3->getId()), 1000.000000, 5e-7);
+    EXPECT_NEAR(pressures.at(node4->getId()), 833.333333, 5e-7);
+    EXPECT_NEAR(pressures.at(node5->getId()), 666.666667, 5e-7);
+    EXPECT_NEAR(pressures.at(node6->getId()), 833.333333, 5e-7);
+    EXPECT_NEAR(pressures.at(node7->getId()), 0.0, 5e-7);
+}
+
+TEST_F(Continuous, batch) {
+    std::istringstream manifest(
+        "# input output\n"
+        "../examples/Abstract/Continuous/Network1.JSON batch_Network1.bin\n"
+        "\n"
+        "../examples/Abstract/Continuous/Network2.JSON   batch_Network2.bin\n"
+        "../examples/Abstract/Continuous/Missing.JSON batch_Missing.bin\n");
+    auto jobs = porting::readManifest(manifest);
+    ASSERT_EQ(jobs.size(), 3);
+    EXPECT_EQ(jobs[1].input, "../examples/Abstract/Continuous/Network2.JSON");
+    EXPECT_EQ(jobs[1].output, "batch_Network2.bin");
+
+    porting::BatchOptions options;
+    options.threads = 2;
+    options.pinning = sim::Pinning::Compact;
+    options.format = porting::ResultFormat::Binary;
+    auto reports = porting::runBatch<T>(jobs, options);
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_TRUE(reports[0].success);
+    EXPECT_TRUE(reports[1].success);
+    EXPECT_FALSE(reports[2].success);
+    EXPECT_FALSE(reports[2].error.empty());
+
+    // the written results equal those of a separate simulation
+    for (size_t i = 0; i < 2; ++i) {
+        auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(jobs[i].input);
+        simulation->simulate();
+        auto expected = simulation->getResults()->getStateTable();
+        std::ifstream file(jobs[i].output, std::ios::binary);
+        auto table = porting::resultFromBinary<T>(file);
+        EXPECT_EQ(table.times, expected->times);
+        EXPECT_EQ(table.nodeIds, expected->nodeIds);
+        EXPECT_EQ(table.edgeIds, expected->edgeIds);
+        ASSERT_EQ(table.pressures.size(), expected->pressures.size());
+        for (size_t j = 0; j < table.pressures.size(); ++j) {
+            EXPECT_NEAR(table.pressures[j], expected->pressures[j], 1e-9 * std::abs(expected->pressures[j]) + 1e-12);
+        }
+        ASSERT_EQ(table.flowRates.size(), expected->flowRates.size());
+        for (size_t j = 0; j < table.flowRates.size(); ++j) {
+            EXPECT_NEAR(table.flowRates[j], expected->flowRates[j], 1e-9 * std::abs(expected->flowRates[j]) + 1e-24);
+        }
+        std::remove(jobs[i].output.c_str());
+    }
+
+    std::ostringstream report;
+    porting::writeBatchReport(report, reports);
+    EXPECT_NE(report.str().find("failed"), std::string::npos);
+
+    std::istringstream invalid("input.JSON\n");
+    EXPECT_THROW(porting::readManifest(invalid), std::invalid_argument);
+}
+
+TEST_F(Continuous, batchJSON) {
+    std::istringstream manifest(
+        "../examples/Abstract/Continuous/Network1.JSON batch_Network1.JSON\n"
+        "../examples/Abstract/Continuous/Network2.JSON batch_Network2.JSON\n"
+        "../examples/Abstract/Concentration/Network1.JSON batch_Concentration1.JSON\n"
+        "../examples/Abstract/Droplet/dropletAbstract.JSON batch_Droplet.JSON\n");
+    auto jobs = porting::readManifest(manifest);
+    ASSERT_EQ(jobs.size(), 4);
+
+    porting::BatchOptions options;
+    options.threads = 3;
+    options.format = porting::ResultFormat::JSON;
+    auto reports = porting::runBatch<T>(jobs, options);
+    ASSERT_EQ(reports.size(), 4);
+
+    // the written results equal those of a separate simulation, including droplet and mixture positions
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        EXPECT_TRUE(reports[i].success) << reports[i].error;
+        auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(jobs[i].input);
+        simulation->simulate();
+        std::ifstream file(jobs[i].output);
+        std::stringstream written;
+        written << file.rdbuf();
+        EXPECT_EQ(written.str(), porting::resultToJSON<T>(simulation.get()).dump(4) + "\n");
+        std::remove(jobs[i].output.c_str());
+    }
+
+    // the binary format only holds pressures and flow rates, droplet simulations are rejected
+    options.format = porting::ResultFormat::Binary;
+    std::vector<porting::BatchJob> binaryJobs { { jobs[3].input, "batch_Droplet.bin" } };
+    auto binaryReports = porting::runBatch<T>(binaryJobs, options);
+    ASSERT_EQ(binaryReports.size(), 1);
+    EXPECT_FALSE(binaryReports[0].success);
+    EXPECT_NE(binaryReports[0].error.find("continuous"), std::string::npos);
+    EXPECT_FALSE(std::ifstream(binaryJobs[0].output).good());
+
+    auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(jobs[3].input);
+    std::ostringstream binary;
+    EXPECT_THROW(porting::resultToBinary<T>(binary, simulation.get()), std::invalid_argument);
+}
+
+TEST_F(Continuous, batchManifestFile) {
+    auto directory = std::filesystem::temp_directory_path() / "mmft_batch_manifest";
+    std::filesystem::create_directories(directory);
+    std::filesystem::copy_file("../examples/Abstract/Continuous/Network1.JSON", directory / "Network1.JSON",
+        std::filesystem::copy_options::overwrite_existing);
+    std::ofstream(directory / "manifest.txt") << "Network1.JSON results/Network1.bin\n";
+
+    // relative locations are relative to the manifest, not to the working directory
+    auto jobs = porting::readManifest((directory / "manifest.txt").string());
+    ASSERT_EQ(jobs.size(), 1);
+    EXPECT_EQ(std::filesystem::path(jobs[0].input), directory / "Network1.JSON");
+    EXPECT_EQ(std::filesystem::path(jobs[0].output), directory / "results" / "Network1.bin");
+
+    std::filesystem::create_directories(directory / "results");
+    auto reports = porting::runBatch<T>(jobs, porting::BatchOptions());
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_TRUE(reports[0].success) << reports[0].error;
+    EXPECT_TRUE(std::filesystem::exists(directory / "results" / "Network1.bin"));
+
+    std::filesystem::remove_all(directory);
+}
+
 /**
  * Test ideas:
  * 
@@ -315,4 +523,4 @@ TEST_F(Continuous, Network2) {
  * 
  * Play with different orders of simulation definition: E.g., define resistance model before adding first fluid
  * Does the resistance model update with new continuous phase?
- */
\ No newline at end of file
+ */
@@ -7,7 +7,7 @@
 
 using T = double;
 
-class Droplet : public test::definitions::GlobalTest<T> { };
+class Droplet : public test::definitions::GridDropletTest<T> { };
 
 TEST_F(Droplet, allResultValues) {
 
@@ -1413,6 +1413,133 @@ TEST_F(Droplet, RingNetworkE2) {
   // check_path(droplet4Path, expectedDropletHeaderPath);
 }
 
+TEST_F(Droplet, sampling) {
+    const T writeInterval = 0.01;
+
+    auto runSimulation = [this, writeInterval](bool sampling, T tMax) {
+        return runGridSimulation([&](sim::AbstractDroplet<T>& simulation) {
+            simulation.setSampling(sampling);
+            simulation.setWriteInterval(writeInterval);
+            simulation.setMaxEndTime(tMax);
+        }).simulation->getResults();
+    };
+
+    auto reference = runSimulation(false, 100.0);
+    auto sampled = runSimulation(true, 100.0);
+    const auto& referenceStates = reference->getStates();
+    const auto& sampledStates = sampled->getStates();
+    T endTime = referenceStates.back()->getTime();
+
+    // one state per write interval, plus the final state
+    ASSERT_GT(sampledStates.size(), 1);
+    EXPECT_LE(sampledStates.size(), size_t(endTime / writeInterval) + 2);
+    EXPECT_LT(sampledStates.size(), referenceStates.size());
+    EXPECT_DOUBLE_EQ(sampledStates.back()->getTime(), endTime);
+
+    for (size_t i = 0; i + 1 < sampledStates.size(); ++i) {
+        T sampleTime = sampledStates[i]->getTime();
+        EXPECT_NEAR(sampleTime, i * writeInterval, 1e-12);
+
+        // pressures are constant between two events
+        auto state = std::find_if(referenceStates.rbegin(), referenceStates.rend(), [sampleTime](const auto& referenceState) {
+            return referenceState->getTime() <= sampleTime;
+        });
+        ASSERT_NE(state, referenceStates.rend());
+        for (auto& [nodeId, pressure] : (*state)->getPressures()) {
+            EXPECT_NEAR(sampledStates[i]->getPressures().at(nodeId), pressure, 1e-9 * std::abs(pressure) + 1e-12);
+        }
+    }
+
+    // the simulation ends at the maximal end time
+    auto truncated = runSimulation(true, 5 * writeInterval);
+    EXPECT_EQ(truncated->getStates().size(), 6);
+    EXPECT_NEAR(truncated->getStates().back()->getTime(), 5 * writeInterval, 1e-12);
+}
+
+TEST_F(Droplet, coalescedEvents) {
+    auto runSimulation = [](bool coalescing) {
+        // two symmetric branches, so that the droplets in both branches reach the nodes at the same time
+        auto network = arch::Network<T>::createNetwork();
+        auto node0 = network->addNode(0.0, 0.0, false);
+        auto node1 = network->addNode(1e-3, 0.0, false);
+        auto node2 = network->addNode(2e-3, 1e-3, false);
+        auto node3 = network->addNode(2e-3, -1e-3, false);
+        auto node4 = network->addNode(3e-3, 1e-3, false);
+        auto node5 = network->addNode(3e-3, -1e-3, false);
+        network->addFlowRatePump(node0->getId(), node1->getId(), 6e-11);
+        auto cWidth = 100e-6;
+        auto cHeight = 30e-6;
+        auto c1 = network->addRectangularChannel(node1->getId(), node2->getId(), cHeight, cWidth, 1000e-6, arch::ChannelType::NORMAL);
+        auto c2 = network->addRectangularChannel(node1->getId(), node3->getId(), cHeight, cWidth, 1000e-6, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node2->getId(), node4->getId(), cHeight, cWidth, 1000e-6, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node3->getId(), node5->getId(), cHeight, cWidth, 1000e-6, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node4->getId(), node0->getId(), cHeight, cWidth, 1000e-6, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node5->getId(), node0->getId(), cHeight, cWidth, 1000e-6, arch::ChannelType::NORMAL);
+        network->setSink(node0->getId());
+        network->setGround(node0->getId());
+
+        sim::AbstractDroplet<T> testSimulation(network);
+        auto fluid0 = testSimulation.addFluid(1e-3, 1e3);
+        auto fluid1 = testSimulation.addFluid(3e-3, 1e3);
+        testSimulation.setContinuousPhase(fluid0->getId());
+        auto droplet0 = testSimulation.addDroplet(fluid1->getId(), 1.5 * cWidth * cWidth * cHeight);
+        auto droplet1 = testSimulation.addDroplet(fluid1->getId(), 1.5 * cWidth * cWidth * cHeight);
+        testSimulation.addDropletInjection(droplet0->getId(), 0.0, c1->getId(), 0.5);
+        testSimulation.addDropletInjection(droplet1->getId(), 0.0, c2->getId(), 0.5);
+        testSimulation.set1DResistanceModel();
+        testSimulation.setProfiling(true);
+        testSimulation.setCoalescing(coalescing);
+        testSimulation.simulate();
+        return testSimulation.getResults();
+    };
+
+    auto sequential = runSimulation(false);
+    auto coalesced = runSimulation(true);
+
+    // the simultaneous injections (and boundary events) are performed in fewer iterations, with fewer nodal analyses
+    auto sequentialSolves = sequential->getProfile()->getPhase(result::Phase::NodalAnalysis).calls;
+    auto coalescedSolves = coalesced->getProfile()->getPhase(result::Phase::NodalAnalysis).calls;
+    EXPECT_LT(coalescedSolves, sequentialSolves);
+    EXPECT_LT(coalesced->getStates().size(), sequential->getStates().size());
+    EXPECT_EQ(coalesced->getProfile()->getPhase(result::Phase::PerformEvent).calls, sequential->getProfile()->getPhase(result::Phase::PerformEvent).calls);
+
+    // both modes end in the same state
+    T endTime = sequential->getStates().back()->getTime();
+    EXPECT_NEAR(coalesced->getStates().back()->getTime(), endTime, 1e-9 * endTime);
+}
+
+TEST_F(Droplet, stepping) {
+    auto reference = createGridSimulation();
+    reference.simulation->simulate();
+    T endTime = reference.simulation->getResults()->getStates().back()->getTime();
+    ASSERT_GT(endTime, 0.05);
+
+    // advancing in intervals and stepping event by event ends in the same state as a single simulate() call
+    auto stepped = createGridSimulation();
+    stepped.simulation->start();
+    EXPECT_TRUE(stepped.simulation->advanceTo(0.05));
+    EXPECT_FALSE(stepped.simulation->isFinished());
+    for (auto& state : stepped.simulation->getResults()->getStates()) {
+        EXPECT_LE(state->getTime(), 0.05);
+    }
+    EXPECT_TRUE(stepped.simulation->advanceTo(0.5 * endTime));
+    size_t steps = 0;
+    while (stepped.simulation->step()) {
+        ++steps;
+    }
+    EXPECT_GT(steps, 0);
+    EXPECT_TRUE(stepped.simulation->isFinished());
+    EXPECT_FALSE(stepped.simulation->step());
+    EXPECT_NEAR(stepped.simulation->getResults()->getStates().back()->getTime(), endTime, 1e-9 * endTime);
+
+    // a pump change between two steps is taken into account by the next step
+    auto controlled = createGridSimulation();
+    controlled.simulation->advanceTo(0.05);
+    controlled.generated.pumps.front()->setFlowRate(6e-11);
+    while (controlled.simulation->step(10)) { }
+    EXPECT_LT(controlled.simulation->getResults()->getStates().back()->getTime(), endTime);
+}
+
 /**
  * Test ideas:
  * 
@@ -1423,4 +1550,4 @@ TEST_F(Droplet, RingNetworkE2) {
  * Does a simulation still work after the droplets are removed?
  * 
  * I can still adapt a removed droplet, but doesn't affect simulation result. Same goes with injection.
- */
\ No newline at end of file
+ */
@@ -0,0 +1,49 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include "../test_definitions.h"
+
+using T = double;
+
+class Logger : public test::definitions::GlobalTest<T> { };
+
+TEST_F(Logger, levelsRateLimitsAndAsynchronousSink) {
+    std::vector<std::pair<logging::LogLevel, std::string>> messages;
+    logging::LogLevel level = logging::Logger::getLevel();
+    logging::Logger::setSink([&messages](logging::LogLevel messageLevel, const std::string& message) {
+        messages.emplace_back(messageLevel, message);
+    });
+
+    // messages below the log level are discarded
+    logging::Logger::setLevel(logging::LogLevel::Warning);
+    MMFT_LOG_INFO("discarded " << 1);
+    MMFT_LOG_WARNING("logged " << 2);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages.front().first, logging::LogLevel::Warning);
+    EXPECT_EQ(messages.front().second, "logged 2");
+
+    // rate-limited messages are logged at most once per interval
+    messages.clear();
+    logging::Logger::setLevel(logging::LogLevel::Debug);
+    logging::RateLimiter limiter;
+    for (int i = 0; i < 100; ++i) {
+        MMFT_LOG_RATE_LIMITED(limiter, logging::LogLevel::Debug, "iteration " << i);
+    }
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages.front().second, "iteration 0");
+
+    // asynchronous messages are written in order once the log is flushed
+    messages.clear();
+    logging::Logger::setAsynchronous(true);
+    for (int i = 0; i < 100; ++i) {
+        MMFT_LOG_DEBUG("message " << i);
+    }
+    logging::Logger::flush();
+    logging::Logger::setAsynchronous(false);
+    ASSERT_EQ(messages.size(), 100);
+    EXPECT_EQ(messages.back().second, "message 99");
+
+    logging::Logger::setSink(nullptr);
+    logging::Logger::setLevel(level);
+}
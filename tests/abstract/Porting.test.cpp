@@ -0,0 +1,185 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include "../test_definitions.h"
+
+using T = double;
+
+class Porting : public test::definitions::GridDropletTest<T> { };
+
+TEST_F(Porting, binarySnapshot) {
+    auto grid = createGridSimulation();
+    auto& generated = grid.generated;
+    auto& testSimulation = *grid.simulation;
+    testSimulation.setWriteInterval(0.01);
+    auto fluid0 = testSimulation.getContinuousPhase();
+
+    // the copy keeps the ids of all network elements
+    auto [network, simulation] = porting::networkAndSimulationFromBinary<T>(porting::networkAndSimulationToBinary<T>(&testSimulation));
+    ASSERT_EQ(network->getNodes().size(), generated.network->getNodes().size());
+    ASSERT_EQ(network->getChannels().size(), generated.network->getChannels().size());
+    ASSERT_EQ(network->getFlowRatePumps().size(), generated.network->getFlowRatePumps().size());
+    for (auto& [channelId, channel] : generated.network->getChannels()) {
+        EXPECT_EQ(network->getChannel(channelId)->getNodeAId(), channel->getNodeAId());
+        EXPECT_EQ(network->getChannel(channelId)->getNodeBId(), channel->getNodeBId());
+        EXPECT_EQ(network->getChannel(channelId)->getLength(), channel->getLength());
+    }
+    std::ostringstream original(std::ios::binary);
+    std::ostringstream copy(std::ios::binary);
+    porting::networkToBinary(original, *generated.network);
+    porting::networkToBinary(copy, *network);
+    EXPECT_EQ(original.str(), copy.str());
+
+    // the simulation entities of the copy receive new ids
+    ASSERT_EQ(simulation->getPlatform(), sim::Platform::Droplet);
+    EXPECT_EQ(simulation->getFluids().size(), 2);
+    EXPECT_NE(simulation->getContinuousPhase()->getId(), fluid0->getId());
+    EXPECT_EQ(simulation->getContinuousPhase()->getViscosity(), fluid0->getViscosity());
+    EXPECT_EQ(dynamic_cast<sim::AbstractDroplet<T>*>(simulation.get())->getDropletInjections().size(), 1);
+
+    // both simulations are independent and give the same results
+    testSimulation.simulate();
+    simulation->simulate();
+    const auto& originalStates = testSimulation.getResults()->getStates();
+    const auto& copyStates = simulation->getResults()->getStates();
+    ASSERT_EQ(copyStates.size(), originalStates.size());
+    for (size_t i = 0; i < originalStates.size(); ++i) {
+        EXPECT_NEAR(copyStates[i]->getTime(), originalStates[i]->getTime(), 1e-12);
+        for (auto& [nodeId, pressure] : originalStates[i]->getPressures()) {
+            EXPECT_NEAR(copyStates[i]->getPressures().at(nodeId), pressure, 1e-9 * std::abs(pressure) + 1e-12);
+        }
+        for (auto& [edgeId, flowRate] : originalStates[i]->getFlowRates()) {
+            EXPECT_NEAR(copyStates[i]->getFlowRates().at(edgeId), flowRate, 1e-9 * std::abs(flowRate) + 1e-24);
+        }
+    }
+
+    EXPECT_THROW(porting::networkAndSimulationFromBinary<T>("MMFT-JSON"), std::runtime_error);
+}
+
+TEST_F(Porting, concurrentFixtures) {
+    std::string file = "../examples/Abstract/Droplet/Network1.JSON";
+
+    // add fixtures with other droplet volumes and another continuous phase
+    auto jsonString = porting::parseJSONFile(file);
+    auto& fixtures = jsonString["simulation"]["fixtures"];
+    for (T volume : { 3.0e-13, 6.0e-13 }) {
+        auto fixture = fixtures[0];
+        fixture["dropletInjections"][0]["volume"] = volume;
+        fixtures.push_back(fixture);
+    }
+    fixtures[2]["phase"] = 1;
+    fixtures[2]["dropletInjections"][0]["fluid"] = 0;
+
+    auto simulations = porting::fixturesFromJSON<T>(jsonString);
+    ASSERT_EQ(simulations.size(), 3);
+    std::vector<sim::Simulation<T>*> pointers;
+    for (size_t i = 0; i < simulations.size(); ++i) {
+        auto& [network, simulation] = simulations[i];
+        EXPECT_EQ(simulation->getFixtureId(), i);
+        for (size_t j = 0; j < i; ++j) {
+            EXPECT_NE(network, simulations[j].first);
+        }
+        pointers.push_back(simulation.get());
+    }
+    EXPECT_EQ(simulations[2].second->getContinuousPhase()->getViscosity(), 3e-3);
+    sim::simulateConcurrently(pointers, 3);
+
+    // each fixture gives the same results as its separate simulation
+    for (size_t i = 0; i < simulations.size(); ++i) {
+        jsonString["simulation"]["activeFixture"] = i;
+        auto [network, simulation] = porting::networkAndSimulationFromJSON<T>(jsonString);
+        simulation->simulate();
+        const auto& states = simulation->getResults()->getStates();
+        const auto& concurrentStates = simulations[i].second->getResults()->getStates();
+        ASSERT_EQ(concurrentStates.size(), states.size());
+        for (size_t s = 0; s < states.size(); ++s) {
+            EXPECT_NEAR(concurrentStates[s]->getTime(), states[s]->getTime(), 1e-12);
+            for (auto& [nodeId, pressure] : states[s]->getPressures()) {
+                EXPECT_NEAR(concurrentStates[s]->getPressures().at(nodeId), pressure, 1e-9 * std::abs(pressure) + 1e-12);
+            }
+            for (auto& [edgeId, flowRate] : states[s]->getFlowRates()) {
+                EXPECT_NEAR(concurrentStates[s]->getFlowRates().at(edgeId), flowRate, 1e-9 * std::abs(flowRate) + 1e-24);
+            }
+        }
+    }
+
+    auto result = porting::fixturesResultToJSON<T>(simulations);
+    ASSERT_EQ(result["fixtures"].size(), 3);
+    EXPECT_EQ(result["fixtures"][1]["fixture"], 1);
+
+    // the streamed results are identical to the dump of the complete json object
+    std::ostringstream stream;
+    porting::fixturesResultToJSON<T>(stream, simulations, 2);
+    EXPECT_EQ(stream.str(), result.dump(4));
+
+    EXPECT_THROW(porting::simulationFromJSON<T>(jsonString, simulations[0].first, 3), std::invalid_argument);
+}
+
+TEST_F(Porting, cloneNetwork) {
+    auto network = arch::Network<T>::createNetwork();
+    auto node0 = network->addNode(0.0, 0.0, true);
+    auto node1 = network->addNode(1e-3, 0.0, false);
+    auto node2 = network->addNode(2e-3, 0.0, false);
+    auto node3 = network->addNode(3e-3, 0.0, true);
+    network->setSink(node3->getId());
+    auto pump = network->addFlowRatePump(node0->getId(), node1->getId(), 3e-11);
+    auto c1 = network->addRectangularChannel(node1->getId(), node2->getId(), 30e-6, 100e-6, 1.5e-3, arch::ChannelType::NORMAL);
+    // a channel that is only defined by its resistance
+    auto c2 = network->addRectangularChannel(node2->getId(), node3->getId(), 5e12, arch::ChannelType::NORMAL);
+    auto membrane = network->addMembraneToChannel(c1->getId(), 30e-6, 100e-6, 5e-8, 0.3);
+    auto tank = network->addTankToMembrane(membrane->getId(), 30e-6, 100e-6);
+
+    // the copy keeps all ids and values, including those that have no binary representation
+    auto copy = network->clone();
+    ASSERT_NE(copy, network);
+    ASSERT_EQ(copy->getNodes().size(), network->getNodes().size());
+    ASSERT_EQ(copy->getChannels().size(), network->getChannels().size());
+    ASSERT_EQ(copy->getFlowRatePumps().size(), 1);
+    ASSERT_EQ(copy->getMembranes().size(), 1);
+    ASSERT_EQ(copy->getTanks().size(), 1);
+    for (auto& [nodeId, node] : network->getNodes()) {
+        EXPECT_NE(copy->getNode(nodeId), node);
+        EXPECT_EQ(copy->getNode(nodeId)->getPosition(), node->getPosition());
+        EXPECT_EQ(copy->getNode(nodeId)->getGround(), node->getGround());
+        EXPECT_EQ(copy->getNode(nodeId)->getSink(), node->getSink());
+    }
+    EXPECT_EQ(copy->getChannel(c1->getId())->getLength(), c1->getLength());
+    EXPECT_EQ(copy->getChannel(c2->getId())->getResistance(), c2->getResistance());
+    EXPECT_EQ(copy->getFlowRatePump(pump->getId())->getFlowRate(), pump->getFlowRate());
+
+    // the membrane of the copy lies along the copied channel and tank
+    auto copiedMembrane = copy->getMembrane(membrane->getId());
+    EXPECT_EQ(copiedMembrane->getChannel(), copy->getChannel(c1->getId()));
+    EXPECT_EQ(copiedMembrane->getTank(), copy->getTanks().at(tank->getId()));
+    EXPECT_EQ(copiedMembrane->getPorosity(), membrane->getPorosity());
+
+    // changes of the copy do not affect the original
+    copy->getFlowRatePump(pump->getId())->setFlowRate(6e-11);
+    EXPECT_EQ(pump->getFlowRate(), 3e-11);
+    EXPECT_EQ(network->getChannel(c2->getId())->getResistance(), 5e12);
+}
+
+TEST_F(Porting, chunkedResultExport) {
+    auto grid = runGridSimulation([](sim::AbstractDroplet<T>& simulation) { simulation.setWriteInterval(0.01); });
+    auto& testSimulation = *grid.simulation;
+    ASSERT_GT(testSimulation.getResults()->getStates().size(), 4);
+
+    // the chunked export is identical to the dump of the complete json object, for any number of threads and chunks
+    std::string expected = porting::resultToJSON<T>(&testSimulation).dump(4);
+    for (size_t threads : { 1, 3, 8 }) {
+        for (size_t chunkSize : { 1, 4, 1000 }) {
+            std::ostringstream stream;
+            porting::resultToJSON<T>(stream, &testSimulation, threads, chunkSize);
+            EXPECT_EQ(stream.str(), expected);
+        }
+    }
+
+    // the file is written by the calling thread by default
+    porting::resultToJSON<T>("chunkedResultExport.JSON", &testSimulation);
+    std::ifstream file("chunkedResultExport.JSON");
+    std::stringstream written;
+    written << file.rdbuf();
+    EXPECT_EQ(written.str(), expected + "\n");
+    std::remove("chunkedResultExport.JSON");
+}
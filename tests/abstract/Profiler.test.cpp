@@ -0,0 +1,44 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include "../test_definitions.h"
+
+using T = double;
+
+class Profiler : public test::definitions::GridDropletTest<T> { };
+
+TEST_F(Profiler, dropletSimulation) {
+    auto runSimulation = [this](bool profiling) {
+        return runGridSimulation([profiling](sim::AbstractDroplet<T>& simulation) {
+            EXPECT_FALSE(simulation.isProfiling());
+            simulation.setProfiling(profiling);
+        }).simulation->getResults();
+    };
+
+    // profiling is disabled by default
+    EXPECT_EQ(runSimulation(false)->getProfile(), nullptr);
+
+    auto result = runSimulation(true);
+    auto profile = result->getProfile();
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(result::Profiler::getActive(), nullptr);
+
+    const auto& saveState = profile->getPhase(result::Phase::SaveState);
+    EXPECT_EQ(saveState.calls, result->getStates().size());
+    EXPECT_GT(profile->getPhase(result::Phase::ComputeEvents).calls, 0);
+    EXPECT_GT(profile->getPhase(result::Phase::PerformEvent).calls, 0);
+    EXPECT_GE(profile->getPhase(result::Phase::NodalAnalysis).calls, profile->getPhase(result::Phase::PerformEvent).calls);
+    EXPECT_EQ(profile->getPhase(result::Phase::NodalSolve).calls, profile->getPhase(result::Phase::NodalAnalysis).calls);
+    EXPECT_EQ(profile->getPhase(result::Phase::LbmSolve).calls, 0);
+    EXPECT_GT(profile->getCounter(result::Counter::ComputedEvents), 0);
+    EXPECT_GT(profile->getCounter(result::Counter::NodalUnknowns), 0);
+
+    size_t histogramCalls = 0;
+    for (size_t calls : saveState.histogram) {
+        histogramCalls += calls;
+    }
+    EXPECT_EQ(histogramCalls, saveState.calls);
+    EXPECT_LE(saveState.minTime, saveState.maxTime);
+    EXPECT_LE(saveState.maxTime, saveState.totalTime);
+}
@@ -0,0 +1,55 @@
+#include "../src/baseSimulator.h"
+
+#include "gtest/gtest.h"
+
+#include "../test_definitions.h"
+
+using T = double;
+
+class Results : public test::definitions::GridDropletTest<T> { };
+
+TEST_F(Results, deltaStates) {
+    auto runSimulation = [this](size_t keyframeInterval) {
+        return runGridSimulation([keyframeInterval](sim::AbstractDroplet<T>& simulation) {
+            simulation.setSampling(true);
+            simulation.setWriteInterval(0.01);
+            simulation.setKeyframeInterval(keyframeInterval);
+        });
+    };
+
+    auto fullGrid = runSimulation(1);
+    auto deltaGrid = runSimulation(8);
+    auto full = fullGrid.simulation->getResults();
+    auto delta = deltaGrid.simulation->getResults();
+    const auto& fullStates = full->getStates();
+    const auto& deltaStates = delta->getStates();
+    ASSERT_EQ(fullStates.size(), deltaStates.size());
+    ASSERT_GT(deltaStates.size(), 8);
+
+    // every 8th state is a keyframe, the full values of the deltas are reconstructed on access
+    for (size_t i = 0; i < deltaStates.size(); ++i) {
+        EXPECT_FALSE(fullStates[i]->isDelta());
+        EXPECT_EQ(deltaStates[i]->isDelta(), i % 8 != 0);
+        EXPECT_EQ(deltaStates[i]->getPressures(), fullStates[i]->getPressures());
+        EXPECT_EQ(deltaStates[i]->getFlowRates(), fullStates[i]->getFlowRates());
+    }
+
+    // the dense tables are reconstructed from the deltas as well
+    auto fullTable = full->getStateTable();
+    auto deltaTable = delta->getStateTable();
+    EXPECT_EQ(deltaTable->nodeIds, fullTable->nodeIds);
+    EXPECT_EQ(deltaTable->edgeIds, fullTable->edgeIds);
+    EXPECT_EQ(deltaTable->pressures, fullTable->pressures);
+    EXPECT_EQ(deltaTable->flowRates, fullTable->flowRates);
+
+    // the export walks forward through the deltas, also for chunks that start in between two keyframes
+    std::string expected = porting::resultToJSON<T>(fullGrid.simulation.get()).dump(4);
+    EXPECT_EQ(porting::resultToJSON<T>(deltaGrid.simulation.get()).dump(4), expected);
+    for (size_t chunkSize : { 3, 8, 1000 }) {
+        std::ostringstream stream;
+        porting::resultToJSON<T>(stream, deltaGrid.simulation.get(), 2, chunkSize);
+        EXPECT_EQ(stream.str(), expected);
+    }
+
+    EXPECT_THROW(createGridSimulation().simulation->setKeyframeInterval(0), std::invalid_argument);
+}
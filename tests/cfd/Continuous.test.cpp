@@ -7,47 +7,111 @@
 
 using T = double;
 
-class CfdContinuous : public test::definitions::GlobalTest<T> {};
+class CfdContinuous : public test::definitions::CfdContinuousTest<T> {};
 
 TEST_F(CfdContinuous, Case1a) {
-    // define network
-    auto network = arch::Network<T>::createNetwork();
-    
-    // nodes
-    auto node1 = network->addNode(1e-3, 2e-3, true);
-    auto node2 = network->addNode(1e-3, 1e-3, true);
-    auto node3 = network->addNode(1e-3, 0.0, true);
-    auto node4 = network->addNode(2e-3, 2e-3, false);
-    auto node5 = network->addNode(2e-3, 1e-3, false);
-    auto node6 = network->addNode(2e-3, 0.0, false);
-    auto node7 = network->addNode(3e-3, 1e-3, true);
-
-    // channels
-    auto cWidth = 100e-6;
-    auto cHeight = 100e-6;
-    auto cLength = 1000e-6;
-
-    auto c1 = network->addRectangularChannel(node1->getId(), node4->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
-    auto c2 = network->addRectangularChannel(node2->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
-    auto c3 = network->addRectangularChannel(node3->getId(), node6->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
-    auto c4 = network->addRectangularChannel(node4->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
-    auto c5 = network->addRectangularChannel(node6->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
-    auto c6 = network->addRectangularChannel(node5->getId(), node7->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
-
-    // define simulation
-    sim::CfdContinuous<T> testSimulation(network);
-
-    // fluids
-    auto fluid0 = testSimulation.addFluid(1e-3, 1e3);
-    //--- continuousPhase ---
-    testSimulation.setContinuousPhase(fluid0->getId());
-
-    // Boundary conditions
-    testSimulation.addPressureBC(node1, 1e2);
-    testSimulation.addPressureBC(node2, 1e2);
-    testSimulation.addPressureBC(node3, 1e2);
-    testSimulation.addPressureBC(node7, 0.0);
-    
+    auto network = createCase1aNetwork();
+    auto testSimulation = createCase1aSimulation(network);
+
     // Simulate
-    testSimulation.simulate();
+    testSimulation->simulate();
+}
+
+TEST_F(CfdContinuous, CheckpointRestart) {
+    auto network = createCase1aNetwork();
+
+    // Uninterrupted run
+    auto reference = createCase1aSimulation(network);
+    reference->setMaxIter(2000);
+    reference->simulate();
+
+    // First half, which writes an automatic checkpoint at its last step
+    auto interrupted = createCase1aSimulation(network);
+    interrupted->setMaxIter(1000);
+    interrupted->setCheckpointInterval(1000);
+    interrupted->simulate();
+    ASSERT_TRUE(std::filesystem::exists("./tmp/lbmContinuous_checkpoint.mmft"));
+    ASSERT_EQ(getLbmSimulator(*interrupted).getIterations(), 1000);
+
+    // Second half, which resumes from the checkpoint with unchanged boundary conditions
+    auto restarted = createCase1aSimulation(network);
+    restarted->setMaxIter(1000);
+    restarted->setRestartCheckpoint("lbmContinuous_checkpoint");
+    restarted->simulate();
+
+    // The restarted run continues the step counter and ends in the same flow field as the uninterrupted run
+    EXPECT_EQ(getLbmSimulator(*restarted).getIterations(), getLbmSimulator(*reference).getIterations());
+    auto [referenceMinPressure, referenceMaxPressure] = reference->getGlobalPressureBounds();
+    auto [restartedMinPressure, restartedMaxPressure] = restarted->getGlobalPressureBounds();
+    EXPECT_NEAR(restartedMinPressure, referenceMinPressure, 1e-9 * std::abs(referenceMaxPressure));
+    EXPECT_NEAR(restartedMaxPressure, referenceMaxPressure, 1e-9 * std::abs(referenceMaxPressure));
+    auto [referenceMinVelocity, referenceMaxVelocity] = reference->getGlobalVelocityBounds();
+    auto [restartedMinVelocity, restartedMaxVelocity] = restarted->getGlobalVelocityBounds();
+    EXPECT_NEAR(restartedMinVelocity, referenceMinVelocity, 1e-9 * std::abs(referenceMaxVelocity));
+    EXPECT_NEAR(restartedMaxVelocity, referenceMaxVelocity, 1e-9 * std::abs(referenceMaxVelocity));
+}
+
+TEST_F(CfdContinuous, GeometryCache) {
+    auto network = createCase1aNetwork();
+    sim::GeometryCache<T>::clear();
+
+    // First run, which voxelizes the geometry and stores it in the cache
+    auto testSimulation = createCase1aSimulation(network);
+    testSimulation->setMaxIter(1000);
+    testSimulation->simulate();
+    ASSERT_EQ(sim::GeometryCache<T>::size(), 1);
+
+    // Second run with different boundary conditions, which loads the geometry from the cache
+    auto cachedSimulation = createCase1aSimulation(network, { 2e2, 1e2, 1e2 });
+    cachedSimulation->setMaxIter(1000);
+    cachedSimulation->simulate();
+    EXPECT_EQ(sim::GeometryCache<T>::size(), 1);
+
+    // Third run, which voxelizes the geometry again
+    sim::GeometryCache<T>::clear();
+    auto freshSimulation = createCase1aSimulation(network, { 2e2, 1e2, 1e2 });
+    freshSimulation->setMaxIter(1000);
+    freshSimulation->simulate();
+
+    // The cached geometry equals the fresh voxelization in every material, i.e., fluid, wall and the openings
+    auto& cachedLbm = getLbmSimulator(*cachedSimulation);
+    auto& freshLbm = getLbmSimulator(*freshSimulation);
+    ASSERT_GT(freshLbm.getFluidCellCount(), 0);
+    EXPECT_EQ(cachedLbm.getFluidCellCount(), freshLbm.getFluidCellCount());
+    for (unsigned char material : { 2, 3, 4, 5, 9 }) {
+        EXPECT_EQ(readVoxels(cachedLbm, material), readVoxels(freshLbm, material)) << "material " << int(material);
+    }
+
+    // And so does the flow field, which is computed on it
+    auto [cachedMin, cachedMax] = cachedSimulation->getGlobalPressureBounds();
+    auto [freshMin, freshMax] = freshSimulation->getGlobalPressureBounds();
+    EXPECT_EQ(cachedMin, freshMin);
+    EXPECT_EQ(cachedMax, freshMax);
+}
+
+TEST_F(CfdContinuous, NetworkIndicator) {
+    auto network = createCase1aNetwork();
+
+    // The STL file is the default
+    auto stlSimulation = createCase1aSimulation(network);
+    EXPECT_TRUE(stlSimulation->isWriteStl());
+    stlSimulation->setMaxIter(1);
+    stlSimulation->simulate();
+
+    auto memorySimulation = createCase1aSimulation(network);
+    memorySimulation->setWriteStl(false);
+    memorySimulation->setMaxIter(1);
+    memorySimulation->simulate();
+
+    // The in-memory geometry voxelizes to the same material grid, up to a few cells at the junctions
+    auto& stlLbm = getLbmSimulator(*stlSimulation);
+    auto& memoryLbm = getLbmSimulator(*memorySimulation);
+    ASSERT_GT(stlLbm.getFluidCellCount(), 0);
+    EXPECT_NEAR(T(memoryLbm.getFluidCellCount()), T(stlLbm.getFluidCellCount()), 0.01 * stlLbm.getFluidCellCount());
+    EXPECT_NEAR(T(readVoxels(memoryLbm, 2)), T(readVoxels(stlLbm, 2)), 0.01 * readVoxels(stlLbm, 2));
+
+    // The openings, i.e., material 3 + node id of the dangling nodes, are identical
+    for (unsigned char material : { 3, 4, 5, 9 }) {
+        EXPECT_EQ(readVoxels(memoryLbm, material), readVoxels(stlLbm, material)) << "material " << int(material);
+    }
 }
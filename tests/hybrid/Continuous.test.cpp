@@ -7,7 +7,7 @@
 
 using T = double;
 
-class HybridContinuous : public test::definitions::GlobalTest<T> {};
+class HybridContinuous : public test::definitions::CrossModuleTest<T> {};
 
 TEST_F(HybridContinuous, Case1a) {
     // define network
@@ -104,6 +104,136 @@ TEST_F(HybridContinuous, Case1a) {
     EXPECT_NEAR(network->getChannels().at(8)->getFlowRate(), 4.69188e-9, 1e-14);
 }
 
+TEST_F(HybridContinuous, Case1aAdaptive) {
+    // define network
+    auto network = arch::Network<T>::createNetwork();
+    
+    // nodes
+    auto node0 = network->addNode(0.0, 0.0, true);
+    auto node1 = network->addNode(1e-3, 2e-3, false);
+    auto node2 = network->addNode(1e-3, 1e-3, false);
+    auto node3 = network->addNode(1e-3, 0.0, false);
+    auto node4 = network->addNode(2e-3, 2e-3, false);
+    auto node5 = network->addNode(1.75e-3, 1e-3, false);
+    auto node6 = network->addNode(2e-3, 0.0, false);
+    auto node7 = network->addNode(2e-3, 1.25e-3, false);
+    auto node8 = network->addNode(2e-3, 0.75e-3, false);
+    auto node9 = network->addNode(2.25e-3, 1e-3, false);
+    auto node10 = network->addNode(3e-3, 1e-3, true);
+
+    // channels
+    auto cWidth = 100e-6;
+    auto cHeight = 100e-6;
+    auto cLength = 0.0;
+
+    auto c0 = network->addRectangularChannel(node0->getId(), node1->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c1 = network->addRectangularChannel(node0->getId(), node2->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    auto c2 = network->addRectangularChannel(node0->getId(), node3->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node1->getId(), node4->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node2->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node3->getId(), node6->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node4->getId(), node7->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node6->getId(), node8->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+    network->addRectangularChannel(node9->getId(), node10->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+
+    // module
+    std::vector<T> position = { 1.75e-3, 0.75e-3 };
+    std::vector<T> size = { 5e-4, 5e-4 };
+    std::string stlFile = "../examples/STL/cross.stl";
+    std::unordered_map<size_t, arch::Opening<T>> Openings;
+    Openings.try_emplace(5, arch::Opening<T>(network->getNode(5), std::vector<T>({1.0, 0.0}), 1e-4));
+    Openings.try_emplace(7, arch::Opening<T>(network->getNode(7), std::vector<T>({0.0, -1.0}), 1e-4));
+    Openings.try_emplace(8, arch::Opening<T>(network->getNode(8), std::vector<T>({0.0, 1.0}), 1e-4));
+    Openings.try_emplace(9, arch::Opening<T>(network->getNode(9), std::vector<T>({-1.0, 0.0}), 1e-4));
+
+    auto m0 = network->addCfdModule(position, size, stlFile, Openings);
+
+    // define simulation
+    sim::HybridContinuous<T> testSimulation(network);
+
+    // fluids
+    auto fluid0 = testSimulation.addFluid(1e-3, 1e3);
+    //--- continuousPhase ---
+    testSimulation.setContinuousPhase(fluid0->getId());
+
+    // Set the resistance model
+    testSimulation.setPoiseuilleResistanceModel();
+
+    // simulator
+    std::string name = "Paper1a-cross-adaptive";
+    T charPhysLength = 1e-4;
+    T charPhysVelocity = 1e-1;
+    size_t resolution = 20;
+    T epsilon = 1e-1;
+    T tau = 0.55;
+    int thetaMin = 5;
+    int thetaMax = 80;
+
+    auto lbmSimulator = testSimulation.addLbmSimulator(network->getCfdModule(m0->getId()), resolution, epsilon, tau, charPhysLength, charPhysVelocity, name);
+    testSimulation.setAdaptiveHybridScheme(0.1, 0.5, thetaMin, thetaMax);
+
+    // pressure pump
+    auto pressure = 1e3;
+    network->setPressurePump(c0->getId(), pressure);
+    network->setPressurePump(c1->getId(), pressure);
+    network->setPressurePump(c2->getId(), pressure);
+    
+    // Simulate
+    testSimulation.simulate();
+
+    // The converged solution does not depend on the update schedule
+    EXPECT_NEAR(network->getNodes().at(5)->getPressure(), 791.962, 1.0);
+    EXPECT_NEAR(network->getNodes().at(7)->getPressure(), 753.628, 1.0);
+    EXPECT_NEAR(network->getNodes().at(8)->getPressure(), 753.628, 1.0);
+    EXPECT_NEAR(network->getNodes().at(9)->getPressure(), 422.270, 1.0);
+
+    // The schedule starts at thetaMin and stays within the bounds
+    const auto& schedules = testSimulation.getResults()->getThetaSchedules();
+    ASSERT_EQ(schedules.count(lbmSimulator->getId()), 1);
+    const auto& schedule = schedules.at(lbmSimulator->getId());
+    ASSERT_FALSE(schedule.empty());
+    EXPECT_EQ(schedule.front(), thetaMin);
+    for (int theta : schedule) {
+        EXPECT_GE(theta, thetaMin);
+        EXPECT_LE(theta, thetaMax);
+    }
+}
+
+TEST_F(HybridContinuous, Case1aWarmStart) {
+    auto cold = createCrossSimulation("Paper1a-cross-cold");
+    cold.simulation->simulate();
+
+    auto warm = createCrossSimulation("Paper1a-cross-warm");
+    warm.lbmSimulator->setPoiseuilleWarmStart(true);
+    warm.simulation->simulate();
+
+    // The Poiseuille estimate of the initial field saves LBM iterations, but does not change the converged solution
+    EXPECT_LT(warm.lbmSimulator->getIterations(), cold.lbmSimulator->getIterations());
+    expectCrossPressures(cold.network, 1.0);
+    expectCrossPressures(warm.network, 1.0);
+}
+
+TEST_F(HybridContinuous, Case1aWarmStartCheckpoint) {
+    auto cold = createCrossSimulation("Paper1a-cross-cold");
+    cold.simulation->simulate();
+    cold.lbmSimulator->writeCheckpoint("Paper1a-cross-warmStart");
+
+    auto warm = createCrossSimulation("Paper1a-cross-warm");
+    warm.lbmSimulator->setWarmStartCheckpoint("Paper1a-cross-warmStart");
+    warm.simulation->simulate();
+
+    // The converged field of a previous run is loaded, but the iteration step starts from zero
+    EXPECT_LT(warm.lbmSimulator->getIterations(), cold.lbmSimulator->getIterations());
+    expectCrossPressures(warm.network, 1.0);
+
+    // A missing checkpoint is reported instead of silently starting from rest
+    auto missing = createCrossSimulation("Paper1a-cross-missing");
+    missing.lbmSimulator->setWarmStartCheckpoint("Paper1a-cross-missing");
+    EXPECT_THROW(missing.simulation->simulate(), std::runtime_error);
+
+    std::filesystem::remove("./tmp/Paper1a-cross-warmStart.mmft");
+}
+
 #ifdef USE_ESSLBM
 TEST_F(HybridContinuous, esstest) {
 
@@ -175,6 +305,48 @@ TEST_F(HybridContinuous, Case1aJSON) {
     EXPECT_NEAR(network->getChannels().at(8)->getFlowRate(), 4.69188e-9, 1e-14);
 }
 
+TEST_F(HybridContinuous, Case1aLatticePrecision) {
+
+    std::string file = "../examples/Hybrid/Continuous/Network1a.JSON";
+
+    // Only the lattice runs in single precision if the simulator is built with USE_FLOAT_LATTICE
+#ifdef USE_FLOAT_LATTICE
+    EXPECT_TRUE((std::is_same_v<sim::LatticePrecision<T>, float>));
+#else
+    EXPECT_TRUE((std::is_same_v<sim::LatticePrecision<T>, T>));
+#endif
+
+    auto network = porting::networkFromJSON<T>(file);
+    auto testSimulation = porting::simulationFromJSON<T>(file, network);
+    testSimulation->simulate();
+
+    // Relative deviation from the double precision reference values. The other hybrid tests hold these values to
+    // about 1e-5, a single precision lattice adds its rounding errors on top. The largest deviation is recorded, such
+    // that the float lattice job of the CI reports it.
+    const T tolerance = (sizeof(sim::LatticePrecision<T>) < sizeof(double)) ? 1e-4 : 1e-5;
+    T maxDeviation = 0.0;
+    auto expectClose = [tolerance, &maxDeviation](T value, T reference) {
+        maxDeviation = std::max(maxDeviation, std::abs(value - reference) / std::abs(reference));
+        EXPECT_NEAR(value, reference, tolerance * std::abs(reference));
+    };
+
+    expectClose(network->getNodes().at(4)->getPressure(), 859.216);
+    expectClose(network->getNodes().at(5)->getPressure(), 791.962);
+    expectClose(network->getNodes().at(6)->getPressure(), 859.216);
+    expectClose(network->getNodes().at(7)->getPressure(), 753.628);
+    expectClose(network->getNodes().at(8)->getPressure(), 753.628);
+    expectClose(network->getNodes().at(9)->getPressure(), 422.270);
+
+    expectClose(network->getChannels().at(3)->getFlowRate(), 1.1732e-9);
+    expectClose(network->getChannels().at(4)->getFlowRate(), 2.31153e-9);
+    expectClose(network->getChannels().at(5)->getFlowRate(), 1.1732e-9);
+    expectClose(network->getChannels().at(6)->getFlowRate(), 1.1732e-9);
+    expectClose(network->getChannels().at(7)->getFlowRate(), 1.1732e-9);
+    expectClose(network->getChannels().at(8)->getFlowRate(), 4.69188e-9);
+
+    RecordProperty("maxRelativeDeviation", std::to_string(maxDeviation));
+}
+
 TEST_F(HybridContinuous, testCase2a) {
     
 std::string file = "../examples/Hybrid/Continuous/Network2a.JSON";
@@ -0,0 +1,91 @@
+import threading
+
+from mmft.simulator import *
+
+# Network of the continuous abstract example, with three pressure pumps
+def continuousNetwork():
+
+    network = createNetwork()
+
+    # Nodes
+    n0 = network.addNode(0.0, 0.0, True)
+    n1 = network.addNode(1e-3, 2e-3, False)
+    n2 = network.addNode(1e-3, 1e-3, False)
+    n3 = network.addNode(1e-3, 0.0, False)
+    n4 = network.addNode(2e-3, 2e-3, False)
+    n5 = network.addNode(2e-3, 1e-3, False)
+    n6 = network.addNode(2e-3, 0.0, False)
+    n7 = network.addNode(3e-3, 1e-3, True)
+
+    # Channels
+    network.addPressurePump(n0, n1, 1e3)
+    network.addPressurePump(n0, n2, 1e3)
+    network.addPressurePump(n0, n3, 1e3)
+    network.addRectangularChannel(n1, n4, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n2, n5, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n3, n6, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n4, n5, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n6, n5, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n5, n7, 1e-4, 1e-4, ChannelType.normal)
+
+    return network
+
+def continuousSimulation(network):
+
+    simulation = AbstractContinuous(network)
+    f0 = simulation.addFluid(1e-3, 1e3)
+    simulation.setContinuousPhase(f0)
+    simulation.set1DResistanceModel()
+
+    return simulation
+
+# Independent abstract simulations run concurrently and match the synchronous result
+def abstractContinuousAsync():
+
+    reference = continuousSimulation(continuousNetwork())
+    reference.simulate()
+    expected = reference.getResults().getLastState().getPressures()
+
+    futures = [continuousSimulation(continuousNetwork()).simulate_async() for _ in range(4)]
+    for future in futures:
+        assert future.wait(60.0)
+        assert future.done()
+        pressures = future.result().getLastState().getPressures()
+        for nodeId, pressure in expected.items():
+            assert abs(pressures[nodeId] - pressure) <= 1e-9 * max(abs(pressure), 1.0)
+
+# Dropping a running future waits for the simulation without holding the interpreter lock
+def abstractContinuousAsyncRelease():
+
+    counter = [0]
+    stop = threading.Event()
+    def count():
+        while not stop.is_set():
+            counter[0] += 1
+
+    thread = threading.Thread(target=count)
+    thread.start()
+    future = continuousSimulation(continuousNetwork()).simulate_async()
+    del future
+    stop.set()
+    thread.join()
+
+    assert counter[0] > 0
+
+# Hybrid and CFD simulations share the OpenLB state and are rejected
+def hybridContinuousAsync():
+
+    simulation = HybridContinuous(continuousNetwork())
+    try:
+        simulation.simulate_async()
+    except ValueError:
+        return
+    raise AssertionError("simulate_async accepted a hybrid simulation")
+
+def main():
+    abstractContinuousAsync()
+    abstractContinuousAsyncRelease()
+    hybridContinuousAsync()
+
+if __name__ == "__main__":
+    main()
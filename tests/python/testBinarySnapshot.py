@@ -0,0 +1,93 @@
+from mmft.simulator import *
+
+# Network of the continuous abstract example, with three pressure pumps
+def continuousNetwork():
+
+    network = createNetwork()
+
+    # Nodes
+    n0 = network.addNode(0.0, 0.0, True)
+    n1 = network.addNode(1e-3, 2e-3, False)
+    n2 = network.addNode(1e-3, 1e-3, False)
+    n3 = network.addNode(1e-3, 0.0, False)
+    n4 = network.addNode(2e-3, 2e-3, False)
+    n5 = network.addNode(2e-3, 1e-3, False)
+    n6 = network.addNode(2e-3, 0.0, False)
+    n7 = network.addNode(3e-3, 1e-3, True)
+
+    # Channels
+    network.addPressurePump(n0, n1, 1e3)
+    network.addPressurePump(n0, n2, 1e3)
+    network.addPressurePump(n0, n3, 1e3)
+    network.addRectangularChannel(n1, n4, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n2, n5, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n3, n6, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n4, n5, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n6, n5, 1e-4, 1e-4, ChannelType.normal)
+    network.addRectangularChannel(n5, n7, 1e-4, 1e-4, ChannelType.normal)
+
+    return network
+
+def continuousSimulation(network):
+
+    simulation = AbstractContinuous(network)
+    f0 = simulation.addFluid(1e-3, 1e3)
+    simulation.setContinuousPhase(f0)
+    simulation.set1DResistanceModel()
+
+    return simulation
+
+def expectEqualPressures(simulation, reference):
+
+    expected = reference.getResults().getLastState().getPressures()
+    pressures = simulation.getResults().getLastState().getPressures()
+    assert pressures.keys() == expected.keys()
+    for nodeId, pressure in expected.items():
+        assert abs(pressures[nodeId] - pressure) <= 1e-9 * max(abs(pressure), 1.0)
+
+# A snapshot is returned as bytes and restores a network and a simulation with the same result
+def binarySnapshot():
+
+    reference = continuousSimulation(continuousNetwork())
+    binary = networkAndSimulationToBinary(reference)
+    assert isinstance(binary, bytes)
+    assert len(binary) > 0
+
+    network, simulation = networkAndSimulationFromBinary(binary)
+    assert len(network.getNodes()) == 8
+    assert len(network.getChannels()) == 6
+
+    # Equal setups give equal snapshots
+    assert networkAndSimulationToBinary(simulation) == binary
+
+    reference.simulate()
+    simulation.simulate()
+    expectEqualPressures(simulation, reference)
+
+# A copy can be simulated independently of the original
+def cloneSnapshot():
+
+    original = continuousSimulation(continuousNetwork())
+    network, copy = cloneNetworkAndSimulation(original)
+    copy.simulate()
+    original.simulate()
+    expectEqualPressures(copy, original)
+
+# Truncated or foreign bytes are rejected
+def invalidSnapshot():
+
+    binary = networkAndSimulationToBinary(continuousSimulation(continuousNetwork()))
+    for invalid in [binary[:len(binary) // 2], b"MMFT", bytes(64)]:
+        try:
+            networkAndSimulationFromBinary(invalid)
+        except RuntimeError:
+            continue
+        raise AssertionError("networkAndSimulationFromBinary accepted an invalid snapshot")
+
+def main():
+    binarySnapshot()
+    cloneSnapshot()
+    invalidSnapshot()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,69 @@
+from mmft.simulator import *
+
+# A seed generates the same random topology in every run and on every platform
+def randomPlanarSeed():
+
+    generatorA = NetworkGenerator(42)
+    generatorB = NetworkGenerator(42)
+    generatedA = generatorA.randomPlanar(10, 10, 0.3)
+    generatedB = generatorB.randomPlanar(10, 10, 0.3)
+    networkA = generatedA.network
+    networkB = generatedB.network
+
+    assert len(networkA.getNodes()) == 100
+    assert len(networkA.getChannels()) == len(networkB.getChannels())
+    for nodeId in range(len(networkA.getNodes())):
+        assert networkA.getNode(nodeId).getPosition() == networkB.getNode(nodeId).getPosition()
+    for channelId in range(len(networkA.getChannels())):
+        assert networkA.getChannel(channelId).getNodeAId() == networkB.getChannel(channelId).getNodeAId()
+        assert networkA.getChannel(channelId).getNodeBId() == networkB.getChannel(channelId).getNodeBId()
+
+    # The jitter of the first nodes, drawn from std::mt19937_64 without standard distributions
+    position0 = networkA.getNode(0).getPosition()
+    position1 = networkA.getNode(1).getPosition()
+    assert abs(position0[0] - 1.0206221318181558e-4) <= 1e-18
+    assert abs(position0[1] - 5.5612557541878993e-5) <= 1e-18
+    assert abs(position1[0] - 1.0085808029921067e-4) <= 1e-18
+    assert abs(position1[1] - (1e-3 - 1.4549092654702521e-4)) <= 1e-18
+
+    generatorA.setSeed(7)
+    networkC = generatorA.randomPlanar(10, 10, 0.3).network
+    assert networkA.getNode(5).getPosition() != networkC.getNode(5).getPosition()
+
+# The regular topologies and the settings of the generator
+def regularTopologies():
+
+    generator = NetworkGenerator()
+    generator.setSpacing(2e-3)
+    generator.setChannelDimensions(width=200e-6, height=50e-6)
+    generator.setFlowRate(2e-11)
+    assert generator.getSpacing() == 2e-3
+    assert generator.getChannelWidth() == 200e-6
+    assert generator.getChannelHeight() == 50e-6
+    assert generator.getFlowRate() == 2e-11
+
+    grid = generator.grid(3, 4)
+    assert len(grid.network.getNodes()) == 12
+    assert grid.inlets == [0]
+    assert len(grid.pumps) == len(grid.inlets)
+    assert len(grid.inletChannels) == len(grid.inlets)
+    assert grid.network.getNode(grid.outlet).getGround()
+
+    tree = generator.binaryTree(3)
+    assert len(tree.network.getNodes()) == 3*2**3 - 2
+
+    ladder = generator.serpentineLadder(5, 5e-3)
+    assert len(ladder.network.getNodes()) == 10
+
+    try:
+        generator.randomPlanar(4, 4, 1.5)
+    except ValueError:
+        return
+    raise AssertionError("randomPlanar accepted an edge probability above 1")
+
+def main():
+    randomPlanarSeed()
+    regularTopologies()
+
+if __name__ == "__main__":
+    main()
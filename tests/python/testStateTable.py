@@ -0,0 +1,105 @@
+import gc
+import math
+
+import numpy as np
+
+from mmft.simulator import *
+
+# Droplet simulation on a generated 3x3 grid, of which the states are stored as keyframes and deltas
+def gridSimulation():
+
+    generator = NetworkGenerator()
+    generator.setFlowRate(3e-11)
+    grid = generator.grid(3, 3)
+
+    simulation = AbstractDroplet(grid.network)
+    f0 = simulation.addFluid(1e-3, 1e3)
+    f1 = simulation.addFluid(3e-3, 1e3)
+    simulation.setContinuousPhase(f0)
+    droplet = simulation.addDroplet(f1, 1.5 * 100e-6 * 100e-6 * 30e-6)
+    simulation.addDropletInjection(droplet.getId(), 0.0, grid.inletChannels[0], 0.5)
+    simulation.set1DResistanceModel()
+    simulation.setSampling(True)
+    simulation.setWriteInterval(0.01)
+    simulation.setKeyframeInterval(8)
+    simulation.simulate()
+
+    return grid, simulation
+
+# The arrays are read-only, C-contiguous views with the types and shapes of the state table
+def stateTableLayout():
+
+    grid, simulation = gridSimulation()
+    result = simulation.getResults()
+    states = result.getStates()
+
+    times = result.getTimes()
+    nodeIds = result.getNodeIds()
+    edgeIds = result.getEdgeIds()
+    pressures = result.getPressureMatrix()
+    flowRates = result.getFlowRateMatrix()
+
+    assert times.dtype == np.float64
+    assert nodeIds.dtype == np.intc
+    assert edgeIds.dtype == np.intc
+    assert pressures.dtype == np.float64
+    assert flowRates.dtype == np.float64
+
+    assert times.shape == (len(states),)
+    assert pressures.shape == (len(states), len(nodeIds))
+    assert flowRates.shape == (len(states), len(edgeIds))
+    assert pressures.strides == (8 * len(nodeIds), 8)
+    assert flowRates.strides == (8 * len(edgeIds), 8)
+    assert pressures.flags.c_contiguous
+
+    for array in (times, nodeIds, edgeIds, pressures, flowRates):
+        assert not array.flags.writeable
+        assert not array.flags.owndata
+    try:
+        pressures[0, 0] = 0.0
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("the pressure matrix is writeable")
+
+    # The rows hold the values of the states, also of the delta states, and NaN for missing values
+    assert any(state.isDelta() for state in states)
+    assert list(nodeIds) == sorted(nodeIds)
+    for i, state in enumerate(states):
+        assert times[i] == state.getTime()
+        statePressures = state.getPressures()
+        for j, nodeId in enumerate(nodeIds):
+            if nodeId in statePressures:
+                assert pressures[i, j] == statePressures[nodeId]
+            else:
+                assert math.isnan(pressures[i, j])
+        stateFlowRates = state.getFlowRates()
+        for j, edgeId in enumerate(edgeIds):
+            if edgeId in stateFlowRates:
+                assert flowRates[i, j] == stateFlowRates[edgeId]
+            else:
+                assert math.isnan(flowRates[i, j])
+
+# A view keeps the state table alive after the simulation and its results are released
+def stateTableLifetime():
+
+    grid, simulation = gridSimulation()
+    pressures = simulation.getResults().getPressureMatrix()
+    times = simulation.getResults().getTimes()
+    expectedPressures = np.array(pressures, copy=True)
+    expectedTimes = np.array(times, copy=True)
+
+    del grid, simulation
+    gc.collect()
+    gc.collect()
+
+    assert pressures.base is not None
+    assert np.array_equal(pressures, expectedPressures, equal_nan=True)
+    assert np.array_equal(times, expectedTimes)
+
+def main():
+    stateTableLayout()
+    stateTableLifetime()
+
+if __name__ == "__main__":
+    main()
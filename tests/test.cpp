@@ -8,7 +8,11 @@
 #include "abstract/Continuous.test.cpp"
 #include "abstract/Droplet.test.cpp"
 #include "abstract/GradientGenerator.test.cpp"
+#include "abstract/Logger.test.cpp"
 #include "abstract/Membrane.test.cpp"
+#include "abstract/Porting.test.cpp"
+#include "abstract/Profiler.test.cpp"
+#include "abstract/Results.test.cpp"
 #include "abstract/Topology.test.cpp"
 
 #include "hybrid/Concentration.test.cpp"
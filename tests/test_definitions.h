@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "../src/baseSimulator.h"
 
 #include "gtest/gtest.h"
@@ -22,6 +24,122 @@ protected:
     void sortGroups(std::shared_ptr<arch::Network<T>>& network) { network->sortGroups();}
 };
 
+template<typename T>
+class GridDropletTest : public GlobalTest<T> {
+protected:
+    struct GridSimulation {
+        arch::GeneratedNetwork<T> generated;
+        std::unique_ptr<sim::AbstractDroplet<T>> simulation;
+    };
+
+    arch::NetworkGenerator<T> generator;
+
+    void SetUp() override {
+        GlobalTest<T>::SetUp();
+        generator.setFlowRate(3e-11);
+    }
+
+    /**
+     * Droplet simulation on a generated 3x3 grid, with one droplet that is injected
+     * into the first inlet channel at t=0 and the 1D resistance model.
+     */
+    GridSimulation createGridSimulation() {
+        GridSimulation grid { generator.grid(3, 3), nullptr };
+        grid.simulation = std::make_unique<sim::AbstractDroplet<T>>(grid.generated.network);
+        auto fluid0 = grid.simulation->addFluid(1e-3, 1e3);
+        auto fluid1 = grid.simulation->addFluid(3e-3, 1e3);
+        grid.simulation->setContinuousPhase(fluid0->getId());
+        auto droplet = grid.simulation->addDroplet(fluid1->getId(), 1.5 * 100e-6 * 100e-6 * 30e-6);
+        grid.simulation->addDropletInjection(droplet->getId(), 0.0, grid.generated.inletChannels.front(), 0.5);
+        grid.simulation->set1DResistanceModel();
+        return grid;
+    }
+
+    /**
+     * Simulates the grid droplet simulation of createGridSimulation(), after it was adapted by the given
+     * configuration, e.g., to set the sampling or the profiling.
+     */
+    GridSimulation runGridSimulation(const std::function<void(sim::AbstractDroplet<T>&)>& configure) {
+        auto grid = createGridSimulation();
+        configure(*grid.simulation);
+        grid.simulation->simulate();
+        return grid;
+    }
+};
+
+template<typename T>
+class CrossModuleTest : public GlobalTest<T> {
+protected:
+    struct CrossSimulation {
+        std::shared_ptr<arch::Network<T>> network;
+        std::unique_ptr<sim::HybridContinuous<T>> simulation;
+        std::shared_ptr<sim::lbmSimulator<T>> lbmSimulator;
+    };
+
+    /**
+     * Hybrid simulation of Case1a, i.e., three pressure pumps of 1e3 Pa that feed a cross-shaped CFD module,
+     * which is simulated by an LBM simulator with the given name and the naive hybrid scheme.
+     */
+    CrossSimulation createCrossSimulation(std::string name) {
+        CrossSimulation cross { arch::Network<T>::createNetwork(), nullptr, nullptr };
+        auto& network = cross.network;
+
+        auto node0 = network->addNode(0.0, 0.0, true);
+        auto node1 = network->addNode(1e-3, 2e-3, false);
+        auto node2 = network->addNode(1e-3, 1e-3, false);
+        auto node3 = network->addNode(1e-3, 0.0, false);
+        auto node4 = network->addNode(2e-3, 2e-3, false);
+        auto node5 = network->addNode(1.75e-3, 1e-3, false);
+        auto node6 = network->addNode(2e-3, 0.0, false);
+        auto node7 = network->addNode(2e-3, 1.25e-3, false);
+        auto node8 = network->addNode(2e-3, 0.75e-3, false);
+        auto node9 = network->addNode(2.25e-3, 1e-3, false);
+        auto node10 = network->addNode(3e-3, 1e-3, true);
+
+        T cWidth = 100e-6;
+        T cHeight = 100e-6;
+        T cLength = 0.0;
+        auto c0 = network->addRectangularChannel(node0->getId(), node1->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        auto c1 = network->addRectangularChannel(node0->getId(), node2->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        auto c2 = network->addRectangularChannel(node0->getId(), node3->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node1->getId(), node4->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node2->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node3->getId(), node6->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node4->getId(), node7->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node6->getId(), node8->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node9->getId(), node10->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+
+        std::unordered_map<size_t, arch::Opening<T>> openings;
+        openings.try_emplace(5, arch::Opening<T>(network->getNode(5), std::vector<T>({1.0, 0.0}), 1e-4));
+        openings.try_emplace(7, arch::Opening<T>(network->getNode(7), std::vector<T>({0.0, -1.0}), 1e-4));
+        openings.try_emplace(8, arch::Opening<T>(network->getNode(8), std::vector<T>({0.0, 1.0}), 1e-4));
+        openings.try_emplace(9, arch::Opening<T>(network->getNode(9), std::vector<T>({-1.0, 0.0}), 1e-4));
+        auto m0 = network->addCfdModule(std::vector<T>({ 1.75e-3, 0.75e-3 }), std::vector<T>({ 5e-4, 5e-4 }), "../examples/STL/cross.stl", openings);
+
+        cross.simulation = std::make_unique<sim::HybridContinuous<T>>(network);
+        auto fluid0 = cross.simulation->addFluid(1e-3, 1e3);
+        cross.simulation->setContinuousPhase(fluid0->getId());
+        cross.simulation->setPoiseuilleResistanceModel();
+        cross.lbmSimulator = cross.simulation->addLbmSimulator(network->getCfdModule(m0->getId()), 20, 1e-1, 0.55, 1e-4, 1e-1, name);
+        cross.simulation->setNaiveHybridScheme(0.1, 0.5, 10);
+
+        network->setPressurePump(c0->getId(), 1e3);
+        network->setPressurePump(c1->getId(), 1e3);
+        network->setPressurePump(c2->getId(), 1e3);
+        return cross;
+    }
+
+    /**
+     * Checks the pressures at the openings of the cross module against the reference of Case1a.
+     */
+    void expectCrossPressures(const std::shared_ptr<arch::Network<T>>& network, T tolerance) {
+        EXPECT_NEAR(network->getNodes().at(5)->getPressure(), 791.962, tolerance);
+        EXPECT_NEAR(network->getNodes().at(7)->getPressure(), 753.628, tolerance);
+        EXPECT_NEAR(network->getNodes().at(8)->getPressure(), 753.628, tolerance);
+        EXPECT_NEAR(network->getNodes().at(9)->getPressure(), 422.270, tolerance);
+    }
+};
+
 template<typename T>
 class GeometryTest : public GlobalTest<T> {
 protected:
@@ -36,6 +154,54 @@ protected:
     size_t readVoxels(sim::lbmSimulator<T>& simulator, unsigned char m) { return simulator.readGeometry().getStatistics().getNvoxel(m); }
 };
 
+template<typename T>
+class CfdContinuousTest : public GeometryTest<T> {
+protected:
+    /**
+     * Network of Case1a: three inlets at the nodes 0, 1 and 2, which merge into the outlet at node 6. All channels are
+     * 100 um wide and high and 1 mm long.
+     */
+    std::shared_ptr<arch::Network<T>> createCase1aNetwork() {
+        auto network = arch::Network<T>::createNetwork();
+
+        auto node1 = network->addNode(1e-3, 2e-3, true);
+        auto node2 = network->addNode(1e-3, 1e-3, true);
+        auto node3 = network->addNode(1e-3, 0.0, true);
+        auto node4 = network->addNode(2e-3, 2e-3, false);
+        auto node5 = network->addNode(2e-3, 1e-3, false);
+        auto node6 = network->addNode(2e-3, 0.0, false);
+        auto node7 = network->addNode(3e-3, 1e-3, true);
+
+        T cWidth = 100e-6;
+        T cHeight = 100e-6;
+        T cLength = 1000e-6;
+        network->addRectangularChannel(node1->getId(), node4->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node2->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node3->getId(), node6->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node4->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node6->getId(), node5->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        network->addRectangularChannel(node5->getId(), node7->getId(), cHeight, cWidth, cLength, arch::ChannelType::NORMAL);
+        return network;
+    }
+
+    /**
+     * CFD simulation of the water flow through the Case1a network, with the given pressures at the three inlets and
+     * zero pressure at the outlet.
+     */
+    std::unique_ptr<sim::CfdContinuous<T>> createCase1aSimulation(std::shared_ptr<arch::Network<T>> network, std::array<T,3> inletPressures = { 1e2, 1e2, 1e2 }) {
+        auto simulation = std::make_unique<sim::CfdContinuous<T>>(network);
+        auto fluid0 = simulation->addFluid(1e-3, 1e3);
+        simulation->setContinuousPhase(fluid0->getId());
+        for (size_t i = 0; i < inletPressures.size(); ++i) {
+            simulation->addPressureBC(network->getNode(i), inletPressures[i]);
+        }
+        simulation->addPressureBC(network->getNode(6), 0.0);
+        return simulation;
+    }
+
+    sim::lbmSimulator<T>& getLbmSimulator(sim::CfdContinuous<T>& simulation) { return *simulation.simulator; }
+};
+
 template<typename T>
 class TopologyTest : public GlobalTest<T> {
 protected: